@@ -0,0 +1,81 @@
+"""
+Measures the cost of dispatching an audio device callback into python.
+
+For each dispatch mode, reports the python heap bytes allocated per block (as seen by tracemalloc), how many blocks
+allocated at all, and the average time spent per block.
+
+    python benchmarks/audio_callback_dispatch.py [--blocks N] [--channels N] [--samples N]
+"""
+
+import argparse
+import time
+import tracemalloc
+
+import numpy as np
+
+import popsicle as juce
+
+
+class PassThroughCallback(juce.AudioIODeviceCallback):
+    def audioDeviceAboutToStart(self, device):
+        pass
+
+    def audioDeviceStopped(self):
+        pass
+
+    def audioDeviceIOCallbackWithContext(self, inputs, numInputChannels, outputs, numOutputChannels, numSamples, context):
+        pass
+
+
+def run(mode, blocks, channels, samples):
+    callback = PassThroughCallback()
+    callback.setDispatchMode(mode)
+
+    inputs = np.zeros((channels, samples), dtype=np.float32)
+    outputs = np.zeros((channels, samples), dtype=np.float32)
+    context = juce.AudioIODeviceCallbackContext()
+    dispatch = juce.AudioIODeviceCallback.audioDeviceIOCallbackWithContext
+
+    # Warm up caches (override lookup, prepared views, cached integers)
+    for _ in range(16):
+        dispatch(callback, inputs, channels, outputs, channels, samples, context)
+
+    tracemalloc.start()
+
+    total_bytes = 0
+    allocating_blocks = 0
+    for _ in range(blocks):
+        tracemalloc.reset_peak()
+        before, _ = tracemalloc.get_traced_memory()
+        dispatch(callback, inputs, channels, outputs, channels, samples, context)
+        _, peak = tracemalloc.get_traced_memory()
+
+        allocated = max(0, peak - before)
+        total_bytes += allocated
+        allocating_blocks += 1 if allocated > 0 else 0
+
+    tracemalloc.stop()
+
+    start = time.perf_counter()
+    for _ in range(blocks):
+        dispatch(callback, inputs, channels, outputs, channels, samples, context)
+    elapsed = time.perf_counter() - start
+
+    return total_bytes / blocks, allocating_blocks, elapsed / blocks
+
+
+def main():
+    parser = argparse.ArgumentParser()
+    parser.add_argument("--blocks", type=int, default=10000)
+    parser.add_argument("--channels", type=int, default=2)
+    parser.add_argument("--samples", type=int, default=256)
+    args = parser.parse_args()
+
+    print(f"{'mode':<14} {'bytes/block':>12} {'allocating':>12} {'us/block':>10}")
+    for mode in (juce.AudioIODeviceCallback.DispatchMode.channelLists, juce.AudioIODeviceCallback.DispatchMode.channelViews):
+        bytes_per_block, allocating_blocks, seconds_per_block = run(mode, args.blocks, args.channels, args.samples)
+        print(f"{mode.name:<14} {bytes_per_block:>12.1f} {allocating_blocks:>12} {seconds_per_block * 1e6:>10.2f}")
+
+
+if __name__ == "__main__":
+    main()
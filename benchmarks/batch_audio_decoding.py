@@ -0,0 +1,111 @@
+"""
+Measures the throughput of decoding a directory of audio files into numpy arrays.
+
+Files are decoded first sequentially, opening a reader and calling readArray on each file from python, then with
+AudioFormatManager.decodeFiles, which decodes them on a ThreadPool with the GIL released, using a single thread and then
+all the requested threads. When no directory is given a synthetic corpus of WAV files is generated in a temporary
+directory.
+
+    python benchmarks/batch_audio_decoding.py [directory] [--threads N] [--repeats N] [--files N] [--seconds N]
+"""
+
+import argparse
+import os
+import tempfile
+import time
+from pathlib import Path
+
+import numpy as np
+
+import popsicle as juce
+
+
+def generate_corpus(folder, num_files, seconds):
+    rng = np.random.default_rng(1)
+    wav = juce.WavAudioFormat()
+
+    for index in range(num_files):
+        samples = (rng.standard_normal((2, int(seconds * 44100))) * 0.1).astype(np.float32)
+
+        writer = wav.createWriterFor(juce.FileOutputStream(juce.File(str(Path(folder) / f"file_{index:04}.wav"))), 44100.0, 2, 16)
+        writer.writeArray(samples)
+        del writer
+
+
+def collect_files(manager, folder):
+    extensions = set(manager.getWildcardForAllFormats().replace("*", "").split(";"))
+    return sorted(str(p) for p in Path(folder).rglob("*") if p.suffix.lower() in extensions)
+
+
+def decode_sequential(manager, files):
+    total = 0
+
+    for f in files:
+        reader = manager.createReaderFor(juce.File(f))
+        if reader is not None:
+            total += reader.readArray().shape[1]
+
+    return total
+
+
+def decode_batch(manager, files, num_threads):
+    total = 0
+
+    for _, data, _, error in manager.decodeFiles(files, numThreads=num_threads):
+        if error is None:
+            total += data.shape[1]
+
+    return total
+
+
+def measure(function, repeats):
+    best = float("inf")
+    result = None
+
+    for _ in range(repeats):
+        start = time.perf_counter()
+        result = function()
+        best = min(best, time.perf_counter() - start)
+
+    return best, result
+
+
+def run(manager, files, num_threads, repeats):
+    modes = [
+        ("readArray", lambda: decode_sequential(manager, files)),
+        ("decodeFiles x1", lambda: decode_batch(manager, files, 1)),
+        (f"decodeFiles x{num_threads}", lambda: decode_batch(manager, files, num_threads)),
+    ]
+
+    results = [(name, *measure(function, repeats)) for name, function in modes]
+    assert len(set(samples for _, _, samples in results)) == 1
+
+    print(f"{len(files)} files, {results[0][2]} samples per channel")
+    print(f"{'mode':<20} {'seconds':>10} {'files/s':>12} {'samples/s':>14}")
+    for name, elapsed, samples in results:
+        print(f"{name:<20} {elapsed:>10.4f} {len(files) / elapsed:>12.1f} {samples / elapsed:>14.1f}")
+
+
+def main():
+    parser = argparse.ArgumentParser()
+    parser.add_argument("directory", nargs="?")
+    parser.add_argument("--threads", type=int, default=os.cpu_count() or 4)
+    parser.add_argument("--repeats", type=int, default=3)
+    parser.add_argument("--files", type=int, default=200)
+    parser.add_argument("--seconds", type=float, default=5.0)
+    args = parser.parse_args()
+
+    manager = juce.AudioFormatManager()
+    manager.registerBasicFormats()
+
+    if args.directory:
+        run(manager, collect_files(manager, args.directory), args.threads, args.repeats)
+        return
+
+    with tempfile.TemporaryDirectory() as folder:
+        generate_corpus(folder, args.files, args.seconds)
+        run(manager, collect_files(manager, folder), args.threads, args.repeats)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,49 @@
+"""
+Compares FloatVectorOperations against the equivalent in place numpy expressions.
+
+    python benchmarks/float_vector_operations.py [--sizes 64,1024,65536] [--repeats N]
+"""
+
+import argparse
+import timeit
+
+import numpy as np
+
+import popsicle as juce
+
+fvo = juce.FloatVectorOperations
+
+
+def make_cases(size):
+    dest = np.zeros(size, dtype=np.float32)
+    src = np.random.default_rng(0).uniform(-2.0, 2.0, size).astype(np.float32)
+
+    return [
+        ("add scalar", lambda: fvo.add(dest, 0.5), lambda: np.add(dest, 0.5, out=dest)),
+        ("add vector", lambda: fvo.add(dest, src), lambda: np.add(dest, src, out=dest)),
+        ("multiply scalar", lambda: fvo.multiply(dest, 0.5), lambda: np.multiply(dest, 0.5, out=dest)),
+        ("addWithMultiply", lambda: fvo.addWithMultiply(dest, src, 0.5), lambda: np.add(dest, src * 0.5, out=dest)),
+        ("clip", lambda: fvo.clip(dest, src, -1.0, 1.0), lambda: np.clip(src, -1.0, 1.0, out=dest)),
+        ("abs", lambda: fvo.abs(dest, src), lambda: np.abs(src, out=dest)),
+        ("findMinAndMax", lambda: fvo.findMinAndMax(src), lambda: (src.min(), src.max())),
+    ]
+
+
+def main():
+    parser = argparse.ArgumentParser()
+    parser.add_argument("--sizes", default="64,1024,65536,1048576")
+    parser.add_argument("--repeats", type=int, default=2000)
+    args = parser.parse_args()
+
+    print(f"{'operation':<18} {'size':>9} {'juce us':>10} {'numpy us':>10} {'speedup':>8}")
+    for size in (int(s) for s in args.sizes.split(",")):
+        repeats = max(10, args.repeats * 1024 // max(size, 1024))
+
+        for name, juce_op, numpy_op in make_cases(size):
+            juce_time = min(timeit.repeat(juce_op, number=repeats, repeat=3)) / repeats
+            numpy_time = min(timeit.repeat(numpy_op, number=repeats, repeat=3)) / repeats
+            print(f"{name:<18} {size:>9} {juce_time * 1e6:>10.2f} {numpy_time * 1e6:>10.2f} {numpy_time / juce_time:>8.2f}")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,109 @@
+"""
+Measures the throughput of parsing a directory of standard MIDI files into columnar track tables.
+
+Each file is parsed with MidiFile.readTables, which loads and parses the file with the GIL released, first sequentially
+and then spreading the files over a ThreadPool. When no directory is given a synthetic corpus is generated in a
+temporary directory with MidiFile.writeTables.
+
+    python benchmarks/midi_file_parsing.py [directory] [--threads N] [--repeats N] [--files N] [--events N]
+"""
+
+import argparse
+import os
+import tempfile
+import threading
+import time
+from pathlib import Path
+
+import numpy as np
+
+import popsicle as juce
+
+
+def generate_corpus(folder, num_files, num_events):
+    rng = np.random.default_rng(1)
+
+    for index in range(num_files):
+        ticks = np.sort(rng.integers(0, num_events * 120, num_events // 2)).astype(np.int64)
+        notes = rng.integers(36, 96, len(ticks)).astype(np.uint8)
+
+        track = {
+            "ticks": np.concatenate([ticks, ticks + 60]),
+            "type": np.concatenate([np.full(len(ticks), 0x90), np.full(len(ticks), 0x80)]).astype(np.uint8),
+            "note": np.concatenate([notes, notes]),
+            "velocity": np.concatenate([np.full(len(ticks), 100), np.zeros(len(ticks))]).astype(np.uint8),
+        }
+
+        juce.MidiFile.writeTables([track], Path(folder) / f"file_{index:04}.mid")
+
+
+def collect_files(folder):
+    return sorted(str(p) for p in Path(folder).rglob("*") if p.suffix.lower() in (".mid", ".midi"))
+
+
+def parse_sequential(files):
+    return sum(len(track["ticks"]) for f in files for track in juce.MidiFile.readTables(f)["tracks"])
+
+
+def parse_threaded(files, num_threads):
+    pool = juce.ThreadPool(num_threads)
+    lock = threading.Lock()
+    total = [0]
+
+    def parse(f):
+        count = sum(len(track["ticks"]) for track in juce.MidiFile.readTables(f)["tracks"])
+        with lock:
+            total[0] += count
+
+    for f in files:
+        pool.addJob(lambda f=f: parse(f))
+
+    while pool.getNumJobs() > 0:
+        time.sleep(0.001)
+
+    return total[0]
+
+
+def measure(function, repeats):
+    best = float("inf")
+    result = None
+
+    for _ in range(repeats):
+        start = time.perf_counter()
+        result = function()
+        best = min(best, time.perf_counter() - start)
+
+    return best, result
+
+
+def run(files, num_threads, repeats):
+    sequential_time, sequential_events = measure(lambda: parse_sequential(files), repeats)
+    threaded_time, threaded_events = measure(lambda: parse_threaded(files, num_threads), repeats)
+    assert sequential_events == threaded_events
+
+    print(f"{len(files)} files, {sequential_events} events")
+    print(f"{'mode':<20} {'seconds':>10} {'files/s':>12} {'events/s':>14}")
+    for name, elapsed in (("sequential", sequential_time), (f"threadpool x{num_threads}", threaded_time)):
+        print(f"{name:<20} {elapsed:>10.4f} {len(files) / elapsed:>12.1f} {sequential_events / elapsed:>14.1f}")
+
+
+def main():
+    parser = argparse.ArgumentParser()
+    parser.add_argument("directory", nargs="?")
+    parser.add_argument("--threads", type=int, default=os.cpu_count() or 4)
+    parser.add_argument("--repeats", type=int, default=3)
+    parser.add_argument("--files", type=int, default=200)
+    parser.add_argument("--events", type=int, default=5000)
+    args = parser.parse_args()
+
+    if args.directory:
+        run(collect_files(args.directory), args.threads, args.repeats)
+        return
+
+    with tempfile.TemporaryDirectory() as folder:
+        generate_corpus(folder, args.files, args.events)
+        run(collect_files(folder), args.threads, args.repeats)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,124 @@
+"""
+Measures the cost of dispatching a C++ virtual call into a python override through a trampoline.
+
+Each case reports the time per call when invoking the overridden method directly from python (the lower bound), when
+going through the C++ trampoline (what JUCE does when it calls mouseMove, paint or getNextAudioBlock) and when going
+through the trampoline of a subclass that doesn't override the method. The trampoline cases are measured twice, once
+resolving overrides through pybind11::get_override and once through the cached override resolution.
+
+    python benchmarks/override_dispatch.py [--calls N] [--repeats N]
+"""
+
+import argparse
+import timeit
+
+import popsicle as juce
+
+
+class OverridingComponent(juce.Component):
+    def mouseMove(self, event):
+        pass
+
+    def paint(self, g):
+        pass
+
+
+class NonOverridingComponent(juce.Component):
+    pass
+
+
+class OverridingSource(juce.AudioSource):
+    def prepareToPlay(self, samplesPerBlockExpected, sampleRate):
+        pass
+
+    def releaseResources(self):
+        pass
+
+    def getNextAudioBlock(self, bufferToFill):
+        pass
+
+
+def measure(function, calls, repeats):
+    return min(timeit.repeat(function, number=calls, repeat=repeats)) / calls
+
+
+def make_mouse_event(component):
+    source = juce.Desktop.getInstance().getMainMouseSource()
+    position = juce.Point[float](10.0, 10.0)
+    now = juce.Time.getCurrentTime()
+    return juce.MouseEvent(source, position, juce.ModifierKeys(), 0.0, 0.0, 0.0, 0.0, 0.0,
+                           component, component, now, position, now, 0, False)
+
+
+def run_component_cases(calls, repeats):
+    overriding = OverridingComponent()
+    non_overriding = NonOverridingComponent()
+
+    event = make_mouse_event(overriding)
+    image = juce.Image(juce.Image.ARGB, 16, 16, True)
+    g = juce.Graphics(image)
+
+    return [
+        ("mouseMove",
+            measure(lambda: overriding.mouseMove(event), calls, repeats),
+            measure(lambda: juce.Component.mouseMove(overriding, event), calls, repeats),
+            measure(lambda: juce.Component.mouseMove(non_overriding, event), calls, repeats)),
+        ("paint",
+            measure(lambda: overriding.paint(g), calls, repeats),
+            measure(lambda: juce.Component.paint(overriding, g), calls, repeats),
+            measure(lambda: juce.Component.paint(non_overriding, g), calls, repeats)),
+    ]
+
+
+def run_audio_source_cases(calls, repeats):
+    source = OverridingSource()
+    tone = juce.ToneGeneratorAudioSource()
+    info = juce.AudioSourceChannelInfo()
+
+    block_size = 16
+    direct = measure(lambda: source.getNextAudioBlock(info), calls, repeats)
+    overridden = min(timeit.repeat(lambda: juce.renderAudioSource(source, calls * block_size, blockSize=block_size), number=1, repeat=repeats)) / calls
+    base = min(timeit.repeat(lambda: juce.renderAudioSource(tone, calls * block_size, blockSize=block_size), number=1, repeat=repeats)) / calls
+
+    return [("getNextAudioBlock", direct, overridden, base)]
+
+
+def main():
+    parser = argparse.ArgumentParser()
+    parser.add_argument("--calls", type=int, default=100000)
+    parser.add_argument("--repeats", type=int, default=5)
+    args = parser.parse_args()
+
+    class Application(juce.JUCEApplication):
+        def getApplicationName(self):
+            return "OverrideDispatch"
+
+        def getApplicationVersion(self):
+            return "1.0"
+
+        def initialise(self, commandLineParameters):
+            pass
+
+        def shutdown(self):
+            pass
+
+    with juce.TestApplication(Application) as app:
+        next(app)
+
+        results = {}
+        for cached in (False, True):
+            juce.setOverrideCacheEnabled(cached)
+            results[cached] = run_component_cases(args.calls, args.repeats) + run_audio_source_cases(args.calls, args.repeats)
+
+        juce.setOverrideCacheEnabled(True)
+
+        print(f"{'method':<18} {'direct ns':>10} {'uncached override ns':>21} {'cached override ns':>19} {'uncached base ns':>17} {'cached base ns':>15}")
+        for uncached, cached in zip(results[False], results[True]):
+            name, direct, _, _ = cached
+            print(f"{name:<18} {direct * 1e9:>10.1f} {uncached[2] * 1e9:>21.1f} {cached[2] * 1e9:>19.1f} {uncached[3] * 1e9:>17.1f} {cached[3] * 1e9:>15.1f}")
+
+        next(app)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,69 @@
+"""
+Measures the per block overhead of python audio callbacks, driving them from the offline render device.
+
+    python benchmarks/render_device_overhead.py [--seconds N] [--buffer-size N] [--channels N]
+"""
+
+import argparse
+import time
+
+import popsicle as juce
+
+
+class EmptyCallback(juce.AudioIODeviceCallback):
+    def audioDeviceAboutToStart(self, device):
+        pass
+
+    def audioDeviceStopped(self):
+        pass
+
+    def audioDeviceIOCallbackWithContext(self, inputs, numInputChannels, outputs, numOutputChannels, numSamples, context):
+        pass
+
+
+def render(callback, sample_rate, buffer_size, channels, length):
+    device_type = juce.RenderAudioIODeviceType(
+        sampleRate=sample_rate, bufferSize=buffer_size, numOutputChannels=channels, lengthInSamples=length)
+    device = device_type.createDevice("", "")
+
+    outputs = juce.BigInteger(0)
+    outputs.setRange(0, channels, True)
+    device.open(juce.BigInteger(0), outputs, sample_rate, buffer_size)
+
+    start = time.perf_counter()
+    device.start(callback)
+    device.waitForRenderToFinish()
+    elapsed = time.perf_counter() - start
+
+    device.stop()
+    device.close()
+    return elapsed
+
+
+def main():
+    parser = argparse.ArgumentParser()
+    parser.add_argument("--seconds", type=float, default=60.0)
+    parser.add_argument("--sample-rate", type=float, default=48000.0)
+    parser.add_argument("--buffer-size", type=int, default=256)
+    parser.add_argument("--channels", type=int, default=2)
+    args = parser.parse_args()
+
+    length = int(args.seconds * args.sample_rate)
+    num_blocks = (length + args.buffer_size - 1) // args.buffer_size
+
+    print(f"{'callback':<24} {'us/block':>10} {'x realtime':>12}")
+    for name, make_callback in (
+        ("python (channelLists)", EmptyCallback),
+        ("python (channelViews)", lambda: _with_views(EmptyCallback())),
+        ("native (no-op)", lambda: juce.NativeAudioIODeviceCallback(None))):
+        elapsed = render(make_callback(), args.sample_rate, args.buffer_size, args.channels, length)
+        print(f"{name:<24} {elapsed / num_blocks * 1e6:>10.2f} {args.seconds / elapsed:>12.1f}")
+
+
+def _with_views(callback):
+    callback.setDispatchMode(juce.AudioIODeviceCallback.DispatchMode.channelViews)
+    return callback
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,63 @@
+import math
+
+import numpy as np
+from numba import cfunc, carray, types
+
+from juce_init import START_JUCE_COMPONENT
+import popsicle as juce
+
+
+# State shared with the native callback: [phase, phase increment, gain]
+state = np.array([0.0, 0.0, 0.25], dtype=np.float64)
+
+
+@cfunc(types.void(types.voidptr, types.double, types.intc))
+def about_to_start(user_data, sample_rate, buffer_size):
+    params = carray(user_data, 3, dtype=np.float64)
+    params[1] = 2.0 * math.pi * 440.0 / sample_rate
+
+
+@cfunc(types.void(types.voidptr,
+                  types.CPointer(types.CPointer(types.float32)), types.intc,
+                  types.CPointer(types.CPointer(types.float32)), types.intc,
+                  types.intc))
+def process(user_data, inputs, num_inputs, outputs, num_outputs, num_samples):
+    params = carray(user_data, 3, dtype=np.float64)
+
+    phase = params[0]
+    for sample in range(num_samples):
+        value = math.sin(phase) * params[2]
+        phase += params[1]
+
+        for channel in range(num_outputs):
+            outputs[channel][sample] = value
+
+    params[0] = phase % (2.0 * math.pi)
+
+
+class MainContentComponent(juce.Component):
+    manager = juce.AudioDeviceManager()
+    audio_callback = juce.NativeAudioIODeviceCallback(process, state, aboutToStart=about_to_start)
+
+    def __init__(self):
+        juce.Component.__init__(self)
+
+        self.manager.addAudioCallback(self.audio_callback)
+        result = self.manager.initialiseWithDefaultDevices(0, 2)
+        if result:
+            print(result)
+
+        self.setSize(600, 400)
+        self.setOpaque(True)
+
+    def visibilityChanged(self):
+        if not self.isVisible() and self.manager:
+            self.manager.removeAudioCallback(self.audio_callback)
+            self.manager.closeAudioDevice()
+
+    def paint(self, g):
+        g.fillAll(juce.Colours.slategrey)
+
+
+if __name__ == "__main__":
+    START_JUCE_COMPONENT(MainContentComponent, name="Numba Audio Callback")
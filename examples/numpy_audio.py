@@ -5,19 +5,27 @@ import popsicle as juce
 
 
 class AudioCallback(juce.AudioIODeviceCallback):
-    gain = 1.0
     time = 0.0
     device = None
 
+    def __init__(self):
+        juce.AudioIODeviceCallback.__init__(self)
+        self.parameters = juce.ParameterBlock({ "gain": 1.0 })
+        self.parameters.setSmoothingTime("gain", 0.05)
+
     def audioDeviceAboutToStart(self, device: juce.AudioIODevice):
         print("starting", device, "at", device.getCurrentSampleRate())
         self.device = device
         self.buffer = np.zeros(self.device.getCurrentBufferSizeSamples())
+        self.gain = np.ones(self.device.getCurrentBufferSizeSamples(), dtype=np.float32)
+        self.parameters.prepare(device.getCurrentSampleRate())
 
     def audioDeviceIOCallbackWithContext(self, inputs, numInputChannels, outputs, numOutputChannels, numSamples, context):
         start = self.time
         end = start + 2.0 * numSamples
 
+        self.parameters.fillSmoothedValues("gain", self.gain, numSamples)
+
         self.buffer[:] = (
             (np.random.random(numSamples) * 2.0 - 1 * 0.025) + np.sin(np.deg2rad(np.linspace(start, end, numSamples)))
         ) * self.gain * 0.005
@@ -64,9 +72,9 @@ class MainContentComponent(juce.Component):
 
     def onButtonStateChange(self):
         if self.button.getState() == juce.Button.ButtonState.buttonDown:
-            self.audio_callback.gain = 0.25
+            self.audio_callback.parameters["gain"] = 0.25
         else:
-            self.audio_callback.gain = 1.0
+            self.audio_callback.parameters["gain"] = 1.0
 
     def paint(self, g: juce.Graphics):
         g.fillAll(juce.Colours.black)
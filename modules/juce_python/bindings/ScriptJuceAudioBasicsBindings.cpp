@@ -20,8 +20,16 @@
 #include "../utilities/ClassDemangling.h"
 
 #define JUCE_PYTHON_INCLUDE_PYBIND11_OPERATORS
+#define JUCE_PYTHON_INCLUDE_PYBIND11_NUMPY
 #include "../utilities/PyBind11Includes.h"
 
+#include "../utilities/PythonInterop.h"
+
+#include <limits>
+#include <optional>
+#include <unordered_map>
+#include <vector>
+
 namespace popsicle::Bindings {
 
 using namespace juce;
@@ -31,6 +39,501 @@ using namespace pybind11::literals;
 
 // ============================================================================================
 
+template <class T>
+class ReferencedChannels
+{
+public:
+    ReferencedChannels (const py::object& dataToReferTo, int numChannelsToUse, int startSample, int numSamplesToUse)
+        : channels (dataToReferTo)
+    {
+        numChannels = numChannelsToUse < 0 ? channels.getNumChannels() : numChannelsToUse;
+        numSamples = numSamplesToUse < 0 ? channels.getNumSamples() - startSample : numSamplesToUse;
+
+        if (numChannels > channels.getNumChannels())
+            throw py::value_error ("Requested more channels than available in the referenced data");
+
+        if (startSample < 0 || numSamples < 0 || startSample + numSamples > channels.getNumSamples())
+            throw py::value_error ("Requested samples are out of the range of the referenced data");
+
+        offsetChannels.reserve (static_cast<size_t> (numChannels));
+        for (int i = 0; i < numChannels; ++i)
+            offsetChannels.push_back (channels.data()[i] + startSample);
+    }
+
+    AudioBuffer<T>* createBuffer() const
+    {
+        if (numChannels == 0)
+            return new AudioBuffer<T> (0, numSamples);
+
+        return new AudioBuffer<T> (offsetChannels.data(), numChannels, numSamples);
+    }
+
+    void referTo (AudioBuffer<T>& buffer) const
+    {
+        if (numChannels == 0)
+            buffer.setSize (0, numSamples);
+        else
+            buffer.setDataToReferTo (offsetChannels.data(), numChannels, numSamples);
+    }
+
+private:
+    PyChannelPointers<T> channels;
+    std::vector<T*> offsetChannels;
+    int numChannels = 0;
+    int numSamples = 0;
+};
+
+// ============================================================================================
+
+/** Replaces the python object owning the data a wrapped AudioBuffer refers to, releasing the previous one. */
+void setReferencedDataOwner (py::handle buffer, py::object owner)
+{
+    // Intentionally leaked, entries are dropped by the buffer weak reference callbacks instead
+    static auto* owners = new std::unordered_map<PyObject*, py::object>();
+
+    if (auto it = owners->find (buffer.ptr()); it != owners->end())
+    {
+        auto previousOwner = std::exchange (it->second, std::move (owner));
+        return;
+    }
+
+    if (! owner)
+        return;
+
+    py::cpp_function removeEntry ([key = buffer.ptr()] (py::handle weakref)
+    {
+        if (auto entry = owners->find (key); entry != owners->end())
+        {
+            auto previousOwner = std::move (entry->second);
+            owners->erase (entry);
+        }
+
+        weakref.dec_ref();
+    });
+
+    (void) py::weakref (buffer, removeEntry).release();
+
+    owners->emplace (buffer.ptr(), std::move (owner));
+}
+
+// ============================================================================================
+
+int getParameterBlockIndex (const PyParameterBlock& block, py::handle key)
+{
+    if (py::isinstance<py::str> (key))
+    {
+        const auto name = key.cast<String>();
+        const auto index = block.getParameterIndex (name);
+
+        if (index < 0)
+            throw py::key_error (("Unknown parameter \"" + name + "\"").toStdString());
+
+        return index;
+    }
+
+    const auto index = key.cast<int>();
+    if (! block.isValidIndex (index))
+        throw py::index_error ("Parameter index out of range");
+
+    return index;
+}
+
+// ============================================================================================
+
+class TypedRecordFifo : public PyRecordFifo
+{
+public:
+    TypedRecordFifo (int capacity, std::vector<py::ssize_t> shape, py::dtype type)
+        : PyRecordFifo (capacity, static_cast<int> (getRecordSizeInBytes (shape, type)))
+        , recordShape (std::move (shape))
+        , recordType (std::move (type))
+    {
+    }
+
+    const std::vector<py::ssize_t>& getRecordShape() const noexcept
+    {
+        return recordShape;
+    }
+
+    const py::dtype& getRecordType() const noexcept
+    {
+        return recordType;
+    }
+
+    /** Converts anything array like to a contiguous array of the fifo dtype. */
+    py::array asRecords (py::handle records) const
+    {
+        return py::module_::import ("numpy").attr ("ascontiguousarray") (records, "dtype"_a = recordType);
+    }
+
+    /** Returns the number of whole records held by a contiguous array, checking its dtype matches. */
+    int getNumRecordsIn (const py::array& records) const
+    {
+        if (! records.dtype().equal (recordType))
+            throw py::type_error ("Records must have the fifo dtype");
+
+        if (records.nbytes() % getRecordSize() != 0)
+            throw py::value_error ("Records must hold a whole number of records");
+
+        return static_cast<int> (records.nbytes() / getRecordSize());
+    }
+
+private:
+    static py::ssize_t getRecordSizeInBytes (const std::vector<py::ssize_t>& shape, const py::dtype& type)
+    {
+        py::ssize_t size = type.itemsize();
+
+        for (const auto dimension : shape)
+        {
+            if (dimension <= 0)
+                throw py::value_error ("Invalid record shape");
+
+            size *= dimension;
+        }
+
+        if (size <= 0 || size > std::numeric_limits<int>::max())
+            throw py::value_error ("Invalid record shape");
+
+        return size;
+    }
+
+    std::vector<py::ssize_t> recordShape;
+    py::dtype recordType;
+};
+
+// ============================================================================================
+
+using MidiEventRecordArray = py::array_t<MidiEventRecord, py::array::c_style | py::array::forcecast>;
+
+/** Registers the record dtype on first use, so numpy isn't required to import the module. */
+void registerMidiEventRecordDtype()
+{
+    static const bool registered = []
+    {
+        PYBIND11_NUMPY_DTYPE (MidiEventRecord, timestamp, status, data1, data2);
+        return true;
+    }();
+
+    ignoreUnused (registered);
+}
+
+MidiEventRecordArray makeMidiEventRecordArray (py::ssize_t numRecords)
+{
+    registerMidiEventRecordDtype();
+    return MidiEventRecordArray (numRecords);
+}
+
+py::object makeMidiEventRecords (const MidiEventRecord* records, int numRecords)
+{
+    auto result = makeMidiEventRecordArray (numRecords);
+
+    if (numRecords > 0)
+        std::copy_n (records, numRecords, result.mutable_data());
+
+    return std::move (result);
+}
+
+MidiEventRecordArray toMidiEventRecordArray (const py::object& records)
+{
+    registerMidiEventRecordDtype();
+
+    auto result = MidiEventRecordArray::ensure (records);
+    if (! result)
+        throw py::error_already_set();
+
+    return result;
+}
+
+bool isMidiEventRecordable (const uint8* data, int numBytes) noexcept
+{
+    return numBytes > 0 && numBytes <= 3 && data[0] >= 0x80 && data[0] != 0xf0 && data[0] != 0xf7 && data[0] != 0xff;
+}
+
+MidiEventRecord makeMidiEventRecord (const uint8* data, int numBytes, double timestamp) noexcept
+{
+    return { timestamp, data[0], numBytes > 1 ? data[1] : uint8 (0), numBytes > 2 ? data[2] : uint8 (0) };
+}
+
+/** Calls the function with the raw bytes and timestamp of every valid record, with the GIL released. */
+template <class F>
+void forEachMidiEventRecord (const MidiEventRecordArray& records, F&& function)
+{
+    const auto* data = records.data();
+    const auto numRecords = static_cast<size_t> (records.size());
+
+    py::gil_scoped_release release;
+
+    for (size_t i = 0; i < numRecords; ++i)
+    {
+        const uint8 bytes[] = { data[i].status, data[i].data1, data[i].data2 };
+
+        if (bytes[0] < 0x80 || bytes[0] == 0xf0 || bytes[0] == 0xf7 || bytes[0] == 0xff)
+            continue;
+
+        function (bytes, MidiMessage::getMessageLengthFromFirstByte (bytes[0]), data[i].timestamp);
+    }
+}
+
+// ============================================================================================
+
+/** A track of a MIDI file as parallel columns, one entry per event. */
+struct MidiTrackColumns
+{
+    std::vector<int64> ticks;
+    std::vector<double> seconds;
+    std::vector<uint8> type;
+    std::vector<uint8> channel;
+    std::vector<uint8> note;
+    std::vector<uint8> velocity;
+    std::vector<uint8> controller;
+    std::vector<int32> value;
+    std::vector<uint8> meta;
+
+    void reserve (size_t numEvents)
+    {
+        ticks.reserve (numEvents);
+        seconds.reserve (numEvents);
+        type.reserve (numEvents);
+        channel.reserve (numEvents);
+        note.reserve (numEvents);
+        velocity.reserve (numEvents);
+        controller.reserve (numEvents);
+        value.reserve (numEvents);
+        meta.reserve (numEvents);
+    }
+
+    void add (const MidiMessage& message)
+    {
+        const auto status = message.getRawData()[0];
+        const auto messageType = static_cast<uint8> (status < 0xf0 ? (status & 0xf0) : status);
+
+        uint8 noteNumber = 0, noteVelocity = 0, controllerNumber = 0, metaType = 0;
+        int32 messageValue = 0;
+
+        switch (messageType)
+        {
+            case 0x80:
+            case 0x90: noteNumber = static_cast<uint8> (message.getNoteNumber()); noteVelocity = message.getVelocity(); break;
+            case 0xa0: noteNumber = static_cast<uint8> (message.getNoteNumber()); messageValue = message.getAfterTouchValue(); break;
+            case 0xb0: controllerNumber = static_cast<uint8> (message.getControllerNumber()); messageValue = message.getControllerValue(); break;
+            case 0xc0: messageValue = message.getProgramChangeNumber(); break;
+            case 0xd0: messageValue = message.getChannelPressureValue(); break;
+            case 0xe0: messageValue = message.getPitchWheelValue(); break;
+            case 0xf0: messageValue = message.getSysExDataSize(); break;
+            case 0xff: metaType = static_cast<uint8> (message.getMetaEventType()); messageValue = getMetaEventValue (message); break;
+            default: break;
+        }
+
+        ticks.push_back (static_cast<int64> (message.getTimeStamp()));
+        seconds.push_back (0.0);
+        type.push_back (messageType);
+        channel.push_back (static_cast<uint8> (message.getChannel()));
+        note.push_back (noteNumber);
+        velocity.push_back (noteVelocity);
+        controller.push_back (controllerNumber);
+        value.push_back (messageValue);
+        meta.push_back (metaType);
+    }
+
+    /** Tempo events store their microseconds per quarter note, time signatures numerator * 256 + denominator. */
+    static int32 getMetaEventValue (const MidiMessage& message)
+    {
+        if (message.isTempoMetaEvent())
+            return roundToInt (message.getTempoSecondsPerQuarterNote() * 1000000.0);
+
+        if (message.isTimeSignatureMetaEvent())
+        {
+            int numerator = 0, denominator = 0;
+            message.getTimeSignatureInfo (numerator, denominator);
+            return numerator * 256 + denominator;
+        }
+
+        return message.getMetaEventLength();
+    }
+
+    /** Returns the message of a row, or an empty optional for the events that can't be rebuilt from the columns. */
+    static std::optional<MidiMessage> createMessage (uint8 messageType, int channel, int noteNumber, int noteVelocity,
+                                                     int controllerNumber, int32 messageValue, uint8 metaType)
+    {
+        channel = jlimit (1, 16, channel);
+        noteNumber &= 0x7f;
+        controllerNumber &= 0x7f;
+
+        switch (messageType)
+        {
+            case 0x80: return MidiMessage::noteOff (channel, noteNumber, static_cast<uint8> (noteVelocity & 0x7f));
+            case 0x90: return MidiMessage::noteOn (channel, noteNumber, static_cast<uint8> (noteVelocity & 0x7f));
+            case 0xa0: return MidiMessage::aftertouchChange (channel, noteNumber, messageValue & 0x7f);
+            case 0xb0: return MidiMessage::controllerEvent (channel, controllerNumber, messageValue & 0x7f);
+            case 0xc0: return MidiMessage::programChange (channel, messageValue & 0x7f);
+            case 0xd0: return MidiMessage::channelPressureChange (channel, messageValue & 0x7f);
+            case 0xe0: return MidiMessage::pitchWheel (channel, jlimit (0, 0x3fff, static_cast<int> (messageValue)));
+            case 0xff:
+                if (metaType == 0x51)
+                    return MidiMessage::tempoMetaEvent (messageValue);
+
+                if (metaType == 0x58)
+                    return MidiMessage::timeSignatureMetaEvent (messageValue / 256, messageValue % 256);
+
+                return {};
+
+            default:
+                return {};
+        }
+    }
+};
+
+struct MidiFileColumns
+{
+    short timeFormat = 0;
+    int midiFileType = 0;
+    std::vector<MidiTrackColumns> tracks;
+};
+
+/** Parses a standard MIDI file into columns, without touching python. */
+std::optional<MidiFileColumns> parseMidiFileColumns (const void* data, size_t numBytes, bool createMatchingNoteOffs)
+{
+    MemoryInputStream stream (data, numBytes, false);
+
+    MidiFile file;
+    MidiFileColumns result;
+
+    if (! file.readFrom (stream, createMatchingNoteOffs, &result.midiFileType))
+        return {};
+
+    result.timeFormat = file.getTimeFormat();
+    result.tracks.resize (static_cast<size_t> (file.getNumTracks()));
+
+    for (int trackIndex = 0; trackIndex < file.getNumTracks(); ++trackIndex)
+    {
+        const auto& track = *file.getTrack (trackIndex);
+        auto& columns = result.tracks[static_cast<size_t> (trackIndex)];
+
+        columns.reserve (static_cast<size_t> (track.getNumEvents()));
+
+        for (const auto* event : track)
+            columns.add (event->message);
+    }
+
+    file.convertTimestampTicksToSeconds();
+
+    for (int trackIndex = 0; trackIndex < file.getNumTracks(); ++trackIndex)
+    {
+        const auto& track = *file.getTrack (trackIndex);
+        auto& seconds = result.tracks[static_cast<size_t> (trackIndex)].seconds;
+
+        for (int eventIndex = 0; eventIndex < track.getNumEvents(); ++eventIndex)
+            seconds[static_cast<size_t> (eventIndex)] = track.getEventPointer (eventIndex)->message.getTimeStamp();
+    }
+
+    return result;
+}
+
+/** Hands over the vector to a numpy array without copying it. */
+template <class T>
+py::array_t<T> makeArrayFromVector (std::vector<T>&& values)
+{
+    auto* heapValues = new std::vector<T> (std::move (values));
+
+    py::capsule owner (heapValues, [](void* pointer) { delete static_cast<std::vector<T>*> (pointer); });
+
+    return py::array_t<T> (static_cast<py::ssize_t> (heapValues->size()), heapValues->data(), owner);
+}
+
+py::dict makeMidiTrackTable (MidiTrackColumns&& columns)
+{
+    py::dict table;
+    table["ticks"] = makeArrayFromVector (std::move (columns.ticks));
+    table["seconds"] = makeArrayFromVector (std::move (columns.seconds));
+    table["type"] = makeArrayFromVector (std::move (columns.type));
+    table["channel"] = makeArrayFromVector (std::move (columns.channel));
+    table["note"] = makeArrayFromVector (std::move (columns.note));
+    table["velocity"] = makeArrayFromVector (std::move (columns.velocity));
+    table["controller"] = makeArrayFromVector (std::move (columns.controller));
+    table["value"] = makeArrayFromVector (std::move (columns.value));
+    table["meta"] = makeArrayFromVector (std::move (columns.meta));
+    return table;
+}
+
+template <class T>
+py::array_t<T, py::array::c_style | py::array::forcecast> getMidiTrackColumn (const py::dict& table, const char* name, py::ssize_t numEvents, T defaultValue)
+{
+    using Column = py::array_t<T, py::array::c_style | py::array::forcecast>;
+
+    if (! table.contains (name))
+    {
+        Column column (numEvents);
+        std::fill_n (column.mutable_data(), numEvents, defaultValue);
+        return column;
+    }
+
+    auto column = Column::ensure (table[name]);
+    if (! column)
+        throw py::error_already_set();
+
+    if (column.ndim() != 1 || (numEvents >= 0 && column.size() != numEvents))
+        throw py::value_error ("All the columns of a track must be 1D and have the same length");
+
+    return column;
+}
+
+/** Builds a sequence out of a columnar track table, all the columns except ticks and type are optional. */
+MidiMessageSequence makeSequenceFromMidiTrackTable (const py::dict& table)
+{
+    if (! table.contains ("ticks") || ! table.contains ("type"))
+        throw py::key_error ("A track table needs at least the ticks and type columns");
+
+    const auto ticks = getMidiTrackColumn<int64> (table, "ticks", -1, 0);
+    const auto numEvents = ticks.size();
+
+    const auto type = getMidiTrackColumn<uint8> (table, "type", numEvents, 0);
+    const auto channel = getMidiTrackColumn<uint8> (table, "channel", numEvents, 1);
+    const auto note = getMidiTrackColumn<uint8> (table, "note", numEvents, 0);
+    const auto velocity = getMidiTrackColumn<uint8> (table, "velocity", numEvents, 0);
+    const auto controller = getMidiTrackColumn<uint8> (table, "controller", numEvents, 0);
+    const auto value = getMidiTrackColumn<int32> (table, "value", numEvents, 0);
+    const auto meta = getMidiTrackColumn<uint8> (table, "meta", numEvents, 0);
+
+    MidiMessageSequence sequence;
+
+    py::gil_scoped_release release;
+
+    for (py::ssize_t i = 0; i < numEvents; ++i)
+    {
+        const auto message = MidiTrackColumns::createMessage (type.data()[i], channel.data()[i], note.data()[i], velocity.data()[i],
+                                                              controller.data()[i], value.data()[i], meta.data()[i]);
+
+        if (message)
+            sequence.addEvent (message->withTimeStamp (static_cast<double> (ticks.data()[i])));
+    }
+
+    sequence.updateMatchedPairs();
+
+    return sequence;
+}
+
+// ============================================================================================
+
+template <class T>
+const char* getAudioBufferExportError (const AudioBuffer<T>& buffer) noexcept
+{
+    if (buffer.getNumChannels() == 0 || getUniformChannelStride (buffer.getArrayOfReadPointers(), buffer.getNumChannels(), buffer.getNumSamples()))
+        return nullptr;
+
+    return "AudioBuffer channels are not laid out with a uniform stride, access them individually with getWritePointer instead";
+}
+
+template <class T>
+const char* getAudioChannelsViewExportError (const PyAudioChannelsView<T>& view) noexcept
+{
+    if (view.getChannelStride())
+        return nullptr;
+
+    return "Channels are not laid out with a uniform stride, access them individually instead";
+}
+
+// ============================================================================================
+
 template <template <class> class Class, class... Types>
 void registerAudioBuffer (py::module_& m)
 {
@@ -46,7 +549,10 @@ void registerAudioBuffer (py::module_& m)
         auto class_ = py::class_<T> (m, className.toRawUTF8(), py::buffer_protocol())
             .def (py::init<>())
             .def (py::init<int, int>(), "numChannels"_a, "numSamples"_a)
-        //.def (py::init ([](py::buffer dataToReferTo, int numChannelsToUse, int startSample, int numSamples) {})
+            .def (py::init ([](py::object dataToReferTo, int numChannelsToUse, int startSample, int numSamples)
+            {
+                return ReferencedChannels<ValueType> (dataToReferTo, numChannelsToUse, startSample, numSamples).createBuffer();
+            }), "dataToReferTo"_a, "numChannelsToUse"_a = -1, "startSample"_a = 0, "numSamples"_a = -1, py::keep_alive<1, 2>())
             .def ("getNumChannels", &T::getNumChannels)
             .def ("getNumSamples", &T::getNumSamples)
             .def ("getReadPointer", [](const T& self, int channelNumber)
@@ -85,10 +591,23 @@ void registerAudioBuffer (py::module_& m)
 
                 return result;
             })
-            .def ("setSize", &T::setSize,
-                "newNumChannels"_a, "newNumSamples"_a, "keepExistingContent"_a = false, "clearExtraSpace"_a = false, "avoidReallocating"_a = false)
-        //.def ("setDataToReferTo", py::overload_cast<ValueType* const*, int, int, int> (&T::setDataToReferTo))
-        //.def ("setDataToReferTo", py::overload_cast<ValueType* const*, int, int> (&T::setDataToReferTo))
+            .def ("setSize", [](py::object selfObject, int newNumChannels, int newNumSamples, bool keepExistingContent, bool clearExtraSpace, bool avoidReallocating)
+            {
+                auto& self = selfObject.cast<T&>();
+                if (newNumChannels == self.getNumChannels() && newNumSamples == self.getNumSamples())
+                    return;
+
+                self.setSize (newNumChannels, newNumSamples, keepExistingContent, clearExtraSpace, avoidReallocating);
+
+                // Resizing always moves a buffer referring to external data into its own allocation
+                setReferencedDataOwner (selfObject, py::object());
+            }, "newNumChannels"_a, "newNumSamples"_a, "keepExistingContent"_a = false, "clearExtraSpace"_a = false, "avoidReallocating"_a = false)
+            .def ("setDataToReferTo", [](py::object selfObject, py::object dataToReferTo, int numChannelsToUse, int startSample, int numSamples)
+            {
+                ReferencedChannels<ValueType> (dataToReferTo, numChannelsToUse, startSample, numSamples).referTo (selfObject.cast<T&>());
+
+                setReferencedDataOwner (selfObject, std::move (dataToReferTo));
+            }, "dataToReferTo"_a, "numChannelsToUse"_a = -1, "startSample"_a = 0, "numSamples"_a = -1)
             .def ("makeCopyOf", &T::template makeCopyOf<ValueType>, "other"_a, "avoidReallocating"_a = false)
             .def ("clear", py::overload_cast<> (&T::clear))
             .def ("clear", py::overload_cast<int, int> (&T::clear), "startSample"_a, "numSamples"_a)
@@ -128,8 +647,47 @@ void registerAudioBuffer (py::module_& m)
                     << "(" << self.getNumChannels() << ", " << self.getNumSamples() << ")";
                 return result;
             })
+            .def ("hasContiguousChannels", [](const T& self)
+            {
+                return self.getNumChannels() == 0
+                    || getUniformChannelStride (self.getArrayOfReadPointers(), self.getNumChannels(), self.getNumSamples()).has_value();
+            })
+            .def_buffer ([](T& self) -> py::buffer_info
+            {
+                const auto numChannels = self.getNumChannels();
+                const auto numSamples = self.getNumSamples();
+                const auto itemSize = static_cast<py::ssize_t> (sizeof (ValueType));
+
+                if (numChannels == 0)
+                {
+                    return py::buffer_info (
+                        nullptr,
+                        itemSize,
+                        py::format_descriptor<ValueType>::format(),
+                        2,
+                        { py::ssize_t (0), static_cast<py::ssize_t> (numSamples) },
+                        { static_cast<py::ssize_t> (numSamples) * itemSize, itemSize });
+                }
+
+                // Buffers without a uniform stride are rejected by getAudioBufferExportError before getting here
+                const auto stride = getUniformChannelStride (self.getArrayOfReadPointers(), numChannels, numSamples);
+                jassert (stride.has_value());
+
+                // The exported memory is writable, so the buffer can't be considered cleared anymore
+                auto channels = self.getArrayOfWritePointers();
+
+                return py::buffer_info (
+                    channels[0],
+                    itemSize,
+                    py::format_descriptor<ValueType>::format(),
+                    2,
+                    { static_cast<py::ssize_t> (numChannels), static_cast<py::ssize_t> (numSamples) },
+                    { static_cast<py::ssize_t> (stride.value_or (numSamples)) * itemSize, itemSize });
+            })
         ;
 
+        Helpers::setBufferExportCheck<&getAudioBufferExportError<ValueType>> (class_);
+
         type[py::type::of (py::cast (Types{}))] = class_;
 
         return true;
@@ -140,6 +698,275 @@ void registerAudioBuffer (py::module_& m)
 
 // ============================================================================================
 
+template <class T>
+void registerAudioChannelsView (py::module_& m, const char* className)
+{
+    using ValueType = std::remove_const_t<T>;
+    using View = PyAudioChannelsView<T>;
+
+    py::class_<View> class_ (m, className, py::buffer_protocol());
+
+    class_
+        .def ("getNumChannels", &View::getNumChannels)
+        .def ("getNumSamples", &View::getNumSamples)
+        .def ("hasUniformStride", [](const View& self) { return self.getChannelStride().has_value(); })
+        .def ("__getitem__", &View::getChannel)
+        .def ("__len__", &View::getNumChannels)
+        .def ("__iter__", [](const View& self)
+        {
+            return py::make_iterator (self.begin(), self.end());
+        }, py::keep_alive<0, 1>())
+        .def_buffer ([](View& self) -> py::buffer_info
+        {
+            // Views without a uniform stride are rejected by getAudioChannelsViewExportError before getting here
+            const auto stride = self.getChannelStride();
+            jassert (stride.has_value());
+
+            return py::buffer_info (
+                const_cast<ValueType*> (self.getChannelPointer (0)),
+                static_cast<py::ssize_t> (sizeof (ValueType)),
+                py::format_descriptor<ValueType>::format(),
+                2,
+                { static_cast<py::ssize_t> (self.getNumChannels()), static_cast<py::ssize_t> (self.getNumSamples()) },
+                { static_cast<py::ssize_t> (stride.value_or (self.getNumSamples()) * static_cast<std::ptrdiff_t> (sizeof (ValueType))), static_cast<py::ssize_t> (sizeof (ValueType)) },
+                std::is_const_v<T>);
+        })
+        .def ("__repr__", [className](const View& self)
+        {
+            String result;
+            result
+                << PythonModuleName << "." << className
+                << "(" << self.getNumChannels() << ", " << self.getNumSamples() << ")";
+            return result;
+        })
+    ;
+
+    Helpers::setBufferExportCheck<&getAudioChannelsViewExportError<T>> (class_);
+}
+
+// ============================================================================================
+
+static constexpr int vectorOperationsReleaseGILThreshold = 4096;
+
+template <class T>
+class VectorOperand
+{
+public:
+    VectorOperand (const py::buffer& buffer, bool writable)
+        : info (buffer.request (writable))
+    {
+        if (! Helpers::isBufferFormatOf<T> (info))
+            throw py::type_error ("Vector operands must have format '" + py::format_descriptor<T>::format() + "', got '" + info.format + "'");
+
+        py::ssize_t expectedStride = info.itemsize;
+        for (auto dimension = info.ndim; --dimension >= 0;)
+        {
+            if (info.shape[static_cast<size_t> (dimension)] > 1 && info.strides[static_cast<size_t> (dimension)] != expectedStride)
+                throw py::value_error ("Vector operands must be contiguous in memory");
+
+            expectedStride *= info.shape[static_cast<size_t> (dimension)];
+        }
+
+        if (info.size > static_cast<py::ssize_t> (std::numeric_limits<int>::max()))
+            throw py::value_error ("Vector operands are too large");
+    }
+
+    T* data() const noexcept
+    {
+        return static_cast<T*> (info.ptr);
+    }
+
+    int size() const noexcept
+    {
+        return static_cast<int> (info.size);
+    }
+
+    const VectorOperand& atLeast (int numValues) const
+    {
+        if (size() < numValues)
+            throw py::value_error ("Source vector is shorter than the destination vector");
+
+        return *this;
+    }
+
+private:
+    py::buffer_info info;
+};
+
+template <class F>
+decltype(auto) withVectorValueType (const py::buffer& buffer, F&& func)
+{
+    const auto format = buffer.request().format;
+
+    if (format == py::format_descriptor<float>::format())
+        return func (float{});
+
+    if (format == py::format_descriptor<double>::format())
+        return func (double{});
+
+    throw py::type_error ("Vector operands must contain float or double values, got '" + format + "'");
+}
+
+template <class F>
+void invokeVectorOperation (int numValues, F&& func)
+{
+    if (numValues >= vectorOperationsReleaseGILThreshold)
+    {
+        py::gil_scoped_release release;
+        func();
+    }
+    else
+    {
+        func();
+    }
+}
+
+template <class Op>
+auto makeVectorOperation (Op op)
+{
+    return [op](py::buffer dest)
+    {
+        withVectorValueType (dest, [&](auto type)
+        {
+            using T = decltype (type);
+
+            VectorOperand<T> d (dest, true);
+            invokeVectorOperation (d.size(), [&] { op (d.data(), d.size()); });
+        });
+    };
+}
+
+template <class Op>
+auto makeVectorScalarOperation (Op op)
+{
+    return [op](py::buffer dest, double value)
+    {
+        withVectorValueType (dest, [&](auto type)
+        {
+            using T = decltype (type);
+
+            VectorOperand<T> d (dest, true);
+            invokeVectorOperation (d.size(), [&] { op (d.data(), static_cast<T> (value), d.size()); });
+        });
+    };
+}
+
+template <class Op>
+auto makeVectorVectorOperation (Op op)
+{
+    return [op](py::buffer dest, py::buffer src)
+    {
+        withVectorValueType (dest, [&](auto type)
+        {
+            using T = decltype (type);
+
+            VectorOperand<T> d (dest, true);
+            VectorOperand<T> s (src, false);
+            s.atLeast (d.size());
+
+            invokeVectorOperation (d.size(), [&] { op (d.data(), s.data(), d.size()); });
+        });
+    };
+}
+
+template <class Op>
+auto makeVectorVectorScalarOperation (Op op)
+{
+    return [op](py::buffer dest, py::buffer src, double value)
+    {
+        withVectorValueType (dest, [&](auto type)
+        {
+            using T = decltype (type);
+
+            VectorOperand<T> d (dest, true);
+            VectorOperand<T> s (src, false);
+            s.atLeast (d.size());
+
+            invokeVectorOperation (d.size(), [&] { op (d.data(), s.data(), static_cast<T> (value), d.size()); });
+        });
+    };
+}
+
+template <class Op>
+auto makeVectorVectorVectorOperation (Op op)
+{
+    return [op](py::buffer dest, py::buffer src1, py::buffer src2)
+    {
+        withVectorValueType (dest, [&](auto type)
+        {
+            using T = decltype (type);
+
+            VectorOperand<T> d (dest, true);
+            VectorOperand<T> s1 (src1, false);
+            VectorOperand<T> s2 (src2, false);
+            s1.atLeast (d.size());
+            s2.atLeast (d.size());
+
+            invokeVectorOperation (d.size(), [&] { op (d.data(), s1.data(), s2.data(), d.size()); });
+        });
+    };
+}
+
+template <class Op>
+auto makeVectorReduction (Op op)
+{
+    return [op](py::buffer src) -> py::object
+    {
+        return withVectorValueType (src, [&](auto type) -> py::object
+        {
+            using T = decltype (type);
+
+            VectorOperand<T> s (src, false);
+            decltype (op (s.data(), s.size())) result;
+
+            invokeVectorOperation (s.size(), [&] { result = op (s.data(), s.size()); });
+
+            return py::cast (result);
+        });
+    };
+}
+
+// ============================================================================================
+
+/** Exposes the protected members of Synthesiser and SynthesiserVoice that python subclasses rely on. */
+struct SynthesiserPublicist : Synthesiser
+{
+    using Synthesiser::findFreeVoice;
+    using Synthesiser::findVoiceToSteal;
+    using Synthesiser::startVoice;
+};
+
+struct SynthesiserVoicePublicist : SynthesiserVoice
+{
+    using SynthesiserVoice::clearCurrentNote;
+};
+
+// ============================================================================================
+
+void resampleChannels (ResamplingInterpolator type, const float* const* input, int numChannels, int numInputSamples,
+                       float* const* output, int numOutputSamples, double ratio, ThreadPool* pool)
+{
+    static constexpr int64 minSamplesForTemporaryPool = 1 << 16;
+
+    std::unique_ptr<ThreadPool> temporaryPool;
+    if (pool == nullptr && numChannels > 1 && static_cast<int64> (numInputSamples) * numChannels >= minSamplesForTemporaryPool)
+    {
+        const auto numThreads = jmin (numChannels - 1, SystemStats::getNumCpus());
+        if (numThreads > 0)
+        {
+            temporaryPool = std::make_unique<ThreadPool> (ThreadPoolOptions{}.withThreadName ("Resampling").withNumberOfThreads (numThreads));
+            pool = temporaryPool.get();
+        }
+    }
+
+    forEachChannel (numChannels, pool, [&](int channel)
+    {
+        resampleChannel (type, input[channel], numInputSamples, output[channel], numOutputSamples, ratio);
+    });
+}
+
+// ============================================================================================
+
 void registerJuceAudioBasicsBindings (py::module_& m)
 {
     // ============================================================================================ juce::FloatArrayView
@@ -313,6 +1140,100 @@ void registerJuceAudioBasicsBindings (py::module_& m)
         })
     ;
 
+    // ============================================================================================ juce::FloatVectorOperations
+
+    py::class_<FloatVectorOperations> classFloatVectorOperations (m, "FloatVectorOperations");
+
+    classFloatVectorOperations
+        .def_static ("clear", makeVectorOperation ([](auto* dest, int num) { FloatVectorOperations::clear (dest, num); }),
+            "dest"_a)
+        .def_static ("fill", makeVectorScalarOperation ([](auto* dest, auto valueToFill, int num) { FloatVectorOperations::fill (dest, valueToFill, num); }),
+            "dest"_a, "valueToFill"_a)
+        .def_static ("copy", makeVectorVectorOperation ([](auto* dest, auto* src, int num) { FloatVectorOperations::copy (dest, src, num); }),
+            "dest"_a, "src"_a)
+        .def_static ("copyWithMultiply", makeVectorVectorScalarOperation ([](auto* dest, auto* src, auto multiplier, int num) { FloatVectorOperations::copyWithMultiply (dest, src, multiplier, num); }),
+            "dest"_a, "src"_a, "multiplier"_a)
+        .def_static ("add", makeVectorScalarOperation ([](auto* dest, auto amountToAdd, int num) { FloatVectorOperations::add (dest, amountToAdd, num); }),
+            "dest"_a, "amountToAdd"_a)
+        .def_static ("add", makeVectorVectorOperation ([](auto* dest, auto* src, int num) { FloatVectorOperations::add (dest, src, num); }),
+            "dest"_a, "src"_a)
+        .def_static ("add", makeVectorVectorScalarOperation ([](auto* dest, auto* src, auto amount, int num) { FloatVectorOperations::add (dest, src, amount, num); }),
+            "dest"_a, "src"_a, "amount"_a)
+        .def_static ("add", makeVectorVectorVectorOperation ([](auto* dest, auto* src1, auto* src2, int num) { FloatVectorOperations::add (dest, src1, src2, num); }),
+            "dest"_a, "src1"_a, "src2"_a)
+        .def_static ("subtract", makeVectorVectorOperation ([](auto* dest, auto* src, int num) { FloatVectorOperations::subtract (dest, src, num); }),
+            "dest"_a, "src"_a)
+        .def_static ("subtract", makeVectorVectorVectorOperation ([](auto* dest, auto* src1, auto* src2, int num) { FloatVectorOperations::subtract (dest, src1, src2, num); }),
+            "dest"_a, "src1"_a, "src2"_a)
+        .def_static ("addWithMultiply", makeVectorVectorScalarOperation ([](auto* dest, auto* src, auto multiplier, int num) { FloatVectorOperations::addWithMultiply (dest, src, multiplier, num); }),
+            "dest"_a, "src"_a, "multiplier"_a)
+        .def_static ("addWithMultiply", makeVectorVectorVectorOperation ([](auto* dest, auto* src1, auto* src2, int num) { FloatVectorOperations::addWithMultiply (dest, src1, src2, num); }),
+            "dest"_a, "src1"_a, "src2"_a)
+        .def_static ("subtractWithMultiply", makeVectorVectorScalarOperation ([](auto* dest, auto* src, auto multiplier, int num) { FloatVectorOperations::subtractWithMultiply (dest, src, multiplier, num); }),
+            "dest"_a, "src"_a, "multiplier"_a)
+        .def_static ("subtractWithMultiply", makeVectorVectorVectorOperation ([](auto* dest, auto* src1, auto* src2, int num) { FloatVectorOperations::subtractWithMultiply (dest, src1, src2, num); }),
+            "dest"_a, "src1"_a, "src2"_a)
+        .def_static ("multiply", makeVectorScalarOperation ([](auto* dest, auto multiplier, int num) { FloatVectorOperations::multiply (dest, multiplier, num); }),
+            "dest"_a, "multiplier"_a)
+        .def_static ("multiply", makeVectorVectorOperation ([](auto* dest, auto* src, int num) { FloatVectorOperations::multiply (dest, src, num); }),
+            "dest"_a, "src"_a)
+        .def_static ("multiply", makeVectorVectorScalarOperation ([](auto* dest, auto* src, auto multiplier, int num) { FloatVectorOperations::multiply (dest, src, multiplier, num); }),
+            "dest"_a, "src"_a, "multiplier"_a)
+        .def_static ("multiply", makeVectorVectorVectorOperation ([](auto* dest, auto* src1, auto* src2, int num) { FloatVectorOperations::multiply (dest, src1, src2, num); }),
+            "dest"_a, "src1"_a, "src2"_a)
+        .def_static ("negate", makeVectorVectorOperation ([](auto* dest, auto* src, int num) { FloatVectorOperations::negate (dest, src, num); }),
+            "dest"_a, "src"_a)
+        .def_static ("abs", makeVectorVectorOperation ([](auto* dest, auto* src, int num) { FloatVectorOperations::abs (dest, src, num); }),
+            "dest"_a, "src"_a)
+        .def_static ("min", makeVectorVectorScalarOperation ([](auto* dest, auto* src, auto comp, int num) { FloatVectorOperations::min (dest, src, comp, num); }),
+            "dest"_a, "src"_a, "comp"_a)
+        .def_static ("min", makeVectorVectorVectorOperation ([](auto* dest, auto* src1, auto* src2, int num) { FloatVectorOperations::min (dest, src1, src2, num); }),
+            "dest"_a, "src1"_a, "src2"_a)
+        .def_static ("max", makeVectorVectorScalarOperation ([](auto* dest, auto* src, auto comp, int num) { FloatVectorOperations::max (dest, src, comp, num); }),
+            "dest"_a, "src"_a, "comp"_a)
+        .def_static ("max", makeVectorVectorVectorOperation ([](auto* dest, auto* src1, auto* src2, int num) { FloatVectorOperations::max (dest, src1, src2, num); }),
+            "dest"_a, "src1"_a, "src2"_a)
+        .def_static ("clip", [](py::buffer dest, py::buffer src, double low, double high)
+        {
+            withVectorValueType (dest, [&](auto type)
+            {
+                using T = decltype (type);
+
+                VectorOperand<T> d (dest, true);
+                VectorOperand<T> s (src, false);
+                s.atLeast (d.size());
+
+                invokeVectorOperation (d.size(), [&] { FloatVectorOperations::clip (d.data(), s.data(), static_cast<T> (low), static_cast<T> (high), d.size()); });
+            });
+        }, "dest"_a, "src"_a, "low"_a, "high"_a)
+        .def_static ("findMinAndMax", makeVectorReduction ([](auto* src, int num)
+        {
+            const auto range = FloatVectorOperations::findMinAndMax (src, num);
+            return std::make_pair (range.getStart(), range.getEnd());
+        }), "src"_a)
+        .def_static ("findMinimum", makeVectorReduction ([](auto* src, int num) { return FloatVectorOperations::findMinimum (src, num); }),
+            "src"_a)
+        .def_static ("findMaximum", makeVectorReduction ([](auto* src, int num) { return FloatVectorOperations::findMaximum (src, num); }),
+            "src"_a)
+        .def_static ("convertFixedToFloat", [](py::buffer dest, py::buffer src, float multiplier)
+        {
+            VectorOperand<float> d (dest, true);
+            VectorOperand<int> s (src, false);
+            s.atLeast (d.size());
+
+            invokeVectorOperation (d.size(), [&] { FloatVectorOperations::convertFixedToFloat (d.data(), s.data(), multiplier, d.size()); });
+        }, "dest"_a, "src"_a, "multiplier"_a)
+        .def_static ("enableFlushToZeroMode", &FloatVectorOperations::enableFlushToZeroMode, "shouldEnable"_a)
+        .def_static ("isFlushToZeroModeEnabled", &FloatVectorOperations::isFlushToZeroModeEnabled)
+        .def_static ("disableDenormalisedNumberSupport", &FloatVectorOperations::disableDenormalisedNumberSupport, "shouldDisable"_a = true)
+        .def_static ("areDenormalsDisabled", &FloatVectorOperations::areDenormalsDisabled)
+    ;
+
+    // ============================================================================================ juce::FloatChannelsView
+
+    registerAudioChannelsView<const float> (m, "ConstFloatChannelsView");
+    registerAudioChannelsView<float> (m, "FloatChannelsView");
+
     // ============================================================================================ juce::AudioBuffer
 
     registerAudioBuffer<AudioBuffer, float, double>(m);
@@ -432,95 +1353,875 @@ void registerJuceAudioBasicsBindings (py::module_& m)
         .value ("discreteChannel0", AudioChannelSet::ChannelType::discreteChannel0)
         .export_values();
 
-    classAudioChannelSet
+    classAudioChannelSet
+        .def (py::init<>())
+        .def_static ("disabled", &AudioChannelSet::disabled)
+        .def_static ("mono", &AudioChannelSet::mono)
+        .def_static ("stereo", &AudioChannelSet::stereo)
+        .def_static ("createLCR", &AudioChannelSet::createLCR)
+        .def_static ("createLRS", &AudioChannelSet::createLRS)
+        .def_static ("createLCRS", &AudioChannelSet::createLCRS)
+        .def_static ("create5point0", &AudioChannelSet::create5point0)
+        .def_static ("create5point1", &AudioChannelSet::create5point1)
+        .def_static ("create6point0", &AudioChannelSet::create6point0)
+        .def_static ("create6point1", &AudioChannelSet::create6point1)
+        .def_static ("create6point0Music", &AudioChannelSet::create6point0Music)
+        .def_static ("create6point1Music", &AudioChannelSet::create6point1Music)
+        .def_static ("create7point0", &AudioChannelSet::create7point0)
+        .def_static ("create7point0SDDS", &AudioChannelSet::create7point0SDDS)
+        .def_static ("create7point1", &AudioChannelSet::create7point1)
+        .def_static ("create7point1SDDS", &AudioChannelSet::create7point1SDDS)
+        .def_static ("create5point0point2", &AudioChannelSet::create5point0point2)
+        .def_static ("create5point1point2", &AudioChannelSet::create5point1point2)
+        .def_static ("create5point0point4", &AudioChannelSet::create5point0point4)
+        .def_static ("create5point1point4", &AudioChannelSet::create5point1point4)
+        .def_static ("create7point0point2", &AudioChannelSet::create7point0point2)
+        .def_static ("create7point1point2", &AudioChannelSet::create7point1point2)
+        .def_static ("create7point0point4", &AudioChannelSet::create7point0point4)
+        .def_static ("create7point1point4", &AudioChannelSet::create7point1point4)
+        .def_static ("create7point0point6", &AudioChannelSet::create7point0point6)
+        .def_static ("create7point1point6", &AudioChannelSet::create7point1point6)
+        .def_static ("create9point0point4", &AudioChannelSet::create9point0point4)
+        .def_static ("create9point1point4", &AudioChannelSet::create9point1point4)
+        .def_static ("create9point0point6", &AudioChannelSet::create9point0point6)
+        .def_static ("create9point1point6", &AudioChannelSet::create9point1point6)
+        .def_static ("quadraphonic", &AudioChannelSet::quadraphonic)
+        .def_static ("pentagonal", &AudioChannelSet::pentagonal)
+        .def_static ("hexagonal", &AudioChannelSet::hexagonal)
+        .def_static ("octagonal", &AudioChannelSet::octagonal)
+        .def_static ("ambisonic", &AudioChannelSet::ambisonic, "order"_a = 1)
+        .def ("getAmbisonicOrder", &AudioChannelSet::getAmbisonicOrder)
+        .def_static ("discreteChannels", &AudioChannelSet::discreteChannels)
+        .def_static ("canonicalChannelSet", &AudioChannelSet::canonicalChannelSet)
+        .def_static ("namedChannelSet", &AudioChannelSet::namedChannelSet)
+        .def_static ("channelSetsWithNumberOfChannels", &AudioChannelSet::channelSetsWithNumberOfChannels)
+        .def_static ("getChannelTypeName", &AudioChannelSet::getChannelTypeName)
+        .def_static ("getAbbreviatedChannelTypeName", &AudioChannelSet::getAbbreviatedChannelTypeName)
+        .def_static ("getChannelTypeFromAbbreviation", &AudioChannelSet::getChannelTypeFromAbbreviation)
+        .def ("addChannel", &AudioChannelSet::addChannel)
+        .def ("removeChannel", &AudioChannelSet::removeChannel)
+        .def ("size", &AudioChannelSet::size)
+        .def ("isDisabled", &AudioChannelSet::isDisabled)
+        .def ("getChannelTypes", &AudioChannelSet::getChannelTypes)
+        .def ("getTypeOfChannel", &AudioChannelSet::getTypeOfChannel)
+        .def ("getChannelIndexForType", &AudioChannelSet::getChannelIndexForType)
+        .def ("getSpeakerArrangementAsString", &AudioChannelSet::getSpeakerArrangementAsString)
+        .def_static ("fromAbbreviatedString", &AudioChannelSet::fromAbbreviatedString)
+        .def ("getDescription", &AudioChannelSet::getDescription)
+        .def ("isDiscreteLayout", &AudioChannelSet::isDiscreteLayout)
+        .def ("intersect", &AudioChannelSet::intersect)
+        .def_static ("channelSetWithChannels", &AudioChannelSet::channelSetWithChannels)
+        .def_static ("fromWaveChannelMask", &AudioChannelSet::fromWaveChannelMask)
+        .def ("getWaveChannelMask", &AudioChannelSet::getWaveChannelMask)
+        .def_static ("getAmbisonicOrderForNumChannels", &AudioChannelSet::getAmbisonicOrderForNumChannels)
+        .def (py::self == py::self)
+        .def (py::self != py::self)
+        .def (py::self < py::self)
+    ;
+
+    classAudioChannelSet.attr ("maxChannelsOfNamedLayout") = py::int_ (static_cast<int> (AudioChannelSet::maxChannelsOfNamedLayout));
+
+    // ============================================================================================ juce::AudioProcessLoadMeasurer
+
+    py::class_<AudioProcessLoadMeasurer> classAudioProcessLoadMeasurer (m, "AudioProcessLoadMeasurer");
+
+    py::class_<AudioProcessLoadMeasurer::ScopedTimer> classAudioProcessLoadMeasurerScopedTimer (classAudioProcessLoadMeasurer, "ScopedTimer");
+
+    classAudioProcessLoadMeasurerScopedTimer
+        .def (py::init<AudioProcessLoadMeasurer&>())
+        .def (py::init<AudioProcessLoadMeasurer&, int>())
+        // TODO __enter__ __exit__
+    ;
+
+    classAudioProcessLoadMeasurer
+        .def (py::init<>())
+        .def ("reset", py::overload_cast<> (&AudioProcessLoadMeasurer::reset))
+        .def ("reset", py::overload_cast<double, int> (&AudioProcessLoadMeasurer::reset))
+        .def ("getLoadAsProportion", &AudioProcessLoadMeasurer::getLoadAsProportion)
+        .def ("getLoadAsPercentage", &AudioProcessLoadMeasurer::getLoadAsPercentage)
+        .def ("getXRunCount", &AudioProcessLoadMeasurer::getXRunCount)
+        .def ("registerBlockRenderTime", &AudioProcessLoadMeasurer::registerBlockRenderTime)
+        .def ("registerRenderTime", &AudioProcessLoadMeasurer::registerRenderTime)
+    ;
+
+    // ============================================================================================ juce::ParameterBlock
+
+    py::class_<PyParameterBlock> classParameterBlock (m, "ParameterBlock");
+
+    classParameterBlock
+        .def (py::init ([](py::object parameters)
+        {
+            StringArray names;
+            Array<float> defaultValues;
+
+            if (py::isinstance<py::dict> (parameters))
+            {
+                for (auto [name, defaultValue] : parameters.cast<py::dict>())
+                {
+                    names.add (name.cast<String>());
+                    defaultValues.add (defaultValue.cast<float>());
+                }
+            }
+            else
+            {
+                for (auto name : parameters)
+                    names.add (name.cast<String>());
+            }
+
+            for (const auto& name : names)
+            {
+                if (name.isEmpty() || names.indexOf (name) != names.lastIndexOf (name))
+                    throw py::value_error (("Invalid or duplicated parameter name \"" + name + "\"").toStdString());
+            }
+
+            return new PyParameterBlock (names, defaultValues);
+        }), "parameters"_a)
+        .def ("getNumParameters", &PyParameterBlock::getNumParameters)
+        .def ("getParameterNames", &PyParameterBlock::getParameterNames)
+        .def ("getParameterIndex", [](const PyParameterBlock& self, const String& name) { return self.getParameterIndex (name); }, "name"_a)
+        .def ("setValue", [](PyParameterBlock& self, py::handle key, float newValue)
+        {
+            self.setValue (getParameterBlockIndex (self, key), newValue);
+        }, "parameter"_a, "newValue"_a)
+        .def ("getValue", [](const PyParameterBlock& self, py::handle key)
+        {
+            return self.getValue (getParameterBlockIndex (self, key));
+        }, "parameter"_a)
+        .def ("setValues", [](PyParameterBlock& self, py::dict values)
+        {
+            for (auto [key, newValue] : values)
+                self.setValue (getParameterBlockIndex (self, key), newValue.cast<float>());
+        }, "values"_a)
+        .def ("getValues", [](const PyParameterBlock& self)
+        {
+            py::dict result;
+
+            for (int index = 0; index < self.getNumParameters(); ++index)
+                result[py::cast (self.getParameterNames()[index])] = self.getValue (index);
+
+            return result;
+        })
+        .def ("setSmoothingTime", [](PyParameterBlock& self, py::handle key, double seconds)
+        {
+            if (key.is_none())
+            {
+                for (int index = 0; index < self.getNumParameters(); ++index)
+                    self.setSmoothingTime (index, seconds);
+            }
+            else
+            {
+                self.setSmoothingTime (getParameterBlockIndex (self, key), seconds);
+            }
+        }, "parameter"_a, "seconds"_a)
+        .def ("getSmoothingTime", [](const PyParameterBlock& self, py::handle key)
+        {
+            return self.getSmoothingTime (getParameterBlockIndex (self, key));
+        }, "parameter"_a)
+        .def ("prepare", &PyParameterBlock::prepare, "sampleRate"_a)
+        .def ("getSampleRate", &PyParameterBlock::getSampleRate)
+        .def ("getNextValue", [](PyParameterBlock& self, py::handle key)
+        {
+            return self.getNextValue (getParameterBlockIndex (self, key));
+        }, "parameter"_a)
+        .def ("skip", [](PyParameterBlock& self, py::handle key, int numSamples)
+        {
+            return self.skip (getParameterBlockIndex (self, key), numSamples);
+        }, "parameter"_a, "numSamples"_a)
+        .def ("isSmoothing", [](PyParameterBlock& self, py::handle key)
+        {
+            return self.isSmoothing (getParameterBlockIndex (self, key));
+        }, "parameter"_a)
+        .def ("fillSmoothedValues", [](PyParameterBlock& self, py::handle key, py::buffer destination, int numSamples)
+        {
+            const auto index = getParameterBlockIndex (self, key);
+            const auto info = destination.request (true);
+
+            if (info.format != py::format_descriptor<float>::format() || info.ndim != 1 || info.strides[0] != static_cast<py::ssize_t> (sizeof (float)))
+                throw py::value_error ("Destination must be a contiguous 1D float32 buffer");
+
+            if (numSamples < 0)
+                numSamples = static_cast<int> (info.shape[0]);
+            else if (numSamples > info.shape[0])
+                throw py::value_error ("Destination is shorter than the requested number of samples");
+
+            self.fillSmoothedValues (index, static_cast<float*> (info.ptr), numSamples);
+        }, "parameter"_a, "destination"_a, "numSamples"_a = -1)
+        .def_property_readonly ("address", [](const PyParameterBlock& self)
+        {
+            return reinterpret_cast<std::uintptr_t> (std::addressof (self));
+        })
+        .def_property_readonly ("valuesAddress", [](const PyParameterBlock& self)
+        {
+            return reinterpret_cast<std::uintptr_t> (self.getValuesAddress());
+        })
+        .def_property_readonly_static ("getValueFunction", [](py::object)
+        {
+            return reinterpret_cast<std::uintptr_t> (static_cast<PyParameterBlock::GetValueFunction> (&PyParameterBlock::getValueCallback));
+        })
+        .def_property_readonly_static ("getNextValueFunction", [](py::object)
+        {
+            return reinterpret_cast<std::uintptr_t> (static_cast<PyParameterBlock::GetValueFunction> (&PyParameterBlock::getNextValueCallback));
+        })
+        .def_property_readonly_static ("fillSmoothedValuesFunction", [](py::object)
+        {
+            return reinterpret_cast<std::uintptr_t> (static_cast<PyParameterBlock::FillSmoothedValuesFunction> (&PyParameterBlock::fillSmoothedValuesCallback));
+        })
+        .def ("__len__", &PyParameterBlock::getNumParameters)
+        .def ("__contains__", [](const PyParameterBlock& self, const String& name) { return self.getParameterIndex (name) >= 0; })
+        .def ("__getitem__", [](const PyParameterBlock& self, py::handle key)
+        {
+            return self.getValue (getParameterBlockIndex (self, key));
+        })
+        .def ("__setitem__", [](PyParameterBlock& self, py::handle key, float newValue)
+        {
+            self.setValue (getParameterBlockIndex (self, key), newValue);
+        })
+    ;
+
+    // ============================================================================================ juce::AudioFifo
+
+    py::class_<PyAudioFifo> classAudioFifo (m, "AudioFifo");
+
+    classAudioFifo
+        .def (py::init ([](int numChannels, int capacity)
+        {
+            if (numChannels < 0 || capacity <= 0)
+                throw py::value_error ("Invalid number of channels or capacity");
+
+            return new PyAudioFifo (numChannels, capacity);
+        }), "numChannels"_a, "capacity"_a)
+        .def ("getNumChannels", &PyAudioFifo::getNumChannels)
+        .def ("getCapacity", &PyAudioFifo::getCapacity)
+        .def ("getNumReady", &PyAudioFifo::getNumReady)
+        .def ("getFreeSpace", &PyAudioFifo::getFreeSpace)
+        .def ("reset", &PyAudioFifo::reset)
+        .def ("push", [](PyAudioFifo& self, py::object data)
+        {
+            PyChannelPointers<const float> channels (data);
+            return self.push (channels.data(), channels.getNumChannels(), channels.getNumSamples());
+        }, "data"_a)
+        .def ("popInto", [](PyAudioFifo& self, py::object data)
+        {
+            PyChannelPointers<float> channels (data);
+            return self.pop (channels.data(), channels.getNumChannels(), channels.getNumSamples());
+        }, "data"_a)
+        .def ("popAll", [](PyAudioFifo& self)
+        {
+            const auto numChannels = self.getNumChannels();
+            const auto numSamples = self.getNumReady();
+
+            py::array_t<float> result ({ static_cast<py::ssize_t> (numChannels), static_cast<py::ssize_t> (numSamples) });
+
+            std::vector<float*> channels;
+            for (int channel = 0; channel < numChannels; ++channel)
+                channels.push_back (result.mutable_data() + static_cast<size_t> (channel) * static_cast<size_t> (numSamples));
+
+            const auto numRead = self.pop (channels.data(), numChannels, numSamples);
+            jassertquiet (numRead == numSamples);
+
+            return result;
+        })
+        .def_property_readonly ("address", [](const PyAudioFifo& self)
+        {
+            return reinterpret_cast<std::uintptr_t> (std::addressof (self));
+        })
+        .def_property_readonly_static ("pushFunction", [](py::object)
+        {
+            return reinterpret_cast<std::uintptr_t> (static_cast<PyAudioFifo::PushFunction> (&PyAudioFifo::pushCallback));
+        })
+        .def_property_readonly_static ("popFunction", [](py::object)
+        {
+            return reinterpret_cast<std::uintptr_t> (static_cast<PyAudioFifo::PopFunction> (&PyAudioFifo::popCallback));
+        })
+        .def ("__len__", &PyAudioFifo::getNumReady)
+    ;
+
+    // ============================================================================================ juce::RecordFifo
+
+    py::class_<TypedRecordFifo> classRecordFifo (m, "RecordFifo");
+
+    classRecordFifo
+        .def (py::init ([](int capacity, py::object recordShape, py::object dtype)
+        {
+            if (capacity <= 0)
+                throw py::value_error ("Invalid capacity");
+
+            std::vector<py::ssize_t> shape;
+
+            if (py::isinstance<py::int_> (recordShape))
+            {
+                shape.push_back (recordShape.cast<py::ssize_t>());
+            }
+            else
+            {
+                for (auto dimension : recordShape)
+                    shape.push_back (dimension.cast<py::ssize_t>());
+            }
+
+            return new TypedRecordFifo (capacity, std::move (shape), py::dtype::from_args (dtype));
+        }), "capacity"_a, "recordShape"_a, "dtype"_a = "float32")
+        .def ("getCapacity", &TypedRecordFifo::getCapacity)
+        .def ("getRecordSize", &TypedRecordFifo::getRecordSize)
+        .def ("getRecordShape", [](const TypedRecordFifo& self)
+        {
+            const auto& shape = self.getRecordShape();
+
+            py::tuple result (shape.size());
+            for (size_t i = 0; i < shape.size(); ++i)
+                result[i] = shape[i];
+
+            return result;
+        })
+        .def ("getRecordType", &TypedRecordFifo::getRecordType)
+        .def ("getNumReady", &TypedRecordFifo::getNumReady)
+        .def ("getFreeSpace", &TypedRecordFifo::getFreeSpace)
+        .def ("reset", &TypedRecordFifo::reset)
+        .def ("push", [](TypedRecordFifo& self, py::object records)
+        {
+            auto array = self.asRecords (records);
+
+            return self.push (array.data(), self.getNumRecordsIn (array));
+        }, "records"_a)
+        .def ("popInto", [](TypedRecordFifo& self, py::array records)
+        {
+            if (! (records.flags() & py::array::c_style))
+                throw py::value_error ("Records destination must be contiguous in memory");
+
+            return self.pop (records.mutable_data(), self.getNumRecordsIn (records));
+        }, "records"_a)
+        .def ("popAll", [](TypedRecordFifo& self)
+        {
+            std::vector<py::ssize_t> shape { static_cast<py::ssize_t> (self.getNumReady()) };
+            shape.insert (shape.end(), self.getRecordShape().begin(), self.getRecordShape().end());
+
+            py::array result (self.getRecordType(), shape);
+
+            const auto numRead = self.pop (result.mutable_data(), static_cast<int> (shape.front()));
+            jassertquiet (numRead == shape.front());
+
+            return result;
+        })
+        .def_property_readonly ("address", [](const TypedRecordFifo& self)
+        {
+            return reinterpret_cast<std::uintptr_t> (static_cast<const PyRecordFifo*> (std::addressof (self)));
+        })
+        .def_property_readonly_static ("pushFunction", [](py::object)
+        {
+            return reinterpret_cast<std::uintptr_t> (static_cast<PyRecordFifo::PushFunction> (&PyRecordFifo::pushCallback));
+        })
+        .def_property_readonly_static ("popFunction", [](py::object)
+        {
+            return reinterpret_cast<std::uintptr_t> (static_cast<PyRecordFifo::PopFunction> (&PyRecordFifo::popCallback));
+        })
+        .def ("__len__", &TypedRecordFifo::getNumReady)
+    ;
+
+    // ============================================================================================ juce::MidiMessage
+
+    m.def ("getMidiEventDtype", []
+    {
+        registerMidiEventRecordDtype();
+        return py::dtype::of<MidiEventRecord>();
+    });
+
+    py::class_<MidiMessage> classMidiMessage (m, "MidiMessage");
+
+    classMidiMessage
+        .def (py::init<>())
+        .def (py::init<int, double>(), "byte1"_a, "timeStamp"_a = 0.0)
+        .def (py::init<int, int, double>(), "byte1"_a, "byte2"_a, "timeStamp"_a = 0.0)
+        .def (py::init<int, int, int, double>(), "byte1"_a, "byte2"_a, "byte3"_a, "timeStamp"_a = 0.0)
+        .def (py::init ([](py::buffer data, double timeStamp)
+        {
+            const auto info = data.request();
+            return new MidiMessage (info.ptr, static_cast<int> (info.size * info.itemsize), timeStamp);
+        }), "data"_a, "timeStamp"_a = 0.0)
+        .def (py::init<const MidiMessage&>())
+        .def (py::init<const MidiMessage&, double>(), "other"_a, "newTimeStamp"_a)
+        .def ("getRawData", [](const MidiMessage& self)
+        {
+            return py::bytes (reinterpret_cast<const char*> (self.getRawData()), static_cast<size_t> (self.getRawDataSize()));
+        })
+        .def ("getRawDataSize", &MidiMessage::getRawDataSize)
+        .def ("getDescription", &MidiMessage::getDescription)
+        .def ("getTimeStamp", &MidiMessage::getTimeStamp)
+        .def ("setTimeStamp", &MidiMessage::setTimeStamp, "newTimestamp"_a)
+        .def ("addToTimeStamp", &MidiMessage::addToTimeStamp, "delta"_a)
+        .def ("withTimeStamp", &MidiMessage::withTimeStamp, "newTimestamp"_a)
+        .def ("getChannel", &MidiMessage::getChannel)
+        .def ("isForChannel", &MidiMessage::isForChannel, "channelNumber"_a)
+        .def ("setChannel", &MidiMessage::setChannel, "newChannelNumber"_a)
+        .def ("isSysEx", &MidiMessage::isSysEx)
+        .def ("getSysExData", [](const MidiMessage& self)
+        {
+            return py::bytes (reinterpret_cast<const char*> (self.getSysExData()), static_cast<size_t> (self.getSysExDataSize()));
+        })
+        .def ("getSysExDataSize", &MidiMessage::getSysExDataSize)
+        .def ("isNoteOnOrOff", &MidiMessage::isNoteOnOrOff)
+        .def ("isNoteOn", &MidiMessage::isNoteOn, "returnTrueForVelocity0"_a = false)
+        .def ("isNoteOff", &MidiMessage::isNoteOff, "returnTrueForNoteOnVelocity0"_a = true)
+        .def ("getNoteNumber", &MidiMessage::getNoteNumber)
+        .def ("setNoteNumber", &MidiMessage::setNoteNumber, "newNoteNumber"_a)
+        .def ("getVelocity", &MidiMessage::getVelocity)
+        .def ("getFloatVelocity", &MidiMessage::getFloatVelocity)
+        .def ("setVelocity", &MidiMessage::setVelocity, "newVelocity"_a)
+        .def ("multiplyVelocity", &MidiMessage::multiplyVelocity, "scaleFactor"_a)
+        .def ("isSustainPedalOn", &MidiMessage::isSustainPedalOn)
+        .def ("isSustainPedalOff", &MidiMessage::isSustainPedalOff)
+        .def ("isSostenutoPedalOn", &MidiMessage::isSostenutoPedalOn)
+        .def ("isSostenutoPedalOff", &MidiMessage::isSostenutoPedalOff)
+        .def ("isSoftPedalOn", &MidiMessage::isSoftPedalOn)
+        .def ("isSoftPedalOff", &MidiMessage::isSoftPedalOff)
+        .def ("isProgramChange", &MidiMessage::isProgramChange)
+        .def ("getProgramChangeNumber", &MidiMessage::getProgramChangeNumber)
+        .def ("isPitchWheel", &MidiMessage::isPitchWheel)
+        .def ("getPitchWheelValue", &MidiMessage::getPitchWheelValue)
+        .def ("isAftertouch", &MidiMessage::isAftertouch)
+        .def ("getAfterTouchValue", &MidiMessage::getAfterTouchValue)
+        .def ("isChannelPressure", &MidiMessage::isChannelPressure)
+        .def ("getChannelPressureValue", &MidiMessage::getChannelPressureValue)
+        .def ("isController", &MidiMessage::isController)
+        .def ("getControllerNumber", &MidiMessage::getControllerNumber)
+        .def ("getControllerValue", &MidiMessage::getControllerValue)
+        .def ("isControllerOfType", &MidiMessage::isControllerOfType, "controllerType"_a)
+        .def ("isAllNotesOff", &MidiMessage::isAllNotesOff)
+        .def ("isAllSoundOff", &MidiMessage::isAllSoundOff)
+        .def ("isResetAllControllers", &MidiMessage::isResetAllControllers)
+        .def ("isActiveSense", &MidiMessage::isActiveSense)
+        .def ("isMidiStart", &MidiMessage::isMidiStart)
+        .def ("isMidiContinue", &MidiMessage::isMidiContinue)
+        .def ("isMidiStop", &MidiMessage::isMidiStop)
+        .def ("isMidiClock", &MidiMessage::isMidiClock)
+        .def ("isSongPositionPointer", &MidiMessage::isSongPositionPointer)
+        .def ("getSongPositionPointerMidiBeat", &MidiMessage::getSongPositionPointerMidiBeat)
+        .def ("isQuarterFrame", &MidiMessage::isQuarterFrame)
+        .def ("getQuarterFrameSequenceNumber", &MidiMessage::getQuarterFrameSequenceNumber)
+        .def ("getQuarterFrameValue", &MidiMessage::getQuarterFrameValue)
+        .def ("isMetaEvent", &MidiMessage::isMetaEvent)
+        .def ("getMetaEventType", &MidiMessage::getMetaEventType)
+        .def ("getMetaEventData", [](const MidiMessage& self)
+        {
+            return py::bytes (reinterpret_cast<const char*> (self.getMetaEventData()), static_cast<size_t> (self.getMetaEventLength()));
+        })
+        .def ("getMetaEventLength", &MidiMessage::getMetaEventLength)
+        .def ("isTrackMetaEvent", &MidiMessage::isTrackMetaEvent)
+        .def ("isEndOfTrackMetaEvent", &MidiMessage::isEndOfTrackMetaEvent)
+        .def ("isTrackNameEvent", &MidiMessage::isTrackNameEvent)
+        .def ("isTextMetaEvent", &MidiMessage::isTextMetaEvent)
+        .def ("getTextFromTextMetaEvent", &MidiMessage::getTextFromTextMetaEvent)
+        .def ("isTempoMetaEvent", &MidiMessage::isTempoMetaEvent)
+        .def ("getTempoMetaEventTickLength", &MidiMessage::getTempoMetaEventTickLength, "timeFormat"_a)
+        .def ("getTempoSecondsPerQuarterNote", &MidiMessage::getTempoSecondsPerQuarterNote)
+        .def ("isTimeSignatureMetaEvent", &MidiMessage::isTimeSignatureMetaEvent)
+        .def ("getTimeSignatureInfo", [](const MidiMessage& self)
+        {
+            int numerator = 0, denominator = 0;
+            self.getTimeSignatureInfo (numerator, denominator);
+            return py::make_tuple (numerator, denominator);
+        })
+        .def ("isKeySignatureMetaEvent", &MidiMessage::isKeySignatureMetaEvent)
+        .def ("getKeySignatureNumberOfSharpsOrFlats", &MidiMessage::getKeySignatureNumberOfSharpsOrFlats)
+        .def ("isKeySignatureMajorKey", &MidiMessage::isKeySignatureMajorKey)
+        .def ("isMidiChannelMetaEvent", &MidiMessage::isMidiChannelMetaEvent)
+        .def ("getMidiChannelMetaEventChannel", &MidiMessage::getMidiChannelMetaEventChannel)
+        .def_static ("noteOn", py::overload_cast<int, int, uint8> (&MidiMessage::noteOn), "channel"_a, "noteNumber"_a, "velocity"_a)
+        .def_static ("noteOn", py::overload_cast<int, int, float> (&MidiMessage::noteOn), "channel"_a, "noteNumber"_a, "velocity"_a)
+        .def_static ("noteOff", py::overload_cast<int, int, uint8> (&MidiMessage::noteOff), "channel"_a, "noteNumber"_a, "velocity"_a)
+        .def_static ("noteOff", py::overload_cast<int, int, float> (&MidiMessage::noteOff), "channel"_a, "noteNumber"_a, "velocity"_a)
+        .def_static ("noteOff", py::overload_cast<int, int> (&MidiMessage::noteOff), "channel"_a, "noteNumber"_a)
+        .def_static ("aftertouchChange", &MidiMessage::aftertouchChange, "channel"_a, "noteNumber"_a, "aftertouchAmount"_a)
+        .def_static ("channelPressureChange", &MidiMessage::channelPressureChange, "channel"_a, "pressure"_a)
+        .def_static ("programChange", &MidiMessage::programChange, "channel"_a, "programNumber"_a)
+        .def_static ("pitchWheel", &MidiMessage::pitchWheel, "channel"_a, "position"_a)
+        .def_static ("controllerEvent", &MidiMessage::controllerEvent, "channel"_a, "controllerType"_a, "value"_a)
+        .def_static ("allNotesOff", &MidiMessage::allNotesOff, "channel"_a)
+        .def_static ("allSoundOff", &MidiMessage::allSoundOff, "channel"_a)
+        .def_static ("allControllersOff", &MidiMessage::allControllersOff, "channel"_a)
+        .def_static ("createSysExMessage", [](py::buffer data)
+        {
+            const auto info = data.request();
+            return MidiMessage::createSysExMessage (info.ptr, static_cast<int> (info.size * info.itemsize));
+        }, "sysexData"_a)
+        .def_static ("textMetaEvent", [](int type, const String& text) { return MidiMessage::textMetaEvent (type, text); }, "type"_a, "text"_a)
+        .def_static ("tempoMetaEvent", &MidiMessage::tempoMetaEvent, "microsecondsPerQuarterNote"_a)
+        .def_static ("timeSignatureMetaEvent", &MidiMessage::timeSignatureMetaEvent, "numerator"_a, "denominator"_a)
+        .def_static ("keySignatureMetaEvent", &MidiMessage::keySignatureMetaEvent, "numberOfSharpsOrFlats"_a, "isMinorKey"_a)
+        .def_static ("midiChannelMetaEvent", &MidiMessage::midiChannelMetaEvent, "channel"_a)
+        .def_static ("endOfTrack", &MidiMessage::endOfTrack)
+        .def_static ("midiStart", &MidiMessage::midiStart)
+        .def_static ("midiContinue", &MidiMessage::midiContinue)
+        .def_static ("midiStop", &MidiMessage::midiStop)
+        .def_static ("midiClock", &MidiMessage::midiClock)
+        .def_static ("songPositionPointer", &MidiMessage::songPositionPointer, "positionInMidiBeats"_a)
+        .def_static ("quarterFrame", &MidiMessage::quarterFrame, "sequenceNumber"_a, "value"_a)
+        .def_static ("getMessageLengthFromFirstByte", &MidiMessage::getMessageLengthFromFirstByte, "firstByte"_a)
+        .def_static ("getMidiNoteName", &MidiMessage::getMidiNoteName,
+            "noteNumber"_a, "useSharps"_a, "includeOctaveNumber"_a, "octaveNumForMiddleC"_a)
+        .def_static ("getMidiNoteInHertz", &MidiMessage::getMidiNoteInHertz, "noteNumber"_a, "frequencyOfA"_a = 440.0)
+        .def_static ("isMidiNoteBlack", &MidiMessage::isMidiNoteBlack, "noteNumber"_a)
+        .def_static ("getGMInstrumentName", [](int midiInstrumentNumber) { return String (MidiMessage::getGMInstrumentName (midiInstrumentNumber)); }, "midiInstrumentNumber"_a)
+        .def_static ("getGMInstrumentBankName", [](int midiBankNumber) { return String (MidiMessage::getGMInstrumentBankName (midiBankNumber)); }, "midiBankNumber"_a)
+        .def_static ("getRhythmInstrumentName", [](int midiNoteNumber) { return String (MidiMessage::getRhythmInstrumentName (midiNoteNumber)); }, "midiNoteNumber"_a)
+        .def_static ("getControllerName", [](int controllerNumber) { return String (MidiMessage::getControllerName (controllerNumber)); }, "controllerNumber"_a)
+        .def_static ("floatValueToMidiByte", &MidiMessage::floatValueToMidiByte, "valueBetween0and1"_a)
+        .def_static ("pitchbendToPitchwheelPos", &MidiMessage::pitchbendToPitchwheelPos, "pitchbendInSemitones"_a, "pitchbendRangeInSemitones"_a)
+        .def ("__repr__", [](const MidiMessage& self)
+        {
+            String result;
+            result << Helpers::pythonizeModuleClassName (PythonModuleName, typeid (self).name())
+                   << "('" << self.getDescription() << "', " << self.getTimeStamp() << ")";
+            return result;
+        })
+    ;
+
+    // ============================================================================================ juce::MidiBuffer
+
+    py::class_<MidiBuffer> classMidiBuffer (m, "MidiBuffer");
+
+    classMidiBuffer
         .def (py::init<>())
-        .def_static ("disabled", &AudioChannelSet::disabled)
-        .def_static ("mono", &AudioChannelSet::mono)
-        .def_static ("stereo", &AudioChannelSet::stereo)
-        .def_static ("createLCR", &AudioChannelSet::createLCR)
-        .def_static ("createLRS", &AudioChannelSet::createLRS)
-        .def_static ("createLCRS", &AudioChannelSet::createLCRS)
-        .def_static ("create5point0", &AudioChannelSet::create5point0)
-        .def_static ("create5point1", &AudioChannelSet::create5point1)
-        .def_static ("create6point0", &AudioChannelSet::create6point0)
-        .def_static ("create6point1", &AudioChannelSet::create6point1)
-        .def_static ("create6point0Music", &AudioChannelSet::create6point0Music)
-        .def_static ("create6point1Music", &AudioChannelSet::create6point1Music)
-        .def_static ("create7point0", &AudioChannelSet::create7point0)
-        .def_static ("create7point0SDDS", &AudioChannelSet::create7point0SDDS)
-        .def_static ("create7point1", &AudioChannelSet::create7point1)
-        .def_static ("create7point1SDDS", &AudioChannelSet::create7point1SDDS)
-        .def_static ("create5point0point2", &AudioChannelSet::create5point0point2)
-        .def_static ("create5point1point2", &AudioChannelSet::create5point1point2)
-        .def_static ("create5point0point4", &AudioChannelSet::create5point0point4)
-        .def_static ("create5point1point4", &AudioChannelSet::create5point1point4)
-        .def_static ("create7point0point2", &AudioChannelSet::create7point0point2)
-        .def_static ("create7point1point2", &AudioChannelSet::create7point1point2)
-        .def_static ("create7point0point4", &AudioChannelSet::create7point0point4)
-        .def_static ("create7point1point4", &AudioChannelSet::create7point1point4)
-        .def_static ("create7point0point6", &AudioChannelSet::create7point0point6)
-        .def_static ("create7point1point6", &AudioChannelSet::create7point1point6)
-        .def_static ("create9point0point4", &AudioChannelSet::create9point0point4)
-        .def_static ("create9point1point4", &AudioChannelSet::create9point1point4)
-        .def_static ("create9point0point6", &AudioChannelSet::create9point0point6)
-        .def_static ("create9point1point6", &AudioChannelSet::create9point1point6)
-        .def_static ("quadraphonic", &AudioChannelSet::quadraphonic)
-        .def_static ("pentagonal", &AudioChannelSet::pentagonal)
-        .def_static ("hexagonal", &AudioChannelSet::hexagonal)
-        .def_static ("octagonal", &AudioChannelSet::octagonal)
-        .def_static ("ambisonic", &AudioChannelSet::ambisonic, "order"_a = 1)
-        .def ("getAmbisonicOrder", &AudioChannelSet::getAmbisonicOrder)
-        .def_static ("discreteChannels", &AudioChannelSet::discreteChannels)
-        .def_static ("canonicalChannelSet", &AudioChannelSet::canonicalChannelSet)
-        .def_static ("namedChannelSet", &AudioChannelSet::namedChannelSet)
-        .def_static ("channelSetsWithNumberOfChannels", &AudioChannelSet::channelSetsWithNumberOfChannels)
-        .def_static ("getChannelTypeName", &AudioChannelSet::getChannelTypeName)
-        .def_static ("getAbbreviatedChannelTypeName", &AudioChannelSet::getAbbreviatedChannelTypeName)
-        .def_static ("getChannelTypeFromAbbreviation", &AudioChannelSet::getChannelTypeFromAbbreviation)
-        .def ("addChannel", &AudioChannelSet::addChannel)
-        .def ("removeChannel", &AudioChannelSet::removeChannel)
-        .def ("size", &AudioChannelSet::size)
-        .def ("isDisabled", &AudioChannelSet::isDisabled)
-        .def ("getChannelTypes", &AudioChannelSet::getChannelTypes)
-        .def ("getTypeOfChannel", &AudioChannelSet::getTypeOfChannel)
-        .def ("getChannelIndexForType", &AudioChannelSet::getChannelIndexForType)
-        .def ("getSpeakerArrangementAsString", &AudioChannelSet::getSpeakerArrangementAsString)
-        .def_static ("fromAbbreviatedString", &AudioChannelSet::fromAbbreviatedString)
-        .def ("getDescription", &AudioChannelSet::getDescription)
-        .def ("isDiscreteLayout", &AudioChannelSet::isDiscreteLayout)
-        .def ("intersect", &AudioChannelSet::intersect)
-        .def_static ("channelSetWithChannels", &AudioChannelSet::channelSetWithChannels)
-        .def_static ("fromWaveChannelMask", &AudioChannelSet::fromWaveChannelMask)
-        .def ("getWaveChannelMask", &AudioChannelSet::getWaveChannelMask)
-        .def_static ("getAmbisonicOrderForNumChannels", &AudioChannelSet::getAmbisonicOrderForNumChannels)
-        .def (py::self == py::self)
-        .def (py::self != py::self)
-        .def (py::self < py::self)
+        .def (py::init<const MidiMessage&>(), "message"_a)
+        .def (py::init<const MidiBuffer&>())
+        .def ("clear", py::overload_cast<> (&MidiBuffer::clear))
+        .def ("clear", py::overload_cast<int, int> (&MidiBuffer::clear), "start"_a, "numSamples"_a)
+        .def ("isEmpty", &MidiBuffer::isEmpty)
+        .def ("getNumEvents", &MidiBuffer::getNumEvents)
+        .def ("addEvent", py::overload_cast<const MidiMessage&, int> (&MidiBuffer::addEvent), "midiMessage"_a, "sampleNumber"_a)
+        .def ("addEvent", [](MidiBuffer& self, py::buffer data, int sampleNumber)
+        {
+            const auto info = data.request();
+            return self.addEvent (info.ptr, static_cast<int> (info.size * info.itemsize), sampleNumber);
+        }, "rawMidiData"_a, "sampleNumber"_a)
+        .def ("addEvents", &MidiBuffer::addEvents, "otherBuffer"_a, "startSample"_a, "numSamples"_a, "sampleDeltaToAdd"_a)
+        .def ("getFirstEventTime", &MidiBuffer::getFirstEventTime)
+        .def ("getLastEventTime", &MidiBuffer::getLastEventTime)
+        .def ("swapWith", &MidiBuffer::swapWith)
+        .def ("ensureSize", &MidiBuffer::ensureSize)
+        .def ("getMessages", [](const MidiBuffer& self)
+        {
+            py::list messages;
+
+            for (const auto metadata : self)
+                messages.append (metadata.getMessage());
+
+            return messages;
+        })
+        .def ("toArray", [](const MidiBuffer& self)
+        {
+            py::ssize_t numRecords = 0;
+            for (const auto metadata : self)
+                numRecords += isMidiEventRecordable (metadata.data, metadata.numBytes) ? 1 : 0;
+
+            auto result = makeMidiEventRecordArray (numRecords);
+            auto* records = result.mutable_data();
+
+            // The buffer is owned by python, so it's only read with the GIL held
+            for (const auto metadata : self)
+            {
+                if (isMidiEventRecordable (metadata.data, metadata.numBytes))
+                    *records++ = makeMidiEventRecord (metadata.data, metadata.numBytes, static_cast<double> (metadata.samplePosition));
+            }
+
+            return result;
+        })
+        .def ("addEventsFromArray", [](MidiBuffer& self, py::object records, int sampleDeltaToAdd)
+        {
+            // The records are converted into a local buffer without the GIL, then merged into the python owned one
+            MidiBuffer newEvents;
+
+            forEachMidiEventRecord (toMidiEventRecordArray (records), [&](const uint8* data, int numBytes, double timestamp)
+            {
+                newEvents.addEvent (data, numBytes, static_cast<int> (timestamp) + sampleDeltaToAdd);
+            });
+
+            if (self.isEmpty())
+                self.swapWith (newEvents);
+            else
+                self.addEvents (newEvents, 0, -1, 0);
+        }, "records"_a, "sampleDeltaToAdd"_a = 0)
+        .def_static ("fromArray", [](py::object records)
+        {
+            MidiBuffer result;
+
+            forEachMidiEventRecord (toMidiEventRecordArray (records), [&](const uint8* data, int numBytes, double timestamp)
+            {
+                result.addEvent (data, numBytes, static_cast<int> (timestamp));
+            });
+
+            return result;
+        }, "records"_a)
+        .def ("__len__", &MidiBuffer::getNumEvents)
+        .def ("__iter__", [](const MidiBuffer& self)
+        {
+            py::list events;
+
+            for (const auto metadata : self)
+                events.append (py::make_tuple (py::bytes (reinterpret_cast<const char*> (metadata.data), static_cast<size_t> (metadata.numBytes)), metadata.samplePosition));
+
+            return py::iter (events);
+        })
     ;
 
-    classAudioChannelSet.attr ("maxChannelsOfNamedLayout") = py::int_ (static_cast<int> (AudioChannelSet::maxChannelsOfNamedLayout));
+    // ============================================================================================ juce::MidiMessageSequence
 
-    // ============================================================================================ juce::AudioProcessLoadMeasurer
+    py::class_<MidiMessageSequence> classMidiMessageSequence (m, "MidiMessageSequence");
 
-    py::class_<AudioProcessLoadMeasurer> classAudioProcessLoadMeasurer (m, "AudioProcessLoadMeasurer");
+    py::class_<MidiMessageSequence::MidiEventHolder> classMidiMessageSequenceMidiEventHolder (classMidiMessageSequence, "MidiEventHolder");
 
-    py::class_<AudioProcessLoadMeasurer::ScopedTimer> classAudioProcessLoadMeasurerScopedTimer (classAudioProcessLoadMeasurer, "ScopedTimer");
+    classMidiMessageSequenceMidiEventHolder
+        .def_readwrite ("message", &MidiMessageSequence::MidiEventHolder::message)
+        .def_readonly ("noteOffObject", &MidiMessageSequence::MidiEventHolder::noteOffObject, py::return_value_policy::reference)
+    ;
 
-    classAudioProcessLoadMeasurerScopedTimer
-        .def (py::init<AudioProcessLoadMeasurer&>())
-        .def (py::init<AudioProcessLoadMeasurer&, int>())
-        // TODO __enter__ __exit__
+    classMidiMessageSequence
+        .def (py::init<>())
+        .def (py::init<const MidiMessageSequence&>())
+        .def ("clear", &MidiMessageSequence::clear)
+        .def ("getNumEvents", &MidiMessageSequence::getNumEvents)
+        .def ("getEventPointer", &MidiMessageSequence::getEventPointer, "index"_a, py::return_value_policy::reference_internal)
+        .def ("getTimeOfMatchingKeyUp", &MidiMessageSequence::getTimeOfMatchingKeyUp, "index"_a)
+        .def ("getIndexOfMatchingKeyUp", &MidiMessageSequence::getIndexOfMatchingKeyUp, "index"_a)
+        .def ("getIndexOf", &MidiMessageSequence::getIndexOf, "event"_a)
+        .def ("getNextIndexAtTime", &MidiMessageSequence::getNextIndexAtTime, "timeStamp"_a)
+        .def ("getStartTime", &MidiMessageSequence::getStartTime)
+        .def ("getEndTime", &MidiMessageSequence::getEndTime)
+        .def ("getEventTime", &MidiMessageSequence::getEventTime, "index"_a)
+        .def ("addEvent", py::overload_cast<const MidiMessage&, double> (&MidiMessageSequence::addEvent),
+            "newMessage"_a, "timeAdjustment"_a = 0.0, py::return_value_policy::reference_internal)
+        .def ("deleteEvent", &MidiMessageSequence::deleteEvent, "index"_a, "deleteMatchingNoteUp"_a)
+        .def ("addSequence", py::overload_cast<const MidiMessageSequence&, double> (&MidiMessageSequence::addSequence),
+            "other"_a, "timeAdjustmentDelta"_a)
+        .def ("addSequence", py::overload_cast<const MidiMessageSequence&, double, double, double> (&MidiMessageSequence::addSequence),
+            "other"_a, "timeAdjustmentDelta"_a, "firstAllowableDestTime"_a, "endOfAllowableDestTimes"_a)
+        .def ("updateMatchedPairs", &MidiMessageSequence::updateMatchedPairs)
+        .def ("sort", &MidiMessageSequence::sort)
+        .def ("extractMidiChannelMessages", &MidiMessageSequence::extractMidiChannelMessages,
+            "channelNumberToExtract"_a, "destSequence"_a, "alsoIncludeMetaEvents"_a)
+        .def ("extractSysExMessages", &MidiMessageSequence::extractSysExMessages, "destSequence"_a)
+        .def ("deleteMidiChannelMessages", &MidiMessageSequence::deleteMidiChannelMessages, "channelNumberToRemove"_a)
+        .def ("deleteSysExMessages", &MidiMessageSequence::deleteSysExMessages)
+        .def ("addTimeToMessages", &MidiMessageSequence::addTimeToMessages, "deltaTime"_a)
+        .def ("createControllerUpdatesForTime", [](const MidiMessageSequence& self, int channel, double time)
+        {
+            Array<MidiMessage> resultMessages;
+            self.createControllerUpdatesForTime (channel, time, resultMessages);
+
+            py::list result;
+            for (const auto& message : resultMessages)
+                result.append (message);
+
+            return result;
+        }, "channel"_a, "time"_a)
+        .def ("swapWith", &MidiMessageSequence::swapWith, "other"_a)
+        .def ("toArray", [](const MidiMessageSequence& self)
+        {
+            py::ssize_t numRecords = 0;
+            for (const auto* event : self)
+                numRecords += isMidiEventRecordable (event->message.getRawData(), event->message.getRawDataSize()) ? 1 : 0;
+
+            auto result = makeMidiEventRecordArray (numRecords);
+            auto* records = result.mutable_data();
+
+            // The sequence is owned by python, so it's only read with the GIL held
+            for (const auto* event : self)
+            {
+                const auto& message = event->message;
+
+                if (isMidiEventRecordable (message.getRawData(), message.getRawDataSize()))
+                    *records++ = makeMidiEventRecord (message.getRawData(), message.getRawDataSize(), message.getTimeStamp());
+            }
+
+            return result;
+        })
+        .def ("addEventsFromArray", [](MidiMessageSequence& self, py::object records, double timeAdjustment, bool updateMatchedPairs)
+        {
+            MidiMessageSequence newEvents;
+
+            forEachMidiEventRecord (toMidiEventRecordArray (records), [&](const uint8* data, int numBytes, double timestamp)
+            {
+                newEvents.addEvent (MidiMessage (data, numBytes, timestamp + timeAdjustment));
+            });
+
+            // The sequence is owned by python, so it's only modified with the GIL held
+            self.addSequence (newEvents, 0.0);
+
+            if (updateMatchedPairs)
+                self.updateMatchedPairs();
+        }, "records"_a, "timeAdjustment"_a = 0.0, "updateMatchedPairs"_a = true)
+        .def_static ("fromArray", [](py::object records)
+        {
+            MidiMessageSequence result;
+
+            forEachMidiEventRecord (toMidiEventRecordArray (records), [&](const uint8* data, int numBytes, double timestamp)
+            {
+                result.addEvent (MidiMessage (data, numBytes, timestamp));
+            });
+
+            py::gil_scoped_release release;
+            result.updateMatchedPairs();
+
+            return result;
+        }, "records"_a)
+        .def ("__len__", &MidiMessageSequence::getNumEvents)
+        .def ("__getitem__", [](MidiMessageSequence& self, int index)
+        {
+            if (index < 0)
+                index += self.getNumEvents();
+
+            if (! isPositiveAndBelow (index, self.getNumEvents()))
+                throw py::index_error ("Event index out of range");
+
+            return self.getEventPointer (index);
+        }, py::return_value_policy::reference_internal)
+        .def ("__iter__", [](MidiMessageSequence& self)
+        {
+            return py::make_iterator (self.begin(), self.end());
+        }, py::keep_alive<0, 1>())
     ;
 
-    classAudioProcessLoadMeasurer
+    // ============================================================================================ juce::MidiFile
+
+    py::class_<MidiFile> classMidiFile (m, "MidiFile");
+
+    classMidiFile
         .def (py::init<>())
-        .def ("reset", py::overload_cast<> (&AudioProcessLoadMeasurer::reset))
-        .def ("reset", py::overload_cast<double, int> (&AudioProcessLoadMeasurer::reset))
-        .def ("getLoadAsProportion", &AudioProcessLoadMeasurer::getLoadAsProportion)
-        .def ("getLoadAsPercentage", &AudioProcessLoadMeasurer::getLoadAsPercentage)
-        .def ("getXRunCount", &AudioProcessLoadMeasurer::getXRunCount)
-        .def ("registerBlockRenderTime", &AudioProcessLoadMeasurer::registerBlockRenderTime)
-        .def ("registerRenderTime", &AudioProcessLoadMeasurer::registerRenderTime)
+        .def (py::init<const MidiFile&>())
+        .def ("getNumTracks", &MidiFile::getNumTracks)
+        .def ("getTrack", &MidiFile::getTrack, "index"_a, py::return_value_policy::reference_internal)
+        .def ("addTrack", &MidiFile::addTrack, "trackSequence"_a)
+        .def ("clear", &MidiFile::clear)
+        .def ("getTimeFormat", &MidiFile::getTimeFormat)
+        .def ("setTicksPerQuarterNote", &MidiFile::setTicksPerQuarterNote, "ticksPerQuarterNote"_a)
+        .def ("setSmpteTimeFormat", &MidiFile::setSmpteTimeFormat, "framesPerSecond"_a, "subframeResolution"_a)
+        .def ("findAllTempoEvents", [](const MidiFile& self)
+        {
+            MidiMessageSequence result;
+            self.findAllTempoEvents (result);
+            return result;
+        })
+        .def ("findAllTimeSigEvents", [](const MidiFile& self)
+        {
+            MidiMessageSequence result;
+            self.findAllTimeSigEvents (result);
+            return result;
+        })
+        .def ("findAllKeySigEvents", [](const MidiFile& self)
+        {
+            MidiMessageSequence result;
+            self.findAllKeySigEvents (result);
+            return result;
+        })
+        .def ("getLastTimestamp", &MidiFile::getLastTimestamp)
+        .def ("readFrom", [](MidiFile& self, InputStream& sourceStream, bool createMatchingNoteOffs)
+        {
+            int midiFileType = 0;
+            bool result = false;
+
+            {
+                py::gil_scoped_release release;
+                result = self.readFrom (sourceStream, createMatchingNoteOffs, &midiFileType);
+            }
+
+            return py::make_tuple (result, midiFileType);
+        }, "sourceStream"_a, "createMatchingNoteOffs"_a = true)
+        .def ("writeTo", &MidiFile::writeTo, "destStream"_a, "midiFileType"_a = 1, py::call_guard<py::gil_scoped_release>())
+        .def ("convertTimestampTicksToSeconds", &MidiFile::convertTimestampTicksToSeconds)
+        .def_static ("readTables", [](py::object source, bool createMatchingNoteOffs)
+        {
+            MemoryBlock data;
+            std::optional<File> file;
+
+            if (py::isinstance<File> (source))
+                file = source.cast<File>();
+            else if (py::isinstance<py::str> (source) || py::hasattr (source, "__fspath__"))
+                file = File::getCurrentWorkingDirectory().getChildFile (py::str (py::module_::import ("os").attr ("fspath") (source)).cast<String>());
+            else if (py::isinstance<py::buffer> (source))
+            {
+                const auto info = py::reinterpret_borrow<py::buffer> (source).request();
+                data.append (info.ptr, static_cast<size_t> (info.size * info.itemsize));
+            }
+            else
+                throw py::type_error ("The source must be a File, a path or a buffer");
+
+            std::optional<MidiFileColumns> columns;
+
+            {
+                py::gil_scoped_release release;
+
+                if (! file || file->loadFileAsData (data))
+                    columns = parseMidiFileColumns (data.getData(), data.getSize(), createMatchingNoteOffs);
+            }
+
+            if (! columns)
+                throw py::value_error ("Unable to read a standard MIDI file from the source");
+
+            py::list tracks;
+            for (auto& track : columns->tracks)
+                tracks.append (makeMidiTrackTable (std::move (track)));
+
+            py::dict result;
+            result["timeFormat"] = columns->timeFormat;
+            result["midiFileType"] = columns->midiFileType;
+            result["tracks"] = tracks;
+            return result;
+        }, "source"_a, "createMatchingNoteOffs"_a = true)
+        .def_static ("writeTables", [](py::list tracks, py::object destination, int timeFormat, int midiFileType) -> py::object
+        {
+            if (timeFormat == 0 || timeFormat < std::numeric_limits<short>::min() || timeFormat > std::numeric_limits<short>::max())
+                throw py::value_error ("The time format must be positive ticks per quarter note, or negative for SMPTE as returned by readTables");
+
+            if (midiFileType < 0 || midiFileType > 2)
+                throw py::value_error ("The MIDI file type must be 0, 1 or 2");
+
+            MidiFile file;
+
+            // Negative time formats hold the SMPTE frames per second in the high byte and the subframe resolution in the low one
+            if (timeFormat < 0)
+                file.setSmpteTimeFormat (-(timeFormat >> 8), timeFormat & 0xff);
+            else
+                file.setTicksPerQuarterNote (timeFormat);
+
+            for (auto track : tracks)
+                file.addTrack (makeSequenceFromMidiTrackTable (track.cast<py::dict>()));
+
+            if (destination.is_none())
+            {
+                MemoryOutputStream stream;
+
+                bool written = false;
+                {
+                    py::gil_scoped_release release;
+                    written = file.writeTo (stream, midiFileType);
+                }
+
+                if (! written)
+                    throw py::value_error ("Unable to write the standard MIDI file");
+
+                return py::bytes (static_cast<const char*> (stream.getData()), stream.getDataSize());
+            }
+
+            File destinationFile;
+
+            if (py::isinstance<File> (destination))
+                destinationFile = destination.cast<File>();
+            else
+                destinationFile = File::getCurrentWorkingDirectory().getChildFile (py::str (py::module_::import ("os").attr ("fspath") (destination)).cast<String>());
+
+            bool written = false;
+            {
+                py::gil_scoped_release release;
+
+                destinationFile.deleteFile();
+                FileOutputStream stream (destinationFile);
+
+                written = stream.openedOk() && file.writeTo (stream, midiFileType);
+            }
+
+            if (! written)
+                throw py::value_error ("Unable to write the standard MIDI file to " + destinationFile.getFullPathName().toStdString());
+
+            return py::none();
+        }, "tracks"_a, "destination"_a = py::none(), "timeFormat"_a = 960, "midiFileType"_a = 1)
     ;
 
     // ============================================================================================ juce::AudioSourceChannelInfo
@@ -548,6 +2249,24 @@ void registerJuceAudioBasicsBindings (py::module_& m)
         .def ("getNextAudioBlock", &AudioSource::getNextAudioBlock)
     ;
 
+    bindCallbackTimingStats (classAudioSource);
+
+    py::class_<PyNativeAudioSource, AudioSource> classNativeAudioSource (m, "NativeAudioSource");
+
+    classNativeAudioSource
+        .def (py::init ([](py::object process, py::object userData, py::object prepare, py::object release)
+        {
+            return new PyNativeAudioSource (
+                Helpers::getNativeFunction<PyNativeAudioSource::ProcessFunction> (process),
+                Helpers::getNativeAddress (userData),
+                Helpers::getNativeFunction<PyNativeAudioSource::PrepareFunction> (prepare),
+                Helpers::getNativeFunction<PyNativeAudioSource::ReleaseFunction> (release));
+        }), "process"_a, "userData"_a = py::none(), "prepare"_a = py::none(), "release"_a = py::none(),
+            py::keep_alive<1, 2>(), py::keep_alive<1, 3>(), py::keep_alive<1, 4>(), py::keep_alive<1, 5>())
+        .def ("getUserData", [](const PyNativeAudioSource& self) { return reinterpret_cast<std::uintptr_t> (self.getUserData()); })
+        .def ("getNextAudioBlock", &PyNativeAudioSource::getNextAudioBlock, py::call_guard<py::gil_scoped_release>())
+    ;
+
     py::class_<PositionableAudioSource, AudioSource, PyPositionableAudioSource<>> classPositionableAudioSource (m, "PositionableAudioSource");
 
     classPositionableAudioSource
@@ -631,6 +2350,133 @@ void registerJuceAudioBasicsBindings (py::module_& m)
         .def ("setFrequency", &ToneGeneratorAudioSource::setFrequency)
     ;
 
+    // ============================================================================================ juce::renderAudioSource
+
+    m.def ("renderAudioSource", [](AudioSource& source, int numSamples, int blockSize, double sampleRate, int numChannels, py::object out, bool releaseResources)
+    {
+        if (numSamples < 0 || blockSize <= 0 || sampleRate <= 0.0 || numChannels < 0)
+            throw py::value_error ("Invalid render settings");
+
+        if (out.is_none())
+            out = py::array_t<float> (std::vector<py::ssize_t> { numChannels, numSamples });
+
+        PyChannelPointers<float> channels (out);
+        if (channels.getNumChannels() < numChannels || (numChannels > 0 && channels.getNumSamples() < numSamples))
+            throw py::value_error ("The output is too small for the requested channels and samples");
+
+        {
+            py::gil_scoped_release release;
+
+            // Blocks are rendered straight into the output memory, python is only re-entered by python sources
+            AudioBuffer<float> buffer;
+            if (numChannels > 0)
+                buffer.setDataToReferTo (channels.data(), numChannels, numSamples);
+
+            source.prepareToPlay (blockSize, sampleRate);
+
+            for (int startSample = 0; startSample < numSamples; startSample += blockSize)
+                source.getNextAudioBlock (AudioSourceChannelInfo (&buffer, startSample, jmin (blockSize, numSamples - startSample)));
+
+            if (releaseResources)
+                source.releaseResources();
+        }
+
+        return out;
+    }, "source"_a, "numSamples"_a, "blockSize"_a = 512, "sampleRate"_a = 44100.0, "numChannels"_a = 2, "out"_a = py::none(), "releaseResources"_a = true);
+
+    // ============================================================================================ juce::resample
+
+    py::enum_<ResamplingInterpolator> (m, "ResamplingInterpolator")
+        .value ("zeroOrderHold", ResamplingInterpolator::zeroOrderHold)
+        .value ("linear", ResamplingInterpolator::linear)
+        .value ("catmullRom", ResamplingInterpolator::catmullRom)
+        .value ("lagrange", ResamplingInterpolator::lagrange)
+        .value ("windowedSinc", ResamplingInterpolator::windowedSinc);
+
+    m.def ("resample", [](py::object data, double sourceSampleRate, double targetSampleRate, ResamplingInterpolator interpolator, ThreadPool* threadPool)
+    {
+        if (sourceSampleRate <= 0.0 || targetSampleRate <= 0.0)
+            throw py::value_error ("Sample rates must be positive");
+
+        PyChannelPointers<const float> input (data);
+
+        const auto ratio = sourceSampleRate / targetSampleRate;
+        const auto numOutputSamples = getResampledLength (input.getNumSamples(), ratio);
+        if (numOutputSamples > std::numeric_limits<int>::max())
+            throw py::value_error ("Too many samples to resample at once");
+
+        const auto isSingleChannel = py::isinstance<py::array> (data) && data.cast<py::array>().ndim() == 1;
+
+        py::array_t<float> result (isSingleChannel
+            ? std::vector<py::ssize_t> { static_cast<py::ssize_t> (numOutputSamples) }
+            : std::vector<py::ssize_t> { input.getNumChannels(), static_cast<py::ssize_t> (numOutputSamples) });
+
+        PyChannelPointers<float> output (result);
+
+        {
+            py::gil_scoped_release release;
+
+            resampleChannels (interpolator, input.data(), input.getNumChannels(), input.getNumSamples(),
+                              output.data(), static_cast<int> (numOutputSamples), ratio, threadPool);
+        }
+
+        return result;
+    }, "data"_a, "sourceSampleRate"_a, "targetSampleRate"_a, "interpolator"_a = ResamplingInterpolator::lagrange, "threadPool"_a = nullptr);
+
+    // ============================================================================================ juce::StreamingResampler
+
+    py::class_<PyStreamingResampler> classStreamingResampler (m, "StreamingResampler");
+
+    classStreamingResampler
+        .def (py::init ([](int numChannels, double sourceSampleRate, double targetSampleRate, ResamplingInterpolator interpolator, int maximumBlockSize)
+        {
+            if (numChannels <= 0)
+                throw py::value_error ("The number of channels must be positive");
+
+            if (sourceSampleRate <= 0.0 || targetSampleRate <= 0.0)
+                throw py::value_error ("Sample rates must be positive");
+
+            if (maximumBlockSize < 0)
+                throw py::value_error ("The maximum block size can't be negative");
+
+            return std::make_unique<PyStreamingResampler> (numChannels, sourceSampleRate, targetSampleRate, interpolator, maximumBlockSize);
+        }), "numChannels"_a, "sourceSampleRate"_a, "targetSampleRate"_a, "interpolator"_a = ResamplingInterpolator::lagrange, "maximumBlockSize"_a = 4096)
+        .def ("getNumChannels", &PyStreamingResampler::getNumChannels)
+        .def ("getSourceSampleRate", &PyStreamingResampler::getSourceSampleRate)
+        .def ("getTargetSampleRate", &PyStreamingResampler::getTargetSampleRate)
+        .def ("getNumPendingSamples", &PyStreamingResampler::getNumPendingSamples)
+        .def ("getNumOutputSamples", &PyStreamingResampler::getNumOutputSamples, "numInputSamples"_a)
+        .def ("process", [](PyStreamingResampler& self, py::object data)
+        {
+            PyChannelPointers<const float> input (data);
+            if (input.getNumChannels() != self.getNumChannels())
+                throw py::value_error ("The data must have as many channels as the resampler");
+
+            py::array_t<float> result (std::vector<py::ssize_t> { self.getNumChannels(), self.getNumOutputSamples (input.getNumSamples()) });
+            PyChannelPointers<float> output (result);
+
+            {
+                py::gil_scoped_release release;
+                self.process (input.data(), input.getNumSamples(), output.data());
+            }
+
+            return result;
+        }, "data"_a)
+        .def ("flush", [](PyStreamingResampler& self)
+        {
+            py::array_t<float> result (std::vector<py::ssize_t> { self.getNumChannels(), self.getNumFlushSamples() });
+            PyChannelPointers<float> output (result);
+
+            {
+                py::gil_scoped_release release;
+                self.flush (output.data());
+            }
+
+            return result;
+        })
+        .def ("reset", &PyStreamingResampler::reset)
+    ;
+
     // ============================================================================================ juce::AudioPlayHead
 
     py::class_<AudioPlayHead, PyAudioPlayHead> classAudioPlayHead (m, "AudioPlayHead");
@@ -764,6 +2610,166 @@ void registerJuceAudioBasicsBindings (py::module_& m)
         .def_static ("gainWithLowerBound", &Decibels::template gainWithLowerBound<float>, "gain"_a, "lowerBoundDb"_a)
         .def_static ("toString", &Decibels::template toString<float>, "decibels"_a, "decimalPlaces"_a = 2, "minusInfinityDb"_a = -100.0f, "shouldIncludeSuffix"_a = true, "customMinusInfinityString"_a = String())
     ;
+
+    // ============================================================================================ juce::ADSR
+
+    py::class_<ADSR> classADSR (m, "ADSR");
+    py::class_<ADSR::Parameters> classADSRParameters (classADSR, "Parameters");
+
+    classADSRParameters
+        .def (py::init<>())
+        .def (py::init<float, float, float, float>(), "attackTimeSeconds"_a, "decayTimeSeconds"_a, "sustainLevel"_a, "releaseTimeSeconds"_a)
+        .def_readwrite ("attack", &ADSR::Parameters::attack)
+        .def_readwrite ("decay", &ADSR::Parameters::decay)
+        .def_readwrite ("sustain", &ADSR::Parameters::sustain)
+        .def_readwrite ("release", &ADSR::Parameters::release)
+    ;
+
+    classADSR
+        .def (py::init<>())
+        .def ("setParameters", &ADSR::setParameters, "newParameters"_a)
+        .def ("getParameters", &ADSR::getParameters)
+        .def ("isActive", &ADSR::isActive)
+        .def ("setSampleRate", &ADSR::setSampleRate, "newSampleRate"_a)
+        .def ("reset", &ADSR::reset)
+        .def ("noteOn", &ADSR::noteOn)
+        .def ("noteOff", &ADSR::noteOff)
+        .def ("getNextSample", &ADSR::getNextSample)
+        .def ("applyEnvelopeToBuffer", &ADSR::template applyEnvelopeToBuffer<float>, "buffer"_a, "startSample"_a, "numSamples"_a)
+        .def ("applyEnvelopeToBuffer", &ADSR::template applyEnvelopeToBuffer<double>, "buffer"_a, "startSample"_a, "numSamples"_a)
+    ;
+
+    // ============================================================================================ juce::SynthesiserSound
+
+    py::class_<SynthesiserSound, SynthesiserSound::Ptr, PySynthesiserSound> classSynthesiserSound (m, "SynthesiserSound");
+
+    classSynthesiserSound
+        .def (py::init<>())
+        .def ("appliesToNote", &SynthesiserSound::appliesToNote, "midiNoteNumber"_a)
+        .def ("appliesToChannel", &SynthesiserSound::appliesToChannel, "midiChannel"_a)
+    ;
+
+    py::class_<PySimpleSynthesiserSound, SynthesiserSound, ReferenceCountedObjectPtr<PySimpleSynthesiserSound>> classSimpleSynthesiserSound (m, "SimpleSynthesiserSound");
+
+    classSimpleSynthesiserSound
+        .def (py::init<int, int, int>(), "lowestNote"_a = 0, "highestNote"_a = 127, "midiChannel"_a = 0)
+        .def ("getLowestNote", &PySimpleSynthesiserSound::getLowestNote)
+        .def ("getHighestNote", &PySimpleSynthesiserSound::getHighestNote)
+        .def ("getMidiChannel", &PySimpleSynthesiserSound::getMidiChannel)
+    ;
+
+    // ============================================================================================ juce::SynthesiserVoice
+
+    py::class_<SynthesiserVoice, PySynthesiserVoice<>> classSynthesiserVoice (m, "SynthesiserVoice");
+
+    classSynthesiserVoice
+        .def (py::init<>())
+        .def ("getCurrentlyPlayingNote", &SynthesiserVoice::getCurrentlyPlayingNote)
+        .def ("getCurrentlyPlayingSound", &SynthesiserVoice::getCurrentlyPlayingSound)
+        .def ("canPlaySound", &SynthesiserVoice::canPlaySound, "sound"_a)
+        .def ("startNote", &SynthesiserVoice::startNote, "midiNoteNumber"_a, "velocity"_a, "sound"_a, "currentPitchWheelPosition"_a)
+        .def ("stopNote", &SynthesiserVoice::stopNote, "velocity"_a, "allowTailOff"_a)
+        .def ("isVoiceActive", &SynthesiserVoice::isVoiceActive)
+        .def ("pitchWheelMoved", &SynthesiserVoice::pitchWheelMoved, "newPitchWheelValue"_a)
+        .def ("controllerMoved", &SynthesiserVoice::controllerMoved, "controllerNumber"_a, "newControllerValue"_a)
+        .def ("aftertouchChanged", &SynthesiserVoice::aftertouchChanged, "newAftertouchValue"_a)
+        .def ("channelPressureChanged", &SynthesiserVoice::channelPressureChanged, "newChannelPressureValue"_a)
+        .def ("renderNextBlock", py::overload_cast<AudioBuffer<float>&, int, int> (&SynthesiserVoice::renderNextBlock),
+            "outputBuffer"_a, "startSample"_a, "numSamples"_a)
+        .def ("renderNextBlock", py::overload_cast<AudioBuffer<double>&, int, int> (&SynthesiserVoice::renderNextBlock),
+            "outputBuffer"_a, "startSample"_a, "numSamples"_a)
+        .def ("setCurrentPlaybackSampleRate", &SynthesiserVoice::setCurrentPlaybackSampleRate, "newRate"_a)
+        .def ("isPlayingChannel", &SynthesiserVoice::isPlayingChannel, "midiChannel"_a)
+        .def ("getSampleRate", &SynthesiserVoice::getSampleRate)
+        .def ("isKeyDown", &SynthesiserVoice::isKeyDown)
+        .def ("setKeyDown", &SynthesiserVoice::setKeyDown, "isNowDown"_a)
+        .def ("isSustainPedalDown", &SynthesiserVoice::isSustainPedalDown)
+        .def ("setSustainPedalDown", &SynthesiserVoice::setSustainPedalDown, "isNowDown"_a)
+        .def ("isSostenutoPedalDown", &SynthesiserVoice::isSostenutoPedalDown)
+        .def ("setSostenutoPedalDown", &SynthesiserVoice::setSostenutoPedalDown, "isNowDown"_a)
+        .def ("isSoftPedalDown", &SynthesiserVoice::isSoftPedalDown)
+        .def ("setSoftPedalDown", &SynthesiserVoice::setSoftPedalDown, "isNowDown"_a)
+        .def ("isPlayingButReleased", &SynthesiserVoice::isPlayingButReleased)
+        .def ("wasStartedBefore", &SynthesiserVoice::wasStartedBefore, "other"_a)
+        .def ("clearCurrentNote", &SynthesiserVoicePublicist::clearCurrentNote)
+    ;
+
+    py::class_<PyNativeSynthesiserVoice, SynthesiserVoice> classNativeSynthesiserVoice (m, "NativeSynthesiserVoice");
+
+    classNativeSynthesiserVoice
+        .def ("setGain", &PyNativeSynthesiserVoice::setGain, "newGain"_a)
+        .def ("getGain", &PyNativeSynthesiserVoice::getGain)
+        .def ("setEnvelopeParameters", &PyNativeSynthesiserVoice::setEnvelopeParameters, "parameters"_a)
+        .def ("getEnvelopeParameters", &PyNativeSynthesiserVoice::getEnvelopeParameters)
+        .def ("setPitchWheelRange", &PyNativeSynthesiserVoice::setPitchWheelRange, "newRangeInSemitones"_a)
+        .def ("getPitchWheelRange", &PyNativeSynthesiserVoice::getPitchWheelRange)
+    ;
+
+    py::class_<PySineVoice, PyNativeSynthesiserVoice> classSineVoice (m, "SineVoice");
+
+    classSineVoice
+        .def (py::init<>())
+    ;
+
+    py::class_<PyWavetableVoice, PyNativeSynthesiserVoice> classWavetableVoice (m, "WavetableVoice");
+
+    classWavetableVoice
+        .def (py::init<const AudioBuffer<float>&>(), "wavetable"_a)
+        .def ("getTableSize", &PyWavetableVoice::getTableSize)
+    ;
+
+    // ============================================================================================ juce::Synthesiser
+
+    py::class_<Synthesiser, PySynthesiser<>> classSynthesiser (m, "Synthesiser");
+
+    classSynthesiser
+        .def (py::init<>())
+        .def ("clearVoices", &Synthesiser::clearVoices, py::call_guard<py::gil_scoped_release>())
+        .def ("getNumVoices", &Synthesiser::getNumVoices)
+        .def ("getVoice", &Synthesiser::getVoice, "index"_a, py::return_value_policy::reference, py::call_guard<py::gil_scoped_release>())
+        .def ("addVoice", [](Synthesiser& self, py::object newVoice)
+        {
+            if (! py::isinstance<SynthesiserVoice> (newVoice))
+                throw py::type_error ("The voice to add must be an instance of SynthesiserVoice");
+
+            auto* voice = newVoice.release().cast<SynthesiserVoice*>();
+
+            py::gil_scoped_release release;
+            return self.addVoice (voice);
+        }, "newVoice"_a, py::return_value_policy::reference)
+        .def ("removeVoice", &Synthesiser::removeVoice, "index"_a, py::call_guard<py::gil_scoped_release>())
+        .def ("clearSounds", &Synthesiser::clearSounds, py::call_guard<py::gil_scoped_release>())
+        .def ("getNumSounds", &Synthesiser::getNumSounds)
+        .def ("getSound", &Synthesiser::getSound, "index"_a)
+        .def ("addSound", &Synthesiser::addSound, "newSound"_a, py::keep_alive<1, 2>(), py::return_value_policy::reference, py::call_guard<py::gil_scoped_release>())
+        .def ("removeSound", &Synthesiser::removeSound, "index"_a, py::call_guard<py::gil_scoped_release>())
+        .def ("setNoteStealingEnabled", &Synthesiser::setNoteStealingEnabled, "shouldStealNotes"_a)
+        .def ("isNoteStealingEnabled", &Synthesiser::isNoteStealingEnabled)
+        .def ("noteOn", &Synthesiser::noteOn, "midiChannel"_a, "midiNoteNumber"_a, "velocity"_a, py::call_guard<py::gil_scoped_release>())
+        .def ("noteOff", &Synthesiser::noteOff, "midiChannel"_a, "midiNoteNumber"_a, "velocity"_a, "allowTailOff"_a, py::call_guard<py::gil_scoped_release>())
+        .def ("allNotesOff", &Synthesiser::allNotesOff, "midiChannel"_a, "allowTailOff"_a, py::call_guard<py::gil_scoped_release>())
+        .def ("handlePitchWheel", &Synthesiser::handlePitchWheel, "midiChannel"_a, "wheelValue"_a, py::call_guard<py::gil_scoped_release>())
+        .def ("handleController", &Synthesiser::handleController, "midiChannel"_a, "controllerNumber"_a, "controllerValue"_a, py::call_guard<py::gil_scoped_release>())
+        .def ("handleAftertouch", &Synthesiser::handleAftertouch, "midiChannel"_a, "midiNoteNumber"_a, "aftertouchValue"_a, py::call_guard<py::gil_scoped_release>())
+        .def ("handleChannelPressure", &Synthesiser::handleChannelPressure, "midiChannel"_a, "channelPressureValue"_a, py::call_guard<py::gil_scoped_release>())
+        .def ("handleSustainPedal", &Synthesiser::handleSustainPedal, "midiChannel"_a, "isDown"_a, py::call_guard<py::gil_scoped_release>())
+        .def ("handleSostenutoPedal", &Synthesiser::handleSostenutoPedal, "midiChannel"_a, "isDown"_a, py::call_guard<py::gil_scoped_release>())
+        .def ("handleSoftPedal", &Synthesiser::handleSoftPedal, "midiChannel"_a, "isDown"_a, py::call_guard<py::gil_scoped_release>())
+        .def ("handleProgramChange", &Synthesiser::handleProgramChange, "midiChannel"_a, "programNumber"_a, py::call_guard<py::gil_scoped_release>())
+        .def ("setCurrentPlaybackSampleRate", &Synthesiser::setCurrentPlaybackSampleRate, "sampleRate"_a, py::call_guard<py::gil_scoped_release>())
+        .def ("getSampleRate", &Synthesiser::getSampleRate)
+        .def ("setMinimumRenderingSubdivisionSize", &Synthesiser::setMinimumRenderingSubdivisionSize, "numSamples"_a, "shouldBeStrict"_a = false)
+        .def ("renderNextBlock", &Synthesiser::template renderNextBlock<float>,
+            "outputAudio"_a, "inputMidi"_a, "startSample"_a, "numSamples"_a, py::call_guard<py::gil_scoped_release>())
+        .def ("renderNextBlock", &Synthesiser::template renderNextBlock<double>,
+            "outputAudio"_a, "inputMidi"_a, "startSample"_a, "numSamples"_a, py::call_guard<py::gil_scoped_release>())
+        .def ("findFreeVoice", &SynthesiserPublicist::findFreeVoice,
+            "soundToPlay"_a, "midiChannel"_a, "midiNoteNumber"_a, "stealIfNoneAvailable"_a, py::return_value_policy::reference, py::call_guard<py::gil_scoped_release>())
+        .def ("findVoiceToSteal", &SynthesiserPublicist::findVoiceToSteal,
+            "soundToPlay"_a, "midiChannel"_a, "midiNoteNumber"_a, py::return_value_policy::reference)
+        .def ("startVoice", &SynthesiserPublicist::startVoice,
+            "voice"_a, "sound"_a, "midiChannel"_a, "midiNoteNumber"_a, "velocity"_a)
+    ;
 }
 
 } // namespace popsicle::Bindings
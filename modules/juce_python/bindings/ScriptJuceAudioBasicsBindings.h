@@ -26,6 +26,8 @@
 
 #include "../utilities/PyBind11Includes.h"
 
+#include "../utilities/PythonInterop.h"
+
 // #include "ScriptJuceGuiBasicsBindings.h"
 
 namespace popsicle::Bindings {
@@ -36,6 +38,22 @@ void registerJuceAudioBasicsBindings (pybind11::module_& m);
 
 // =================================================================================================
 
+/**
+ * @brief A short MIDI message with its timestamp, the record type of the arrays described by getMidiEventDtype.
+ */
+struct MidiEventRecord
+{
+    double timestamp;
+    juce::uint8 status;
+    juce::uint8 data1;
+    juce::uint8 data2;
+};
+
+/** Copies the records into a new structured numpy array, registering the record dtype on first use. */
+pybind11::object makeMidiEventRecords (const MidiEventRecord* records, int numRecords);
+
+// =================================================================================================
+
 template <class T>
 struct PyArrayView
 {
@@ -70,83 +88,2012 @@ private:
 
 // =================================================================================================
 
-struct PyAudioPlayHead : juce::AudioPlayHead
+/**
+ * @brief Returns the distance in samples between consecutive channels, or nullopt if the channels don't have a uniform
+ * non overlapping stride, so they can't be described as a single 2D buffer.
+ */
+template <class T>
+std::optional<std::ptrdiff_t> getUniformChannelStride (T* const* channels, int numChannels, int numSamples) noexcept
 {
-    using juce::AudioPlayHead::AudioPlayHead;
+    if (channels == nullptr || numChannels <= 0)
+        return std::nullopt;
 
-    juce::Optional<juce::AudioPlayHead::PositionInfo> getPosition() const override
+    if (numChannels == 1)
+        return static_cast<std::ptrdiff_t> (numSamples);
+
+    const auto stride = channels[1] - channels[0];
+    if (stride < numSamples)
+        return std::nullopt;
+
+    for (int i = 2; i < numChannels; ++i)
+        if (channels[i] - channels[i - 1] != stride)
+            return std::nullopt;
+
+    return stride;
+}
+
+// =================================================================================================
+
+/**
+ * @brief A reusable view over a set of audio channels (channels x samples).
+ *
+ * The python wrappers of the view and of each of its channels are created once in prepare(), then every audio block
+ * only rebinds the channel pointers in place, so handing the channels to python doesn't allocate in the steady state.
+ * When the channels are laid out with a uniform stride, the view also exports a 2D buffer.
+ */
+template <class T>
+struct PyAudioChannelsView
+{
+    PyAudioChannelsView() = default;
+
+    /**
+     * Allocates the storage and python wrappers for up to maxNumChannels. Must be called with the GIL held.
+     *
+     * The channel wrappers already handed to python refer to their views, so existing views are never freed or moved,
+     * the storage only grows.
+     */
+    void prepare (int maxNumChannels)
     {
-        PYBIND11_OVERRIDE_PURE (juce::Optional<juce::AudioPlayHead::PositionInfo>, juce::AudioPlayHead, getPosition);
+        const auto capacity = static_cast<size_t> (juce::jmax (0, maxNumChannels));
+
+        channelViews.reserve (capacity);
+        channelObjects.reserve (capacity);
+
+        while (channelViews.size() < capacity)
+        {
+            channelViews.push_back (std::make_unique<PyArrayView<T>>());
+            channelObjects.push_back (pybind11::cast (channelViews.back().get(), pybind11::return_value_policy::reference));
+        }
+
+        channels = nullptr;
+        numChannels = 0;
+        numSamples = 0;
     }
 
-    bool canControlTransport() override
+    /** Rebinds the view to a new set of channels. Only reallocates (GIL needed) if the channels exceed the prepared capacity. */
+    void rebind (T* const* newChannels, int newNumChannels, int newNumSamples)
+    {
+        if (static_cast<size_t> (newNumChannels) > channelViews.size())
+            prepare (newNumChannels);
+
+        channels = newChannels;
+        numChannels = newNumChannels;
+        numSamples = newNumSamples;
+
+        for (int i = 0; i < numChannels; ++i)
+            *channelViews[static_cast<size_t> (i)] = PyArrayView<T> (channels[i], static_cast<size_t> (numSamples));
+    }
+
+    int getNumChannels() const noexcept
     {
-        PYBIND11_OVERRIDE (bool, juce::AudioPlayHead, canControlTransport);
+        return numChannels;
     }
 
-    void transportPlay (bool shouldStartPlaying) override
+    int getNumSamples() const noexcept
     {
-        PYBIND11_OVERRIDE (void, juce::AudioPlayHead, transportPlay, shouldStartPlaying);
+        return numSamples;
     }
 
-    void transportRecord (bool shouldStartRecording) override
+    size_t getCapacity() const noexcept
     {
-        PYBIND11_OVERRIDE (void, juce::AudioPlayHead, transportRecord, shouldStartRecording);
+        return channelViews.size();
     }
 
-    void transportRewind() override
+    T* getChannelPointer (int index) const noexcept
+    {
+        return (channels != nullptr && index >= 0 && index < numChannels) ? channels[index] : nullptr;
+    }
+
+    pybind11::object getChannel (int index) const
+    {
+        if (index < 0 || index >= numChannels)
+            throw pybind11::index_error ("Out of bound access of channel data");
+
+        return channelObjects[static_cast<size_t> (index)];
+    }
+
+    auto begin() const noexcept
+    {
+        return channelObjects.begin();
+    }
+
+    auto end() const noexcept
+    {
+        return channelObjects.begin() + numChannels;
+    }
+
+    /** Returns the distance in samples between consecutive channels, or nullopt if the channels are not evenly spaced. */
+    std::optional<std::ptrdiff_t> getChannelStride() const noexcept
     {
-        PYBIND11_OVERRIDE (void, juce::AudioPlayHead, transportRewind);
+        return getUniformChannelStride (channels, numChannels, numSamples);
     }
+
+private:
+    T* const* channels = nullptr;
+    int numChannels = 0;
+    int numSamples = 0;
+    std::vector<std::unique_ptr<PyArrayView<T>>> channelViews;
+    std::vector<pybind11::object> channelObjects;
 };
 
 // =================================================================================================
 
-template <class Base = juce::AudioSource>
-struct PyAudioSource : Base
+/**
+ * @brief Collects the channel pointers of a python object holding audio data, without copying it.
+ *
+ * Accepts either a 2D buffer (channels x samples) whose samples are contiguous in each channel, or a sequence of 1D
+ * buffers, one per channel. The underlying buffers are kept alive for the lifetime of this object, which must be
+ * constructed and destroyed with the GIL held.
+ */
+template <class T>
+class PyChannelPointers
 {
-    using Base::Base;
+public:
+    using ValueType = std::remove_const_t<T>;
 
-    void prepareToPlay (int newSamplesPerBlockExpected, double newSampleRate) override
+    explicit PyChannelPointers (const pybind11::object& channels)
+    {
+        if (pybind11::isinstance<pybind11::buffer> (channels))
+        {
+            try
+            {
+                auto info = pybind11::reinterpret_borrow<pybind11::buffer> (channels).request (isWritable);
+
+                if (info.ndim == 2)
+                {
+                    addChannelsFrom2DBuffer (std::move (info));
+                    return;
+                }
+
+                if (info.ndim == 1 && ! pybind11::isinstance<pybind11::sequence> (channels))
+                {
+                    addChannelFrom1DBuffer (std::move (info));
+                    return;
+                }
+            }
+            catch (const pybind11::error_already_set& e)
+            {
+                // Buffers that can't be exported as a whole (i.e. non uniformly strided channels) are split in channels
+                if (! e.matches (PyExc_BufferError) || ! pybind11::isinstance<pybind11::sequence> (channels))
+                    throw;
+            }
+        }
+
+        if (! pybind11::isinstance<pybind11::sequence> (channels))
+            throw pybind11::type_error ("Audio data must be a 2D buffer or a sequence of 1D buffers");
+
+        for (auto channel : channels)
+        {
+            if (! pybind11::isinstance<pybind11::buffer> (channel))
+                throw pybind11::type_error ("Each audio channel must support the buffer protocol");
+
+            auto info = pybind11::reinterpret_borrow<pybind11::buffer> (channel).request (isWritable);
+            if (info.ndim != 1)
+                throw pybind11::value_error ("Each audio channel must be a 1D buffer");
+
+            addChannelFrom1DBuffer (std::move (info));
+        }
+    }
+
+    T* const* data() const noexcept
     {
-        PYBIND11_OVERRIDE_PURE (void, Base, prepareToPlay, newSamplesPerBlockExpected, newSampleRate);
+        return pointers.data();
     }
 
-    void releaseResources() override
+    int getNumChannels() const noexcept
     {
-        PYBIND11_OVERRIDE_PURE (void, Base, releaseResources);
+        return static_cast<int> (pointers.size());
     }
 
-    void getNextAudioBlock (const juce::AudioSourceChannelInfo& bufferToFill) override
+    /** Returns the number of samples available in all the channels. */
+    int getNumSamples() const noexcept
+    {
+        return numSamples;
+    }
+
+private:
+    void checkFormat (const pybind11::buffer_info& info) const
+    {
+        if (! Helpers::isBufferFormatOf<ValueType> (info))
+        {
+            throw pybind11::type_error (juce::String ("Audio data must have format '")
+                + juce::String (pybind11::format_descriptor<ValueType>::format()) + "', got '" + juce::String (info.format) + "'");
+        }
+    }
+
+    void addChannelsFrom2DBuffer (pybind11::buffer_info info)
+    {
+        checkFormat (info);
+
+        if (info.shape[0] > 0 && info.shape[1] > 1 && info.strides[1] != info.itemsize)
+            throw pybind11::value_error ("Samples of each audio channel must be contiguous in memory");
+
+        numSamples = static_cast<int> (info.shape[1]);
+
+        for (pybind11::ssize_t channel = 0; channel < info.shape[0]; ++channel)
+            pointers.push_back (reinterpret_cast<T*> (static_cast<char*> (info.ptr) + channel * info.strides[0]));
+
+        buffers.push_back (std::move (info));
+    }
+
+    void addChannelFrom1DBuffer (pybind11::buffer_info info)
     {
-        PYBIND11_OVERRIDE_PURE (void, Base, getNextAudioBlock, bufferToFill);
+        checkFormat (info);
+
+        if (info.shape[0] > 1 && info.strides[0] != info.itemsize)
+            throw pybind11::value_error ("Samples of each audio channel must be contiguous in memory");
+
+        const auto channelSamples = static_cast<int> (info.shape[0]);
+        numSamples = pointers.empty() ? channelSamples : juce::jmin (numSamples, channelSamples);
+
+        pointers.push_back (static_cast<T*> (info.ptr));
+        buffers.push_back (std::move (info));
     }
+
+    static constexpr bool isWritable = ! std::is_const_v<T>;
+
+    std::vector<pybind11::buffer_info> buffers;
+    std::vector<T*> pointers;
+    int numSamples = 0;
 };
 
-template <class Base = juce::PositionableAudioSource>
-struct PyPositionableAudioSource : PyAudioSource<Base>
+// =================================================================================================
+
+/**
+ * @brief The juce interpolators available to the resamplers, from the cheapest to the highest quality.
+ */
+enum class ResamplingInterpolator
 {
-    using PyAudioSource<Base>::PyAudioSource;
+    zeroOrderHold,
+    linear,
+    catmullRom,
+    lagrange,
+    windowedSinc
+};
 
-    void setNextReadPosition (juce::int64 newPosition) override
+/**
+ * @brief Type erased juce interpolator, resampling one channel.
+ *
+ * The ratio is the input over the output rate. When the input runs out before all the requested output samples are
+ * produced, the missing input samples are zeros.
+ */
+class ChannelInterpolator
+{
+public:
+    virtual ~ChannelInterpolator() = default;
+
+    /** Returns the latency of the interpolator in input samples. */
+    virtual int getLatency() const noexcept = 0;
+
+    /** Produces numOutputSamples samples, returning the number of input samples consumed. */
+    virtual int process (double ratio, const float* input, float* output, int numOutputSamples, int numInputSamples) noexcept = 0;
+
+    virtual void reset() noexcept = 0;
+
+    static std::unique_ptr<ChannelInterpolator> create (ResamplingInterpolator type);
+};
+
+template <class Interpolator>
+class TypedChannelInterpolator : public ChannelInterpolator
+{
+public:
+    int getLatency() const noexcept override
     {
-        PYBIND11_OVERRIDE_PURE (void, PyAudioSource<Base>, setNextReadPosition, newPosition);
+        return juce::roundToInt (Interpolator::getBaseLatency());
     }
 
-    juce::int64 getNextReadPosition() const override
+    int process (double ratio, const float* input, float* output, int numOutputSamples, int numInputSamples) noexcept override
     {
-        PYBIND11_OVERRIDE_PURE (juce::int64, PyAudioSource<Base>, getNextReadPosition);
+        return interpolator.process (ratio, input, output, numOutputSamples, numInputSamples, 0);
     }
 
-    juce::int64 getTotalLength() const override
+    void reset() noexcept override
     {
-        PYBIND11_OVERRIDE_PURE (juce::int64, PyAudioSource<Base>, getTotalLength);
+        interpolator.reset();
     }
 
-    bool isLooping() const override
+private:
+    Interpolator interpolator;
+};
+
+inline std::unique_ptr<ChannelInterpolator> ChannelInterpolator::create (ResamplingInterpolator type)
+{
+    switch (type)
+    {
+        case ResamplingInterpolator::zeroOrderHold: return std::make_unique<TypedChannelInterpolator<juce::ZeroOrderHoldInterpolator>>();
+        case ResamplingInterpolator::linear:        return std::make_unique<TypedChannelInterpolator<juce::LinearInterpolator>>();
+        case ResamplingInterpolator::catmullRom:    return std::make_unique<TypedChannelInterpolator<juce::CatmullRomInterpolator>>();
+        case ResamplingInterpolator::lagrange:      return std::make_unique<TypedChannelInterpolator<juce::LagrangeInterpolator>>();
+        case ResamplingInterpolator::windowedSinc:  return std::make_unique<TypedChannelInterpolator<juce::WindowedSincInterpolator>>();
+    }
+
+    return std::make_unique<TypedChannelInterpolator<juce::LagrangeInterpolator>>();
+}
+
+/** Returns the number of samples of a resampled signal, the ratio being the input over the output rate. */
+inline juce::int64 getResampledLength (juce::int64 numInputSamples, double ratio) noexcept
+{
+    return ratio != 1.0 ? static_cast<juce::int64> (std::llround (static_cast<double> (numInputSamples) / ratio)) : numInputSamples;
+}
+
+/**
+ * @brief Resamples a whole channel in one go with a juce interpolator.
+ *
+ * The interpolator is first fed with as many samples as its latency, so that the output starts aligned with the input
+ * instead of being delayed. Reads past the end of the input are zeros. The ratio is the input over the output rate.
+ */
+inline void resampleChannel (ResamplingInterpolator type, const float* input, int numInputSamples, float* output, int numOutputSamples, double ratio)
+{
+    auto interpolator = ChannelInterpolator::create (type);
+
+    // The priming output is discarded, so it goes to the output buffer which is overwritten right after
+    const auto latency = interpolator->getLatency();
+    for (int primed = 0; primed < latency && numOutputSamples > 0;)
+    {
+        const auto numToPrime = juce::jmin (latency - primed, numOutputSamples);
+        const auto firstInput = juce::jmin (primed, numInputSamples);
+        interpolator->process (1.0, input + firstInput, output, numToPrime, numInputSamples - firstInput);
+        primed += numToPrime;
+    }
+
+    const auto numPrimed = juce::jmin (latency, numInputSamples);
+    interpolator->process (ratio, input + numPrimed, output, numOutputSamples, numInputSamples - numPrimed);
+}
+
+/**
+ * @brief Resamples all the channels, in parallel on the threads of the pool.
+ *
+ * When no pool is given, large multichannel inputs are spread on a temporary pool. Called without the GIL.
+ */
+void resampleChannels (ResamplingInterpolator type, const float* const* input, int numChannels, int numInputSamples,
+                       float* const* output, int numOutputSamples, double ratio, juce::ThreadPool* pool);
+
+/**
+ * @brief Calls function (channel) for all the channels, spreading them on the threads of the pool when one is given.
+ *
+ * The first channel is processed on the calling thread, which then waits for the others to finish.
+ */
+template <class F>
+void forEachChannel (int numChannels, juce::ThreadPool* pool, F&& function)
+{
+    if (pool == nullptr || numChannels < 2)
+    {
+        for (int channel = 0; channel < numChannels; ++channel)
+            function (channel);
+
+        return;
+    }
+
+    std::atomic<int> numRemaining { numChannels - 1 };
+    juce::WaitableEvent finished;
+
+    for (int channel = 1; channel < numChannels; ++channel)
+    {
+        pool->addJob ([&, channel]
+        {
+            function (channel);
+
+            if (--numRemaining == 0)
+                finished.signal();
+        });
+    }
+
+    function (0);
+    finished.wait();
+}
+
+// =================================================================================================
+
+/**
+ * @brief Resamples a multichannel stream pushed in chunks of any size, keeping the interpolators state in between.
+ *
+ * Input samples that can't be consumed yet are kept for the next chunk, and flushing produces the remaining output
+ * from zeros, so that the concatenation of all the chunks equals the result of resampling the whole signal at once.
+ * The pending samples are preallocated for chunks up to maximumBlockSize, larger chunks grow them while processing.
+ */
+class PyStreamingResampler
+{
+public:
+    PyStreamingResampler (int numChannels, double sourceSampleRate, double targetSampleRate, ResamplingInterpolator type, int maximumBlockSize)
+        : sourceRate (sourceSampleRate)
+        , targetRate (targetSampleRate)
+        , ratio (sourceSampleRate / targetSampleRate)
+    {
+        for (int channel = 0; channel < numChannels; ++channel)
+            interpolators.push_back (ChannelInterpolator::create (type));
+
+        latency = interpolators.empty() ? 0 : interpolators.front()->getLatency();
+        primingOutput.allocate (static_cast<size_t> (juce::jmax (1, latency)), false);
+
+        // Between chunks at most latency samples are kept before priming, and less than ratio + 1 after it
+        const auto maxKeptSamples = juce::jmax (latency, static_cast<int> (std::ceil (ratio)) + 1);
+        pending.setSize (numChannels, maximumBlockSize + maxKeptSamples);
+    }
+
+    int getNumChannels() const noexcept
+    {
+        return static_cast<int> (interpolators.size());
+    }
+
+    double getSourceSampleRate() const noexcept
+    {
+        return sourceRate;
+    }
+
+    double getTargetSampleRate() const noexcept
+    {
+        return targetRate;
+    }
+
+    /** Returns the number of input samples kept from the previous chunks. */
+    int getNumPendingSamples() const noexcept
+    {
+        return numPending;
+    }
+
+    /** Returns the number of samples the next call to process will produce from numInputSamples samples. */
+    int getNumOutputSamples (int numInputSamples) const noexcept
+    {
+        auto available = numPending + numInputSamples;
+
+        if (! primed)
+        {
+            if (available < latency)
+                return 0;
+
+            available -= latency;
+        }
+
+        auto simulatedPosition = position;
+        return advance (simulatedPosition, available);
+    }
+
+    /** Returns the number of samples the next call to flush will produce. */
+    int getNumFlushSamples() const noexcept
+    {
+        return static_cast<int> (juce::jmax (juce::int64 (0), getResampledLength (numInputSamplesSeen, ratio) - numOutputSamplesProduced));
+    }
+
+    /**
+     * Resamples a chunk, output must have room for getNumOutputSamples (numInputSamples) samples, which are returned.
+     *
+     * Only allocates when the chunk is larger than the maximum block size the resampler was created with.
+     */
+    int process (const float* const* input, int numInputSamples, float* const* output)
+    {
+        const auto numOutputSamples = getNumOutputSamples (numInputSamples);
+
+        if (numPending + numInputSamples > pending.getNumSamples())
+            pending.setSize (getNumChannels(), numPending + numInputSamples, true);
+
+        for (int channel = 0; channel < getNumChannels() && numInputSamples > 0; ++channel)
+            pending.copyFrom (channel, numPending, input[channel], numInputSamples);
+
+        const auto available = numPending + numInputSamples;
+        numInputSamplesSeen += numInputSamples;
+
+        if (! primed)
+        {
+            if (available < latency)
+            {
+                numPending = available;
+                return 0;
+            }
+
+            prime (available);
+        }
+
+        const auto start = consumedForPriming;
+        const auto remaining = available - start;
+
+        auto numUsed = 0;
+        for (int channel = 0; channel < getNumChannels(); ++channel)
+            numUsed = interpolators[static_cast<size_t> (channel)]->process (ratio, pending.getReadPointer (channel) + start, output[channel], numOutputSamples, remaining);
+
+        advance (position, remaining);
+
+        keepPending (start + numUsed, available);
+        numOutputSamplesProduced += numOutputSamples;
+        return numOutputSamples;
+    }
+
+    /** Produces the remaining output from the pending samples followed by zeros, then resets the stream. */
+    int flush (float* const* output) noexcept
+    {
+        const auto numOutputSamples = getNumFlushSamples();
+
+        if (! primed)
+            prime (numPending);
+
+        const auto start = consumedForPriming;
+        for (int channel = 0; channel < getNumChannels(); ++channel)
+            interpolators[static_cast<size_t> (channel)]->process (ratio, pending.getReadPointer (channel) + start, output[channel], numOutputSamples, numPending - start);
+
+        reset();
+        return numOutputSamples;
+    }
+
+    /** Forgets the pending samples and the state of the interpolators. */
+    void reset() noexcept
+    {
+        for (auto& interpolator : interpolators)
+            interpolator->reset();
+
+        numPending = 0;
+        consumedForPriming = 0;
+        primed = false;
+        position = 1.0;
+        numInputSamplesSeen = 0;
+        numOutputSamplesProduced = 0;
+    }
+
+private:
+    /** Mirrors the position update of the juce interpolators, returning how many samples can be produced without running out of input. */
+    int advance (double& pos, int numInputSamples) const noexcept
+    {
+        int numOutputSamples = 0;
+        int numUsed = 0;
+
+        for (;;)
+        {
+            auto nextPos = pos;
+            auto nextUsed = numUsed;
+
+            while (nextPos >= 1.0)
+            {
+                nextPos -= 1.0;
+                ++nextUsed;
+            }
+
+            if (nextUsed > numInputSamples)
+                break;
+
+            pos = nextPos + ratio;
+            numUsed = nextUsed;
+            ++numOutputSamples;
+        }
+
+        return numOutputSamples;
+    }
+
+    void prime (int available) noexcept
+    {
+        for (int channel = 0; channel < getNumChannels(); ++channel)
+            interpolators[static_cast<size_t> (channel)]->process (1.0, pending.getReadPointer (channel), primingOutput.get(), latency, available);
+
+        consumedForPriming = juce::jmin (latency, available);
+        primed = true;
+    }
+
+    void keepPending (int firstKept, int available) noexcept
+    {
+        numPending = available - firstKept;
+
+        for (int channel = 0; channel < getNumChannels(); ++channel)
+            std::memmove (pending.getWritePointer (channel), pending.getReadPointer (channel) + firstKept, sizeof (float) * static_cast<size_t> (numPending));
+
+        consumedForPriming = 0;
+    }
+
+    double sourceRate;
+    double targetRate;
+    double ratio;
+    int latency = 0;
+
+    juce::AudioBuffer<float> pending;
+    std::vector<std::unique_ptr<ChannelInterpolator>> interpolators;
+    juce::HeapBlock<float> primingOutput;
+    int numPending = 0;
+    int consumedForPriming = 0;
+    bool primed = false;
+    double position = 1.0;
+    juce::int64 numInputSamplesSeen = 0;
+    juce::int64 numOutputSamplesProduced = 0;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (PyStreamingResampler)
+};
+
+// =================================================================================================
+
+struct PyAudioPlayHead : juce::AudioPlayHead
+{
+    using juce::AudioPlayHead::AudioPlayHead;
+
+    juce::Optional<juce::AudioPlayHead::PositionInfo> getPosition() const override
+    {
+        POPSICLE_OVERRIDE_PURE (juce::Optional<juce::AudioPlayHead::PositionInfo>, juce::AudioPlayHead, getPosition);
+    }
+
+    bool canControlTransport() override
+    {
+        POPSICLE_OVERRIDE (bool, juce::AudioPlayHead, canControlTransport);
+    }
+
+    void transportPlay (bool shouldStartPlaying) override
+    {
+        POPSICLE_OVERRIDE (void, juce::AudioPlayHead, transportPlay, shouldStartPlaying);
+    }
+
+    void transportRecord (bool shouldStartRecording) override
+    {
+        POPSICLE_OVERRIDE (void, juce::AudioPlayHead, transportRecord, shouldStartRecording);
+    }
+
+    void transportRewind() override
     {
-        PYBIND11_OVERRIDE_PURE (bool, PyAudioSource<Base>, isLooping);
+        POPSICLE_OVERRIDE (void, juce::AudioPlayHead, transportRewind);
     }
 };
 
+// =================================================================================================
+
+/**
+ * @brief Lock-free histogram of durations, recorded on the audio thread and read from python.
+ *
+ * Durations are binned in microseconds on a logarithmic scale with four buckets per octave, up to about 16 seconds.
+ * Percentiles are reported as the upper bound of the bucket they fall in, clamped to the largest recorded duration.
+ */
+class PyTimingHistogram
+{
+public:
+    static constexpr int numBuckets = 96;
+    static constexpr int bucketsPerOctave = 4;
+
+    void record (double microseconds) noexcept
+    {
+        microseconds = juce::jmax (0.0, microseconds);
+
+        const auto index = juce::jlimit (0, numBuckets - 1, static_cast<int> (std::log2 (1.0 + microseconds) * bucketsPerOctave));
+        buckets[static_cast<size_t> (index)].fetch_add (1, std::memory_order_relaxed);
+
+        const auto nanoseconds = static_cast<juce::int64> (microseconds * 1000.0);
+        count.fetch_add (1, std::memory_order_relaxed);
+        totalNanoseconds.fetch_add (nanoseconds, std::memory_order_relaxed);
+
+        auto currentMax = maxNanoseconds.load (std::memory_order_relaxed);
+        while (nanoseconds > currentMax && ! maxNanoseconds.compare_exchange_weak (currentMax, nanoseconds, std::memory_order_relaxed))
+            ;
+    }
+
+    void reset() noexcept
+    {
+        for (auto& bucket : buckets)
+            bucket.store (0, std::memory_order_relaxed);
+
+        count.store (0, std::memory_order_relaxed);
+        totalNanoseconds.store (0, std::memory_order_relaxed);
+        maxNanoseconds.store (0, std::memory_order_relaxed);
+    }
+
+    juce::int64 getCount() const noexcept
+    {
+        return count.load (std::memory_order_relaxed);
+    }
+
+    double getMeanMicroseconds() const noexcept
+    {
+        const auto numRecorded = getCount();
+        return numRecorded > 0 ? static_cast<double> (totalNanoseconds.load (std::memory_order_relaxed)) / (1000.0 * static_cast<double> (numRecorded)) : 0.0;
+    }
+
+    double getMaxMicroseconds() const noexcept
+    {
+        return static_cast<double> (maxNanoseconds.load (std::memory_order_relaxed)) / 1000.0;
+    }
+
+    /** Returns the given percentile (0 to 100) of the recorded durations, in microseconds. */
+    double getPercentileMicroseconds (double percentile) const noexcept
+    {
+        std::array<juce::int64, numBuckets> snapshot;
+        juce::int64 numRecorded = 0;
+
+        for (size_t i = 0; i < snapshot.size(); ++i)
+        {
+            snapshot[i] = buckets[i].load (std::memory_order_relaxed);
+            numRecorded += snapshot[i];
+        }
+
+        if (numRecorded == 0)
+            return 0.0;
+
+        const auto target = juce::jmax (juce::int64 (1), static_cast<juce::int64> (std::ceil (static_cast<double> (numRecorded) * juce::jlimit (0.0, 100.0, percentile) / 100.0)));
+
+        juce::int64 accumulated = 0;
+        for (size_t i = 0; i < snapshot.size(); ++i)
+        {
+            accumulated += snapshot[i];
+            if (accumulated >= target)
+                return juce::jmin (std::exp2 (static_cast<double> (i + 1) / bucketsPerOctave) - 1.0, getMaxMicroseconds());
+        }
+
+        return getMaxMicroseconds();
+    }
+
+    /** Returns count, mean, max and the 50th, 90th, 99th and 99.9th percentiles in microseconds. Must be called with the GIL held. */
+    pybind11::dict toDict() const
+    {
+        pybind11::dict result;
+        result["count"] = getCount();
+        result["mean"] = getMeanMicroseconds();
+        result["max"] = getMaxMicroseconds();
+        result["p50"] = getPercentileMicroseconds (50.0);
+        result["p90"] = getPercentileMicroseconds (90.0);
+        result["p99"] = getPercentileMicroseconds (99.0);
+        result["p999"] = getPercentileMicroseconds (99.9);
+        return result;
+    }
+
+private:
+    std::array<std::atomic<juce::int64>, numBuckets> buckets {};
+    std::atomic<juce::int64> count { 0 };
+    std::atomic<juce::int64> totalNanoseconds { 0 };
+    std::atomic<juce::int64> maxNanoseconds { 0 };
+};
+
+// =================================================================================================
+
+/**
+ * @brief Optional per block timing of the python audio callbacks.
+ *
+ * When enabled, every block rendered through python records the time spent waiting for the GIL, the time spent in the
+ * python override (argument conversion included) and the total time of the callback. The totals also feed a
+ * juce::AudioProcessLoadMeasurer, prepared with the sample rate and block size of the callback.
+ *
+ * The load measurer is only ever touched by the audio thread: prepare and reset post a request that is handled before
+ * the next block is registered, and the load and xruns are published back through atomics.
+ */
+class PyCallbackTimingStats
+{
+public:
+    /** Measures a single block, from its construction to its destruction. */
+    class ScopedBlock
+    {
+    public:
+        ScopedBlock (PyCallbackTimingStats& stats, int numSamples) noexcept
+            : stats (stats.isEnabled() ? &stats : nullptr)
+            , numSamples (numSamples)
+            , startTicks (this->stats != nullptr ? juce::Time::getHighResolutionTicks() : 0)
+        {
+        }
+
+        ~ScopedBlock()
+        {
+            if (stats != nullptr && gilTicks != 0 && pythonTicks != 0)
+                stats->record (startTicks, gilTicks, pythonTicks, juce::Time::getHighResolutionTicks(), numSamples);
+        }
+
+        void gilAcquired() noexcept
+        {
+            if (stats != nullptr)
+                gilTicks = juce::Time::getHighResolutionTicks();
+        }
+
+        void pythonFinished() noexcept
+        {
+            if (stats != nullptr)
+                pythonTicks = juce::Time::getHighResolutionTicks();
+        }
+
+    private:
+        PyCallbackTimingStats* stats = nullptr;
+        int numSamples = 0;
+        juce::int64 startTicks = 0, gilTicks = 0, pythonTicks = 0;
+
+        JUCE_DECLARE_NON_COPYABLE (ScopedBlock)
+    };
+
+    void setEnabled (bool shouldBeEnabled) noexcept
+    {
+        enabled.store (shouldBeEnabled);
+    }
+
+    bool isEnabled() const noexcept
+    {
+        return enabled.load (std::memory_order_relaxed);
+    }
+
+    void prepare (double newSampleRate, int newBlockSize)
+    {
+        sampleRate.store (newSampleRate);
+        blockSize.store (newBlockSize);
+
+        resetLoadMeasurer();
+    }
+
+    void reset()
+    {
+        gilWait.reset();
+        python.reset();
+        total.reset();
+
+        resetLoadMeasurer();
+    }
+
+    /** Returns the gil, python and total histograms along with the load and xruns. Must be called with the GIL held. */
+    pybind11::dict toDict() const
+    {
+        pybind11::dict result;
+        result["gil"] = gilWait.toDict();
+        result["python"] = python.toDict();
+        result["total"] = total.toDict();
+        result["load"] = load.load (std::memory_order_relaxed);
+        result["xruns"] = xruns.load (std::memory_order_relaxed);
+        return result;
+    }
+
+private:
+    void resetLoadMeasurer() noexcept
+    {
+        load.store (0.0, std::memory_order_relaxed);
+        xruns.store (0, std::memory_order_relaxed);
+
+        loadMeasurerResetRequested.store (true, std::memory_order_release);
+    }
+
+    void record (juce::int64 startTicks, juce::int64 gilTicks, juce::int64 pythonTicks, juce::int64 endTicks, int numSamples) noexcept
+    {
+        const auto toMicroseconds = [] (juce::int64 ticks) { return juce::Time::highResolutionTicksToSeconds (ticks) * 1.0e6; };
+
+        gilWait.record (toMicroseconds (gilTicks - startTicks));
+        python.record (toMicroseconds (pythonTicks - gilTicks));
+        total.record (toMicroseconds (endTicks - startTicks));
+
+        if (loadMeasurerResetRequested.exchange (false, std::memory_order_acquire))
+            loadMeasurer.reset (sampleRate.load(), blockSize.load());
+
+        loadMeasurer.registerRenderTime (toMicroseconds (endTicks - startTicks) / 1000.0, numSamples);
+
+        load.store (loadMeasurer.getLoadAsProportion(), std::memory_order_relaxed);
+        xruns.store (loadMeasurer.getXRunCount(), std::memory_order_relaxed);
+    }
+
+    std::atomic<bool> enabled { false };
+    std::atomic<double> sampleRate { 0.0 };
+    std::atomic<int> blockSize { 0 };
+    PyTimingHistogram gilWait, python, total;
+    juce::AudioProcessLoadMeasurer loadMeasurer;
+    std::atomic<bool> loadMeasurerResetRequested { false };
+    std::atomic<double> load { 0.0 };
+    std::atomic<int> xruns { 0 };
+};
+
+/** Owns the timing stats of python subclasses, so they can be reached from the non templated bound classes. */
+struct PyCallbackTimingStatsHolder
+{
+    virtual ~PyCallbackTimingStatsHolder() = default;
+
+    PyCallbackTimingStats timingStats;
+};
+
+/** Binds the timing stats accessors on a class whose python subclasses derive from PyCallbackTimingStatsHolder. */
+template <class T, class... Options>
+void bindCallbackTimingStats (pybind11::class_<T, Options...>& classT)
+{
+    namespace py = pybind11;
+    using namespace py::literals;
+
+    classT
+        .def ("setTimingEnabled", [](T& self, bool shouldBeEnabled)
+        {
+            auto holder = dynamic_cast<PyCallbackTimingStatsHolder*> (&self);
+            if (holder == nullptr)
+                throw py::type_error ("Timing stats can only be enabled on python subclasses");
+
+            holder->timingStats.setEnabled (shouldBeEnabled);
+        }, "shouldBeEnabled"_a)
+        .def ("isTimingEnabled", [](const T& self)
+        {
+            auto holder = dynamic_cast<const PyCallbackTimingStatsHolder*> (&self);
+            return holder != nullptr && holder->timingStats.isEnabled();
+        })
+        .def ("getTimingStats", [](const T& self) -> py::object
+        {
+            auto holder = dynamic_cast<const PyCallbackTimingStatsHolder*> (&self);
+            return holder != nullptr ? py::object (holder->timingStats.toDict()) : py::object (py::none());
+        })
+        .def ("resetTimingStats", [](T& self)
+        {
+            if (auto holder = dynamic_cast<PyCallbackTimingStatsHolder*> (&self))
+                holder->timingStats.reset();
+        })
+    ;
+}
+
+// =================================================================================================
+
+/**
+ * @brief A fixed set of named float parameters shared between python and the audio thread without locks.
+ *
+ * The target values live in a cache line aligned array of atomics: python (or any other thread) stores them without
+ * blocking, and native code can read them directly from getValuesAddress(), like the raw parameter values of an
+ * AudioProcessorValueTreeState. Each parameter can also ramp linearly towards its target over a smoothing time: the
+ * smoothed values are advanced by getNextValue, skip and fillSmoothedValues, which are meant to be called by a single
+ * consumer on the audio thread and never take the GIL.
+ */
+class PyParameterBlock
+{
+public:
+    using GetValueFunction = float (*) (void* block, int index);
+    using FillSmoothedValuesFunction = void (*) (void* block, int index, float* destination, int numSamples);
+
+    explicit PyParameterBlock (const juce::StringArray& parameterNames, const juce::Array<float>& defaultValues = {})
+        : names (parameterNames)
+        , valueLines (new ValueLine[static_cast<size_t> (getNumValueLines (parameterNames.size()))])
+        , smoothers (static_cast<size_t> (parameterNames.size()))
+    {
+        for (int index = 0; index < names.size(); ++index)
+        {
+            const auto defaultValue = index < defaultValues.size() ? defaultValues.getUnchecked (index) : 0.0f;
+
+            getTarget (index).store (defaultValue, std::memory_order_relaxed);
+            smoothers[static_cast<size_t> (index)].smoothedValue.setCurrentAndTargetValue (defaultValue);
+        }
+    }
+
+    int getNumParameters() const noexcept
+    {
+        return names.size();
+    }
+
+    const juce::StringArray& getParameterNames() const noexcept
+    {
+        return names;
+    }
+
+    /** Returns the index of the named parameter, or -1 if there isn't one. */
+    int getParameterIndex (juce::StringRef name) const noexcept
+    {
+        return names.indexOf (name);
+    }
+
+    bool isValidIndex (int index) const noexcept
+    {
+        return juce::isPositiveAndBelow (index, names.size());
+    }
+
+    /** Stores a new target value, the smoothed value will start ramping towards it on the next read. Thread safe. */
+    void setValue (int index, float newValue) noexcept
+    {
+        jassert (isValidIndex (index));
+        getTarget (index).store (newValue, std::memory_order_release);
+    }
+
+    /** Returns the last stored target value. Thread safe. */
+    float getValue (int index) const noexcept
+    {
+        jassert (isValidIndex (index));
+        return getTarget (index).load (std::memory_order_acquire);
+    }
+
+    /** Sets the length of the ramp towards new target values, zero disables smoothing. Thread safe. */
+    void setSmoothingTime (int index, double seconds) noexcept
+    {
+        jassert (isValidIndex (index));
+        smoothers[static_cast<size_t> (index)].smoothingSeconds.store (juce::jmax (0.0, seconds), std::memory_order_relaxed);
+    }
+
+    double getSmoothingTime (int index) const noexcept
+    {
+        jassert (isValidIndex (index));
+        return smoothers[static_cast<size_t> (index)].smoothingSeconds.load (std::memory_order_relaxed);
+    }
+
+    /** Sets the sample rate the smoothing times are converted with. */
+    void prepare (double newSampleRate) noexcept
+    {
+        sampleRate.store (newSampleRate, std::memory_order_relaxed);
+    }
+
+    double getSampleRate() const noexcept
+    {
+        return sampleRate.load (std::memory_order_relaxed);
+    }
+
+    /** Advances the smoothed value by one sample and returns it. Audio thread only. */
+    float getNextValue (int index) noexcept
+    {
+        return synchronise (index).getNextValue();
+    }
+
+    /** Advances the smoothed value by a number of samples and returns it. Audio thread only. */
+    float skip (int index, int numSamples) noexcept
+    {
+        return synchronise (index).skip (numSamples);
+    }
+
+    /** Writes the next smoothed values into destination, advancing them by numSamples. Audio thread only. */
+    void fillSmoothedValues (int index, float* destination, int numSamples) noexcept
+    {
+        auto& smoothedValue = synchronise (index);
+
+        if (! smoothedValue.isSmoothing())
+        {
+            juce::FloatVectorOperations::fill (destination, smoothedValue.getCurrentValue(), numSamples);
+            return;
+        }
+
+        for (int sample = 0; sample < numSamples; ++sample)
+            destination[sample] = smoothedValue.getNextValue();
+    }
+
+    /** Returns true if the smoothed value is still ramping towards its target. Audio thread only. */
+    bool isSmoothing (int index) noexcept
+    {
+        return synchronise (index).isSmoothing();
+    }
+
+    /** Returns the contiguous array of target values, that native code can read directly. */
+    const std::atomic<float>* getValuesAddress() const noexcept
+    {
+        return valueLines[0].values;
+    }
+
+    /**
+     * C entry points for native callbacks, taking the address of the block as first argument.
+     *
+     * Native code can't be trusted with the indices, so out of range ones read zeros instead of reaching past the block.
+     */
+    static float getValueCallback (void* block, int index) noexcept
+    {
+        auto* self = static_cast<PyParameterBlock*> (block);
+        return self->isValidIndex (index) ? self->getValue (index) : 0.0f;
+    }
+
+    static float getNextValueCallback (void* block, int index) noexcept
+    {
+        auto* self = static_cast<PyParameterBlock*> (block);
+        return self->isValidIndex (index) ? self->getNextValue (index) : 0.0f;
+    }
+
+    static void fillSmoothedValuesCallback (void* block, int index, float* destination, int numSamples) noexcept
+    {
+        if (destination == nullptr || numSamples <= 0)
+            return;
+
+        auto* self = static_cast<PyParameterBlock*> (block);
+
+        if (self->isValidIndex (index))
+            self->fillSmoothedValues (index, destination, numSamples);
+        else
+            juce::FloatVectorOperations::clear (destination, numSamples);
+    }
+
+private:
+    static constexpr int valuesPerLine = 16;
+
+    struct alignas (64) ValueLine
+    {
+        std::atomic<float> values[valuesPerLine] {};
+    };
+
+    static_assert (sizeof (ValueLine) == 64);
+    static_assert (std::atomic<float>::is_always_lock_free && sizeof (std::atomic<float>) == sizeof (float));
+
+    struct Smoother
+    {
+        juce::SmoothedValue<float> smoothedValue;
+        std::atomic<double> smoothingSeconds { 0.0 };
+        int rampLengthInSamples = 0;
+    };
+
+    static int getNumValueLines (int numParameters) noexcept
+    {
+        return juce::jmax (1, (numParameters + valuesPerLine - 1) / valuesPerLine);
+    }
+
+    std::atomic<float>& getTarget (int index) const noexcept
+    {
+        return valueLines[static_cast<size_t> (index / valuesPerLine)].values[index % valuesPerLine];
+    }
+
+    juce::SmoothedValue<float>& synchronise (int index) noexcept
+    {
+        jassert (isValidIndex (index));
+
+        auto& smoother = smoothers[static_cast<size_t> (index)];
+        const auto target = getTarget (index).load (std::memory_order_acquire);
+
+        if (target != smoother.smoothedValue.getTargetValue())
+        {
+            const auto rampLengthInSamples = juce::roundToInt (smoother.smoothingSeconds.load (std::memory_order_relaxed) * getSampleRate());
+
+            if (rampLengthInSamples != smoother.rampLengthInSamples)
+            {
+                smoother.rampLengthInSamples = rampLengthInSamples;
+                smoother.smoothedValue.reset (rampLengthInSamples);
+            }
+
+            smoother.smoothedValue.setTargetValue (target);
+        }
+
+        return smoother.smoothedValue;
+    }
+
+    juce::StringArray names;
+    std::unique_ptr<ValueLine[]> valueLines;
+    std::vector<Smoother> smoothers;
+    std::atomic<double> sampleRate { 44100.0 };
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (PyParameterBlock)
+};
+
+// =================================================================================================
+
+/**
+ * @brief Single producer, single consumer ring buffer of audio frames, built on a juce::AbstractFifo.
+ *
+ * Pushing and popping copy the samples straight between the caller buffers and the ring, without allocating or
+ * locking, so one side can live on the audio thread and the other on the message thread. The C entry points take the
+ * address of the fifo as first argument and never touch python.
+ */
+class PyAudioFifo
+{
+public:
+    using PushFunction = int (*) (void* fifo, const float* const* channels, int numChannels, int numSamples);
+    using PopFunction = int (*) (void* fifo, float* const* channels, int numChannels, int numSamples);
+
+    PyAudioFifo (int numChannels, int capacity)
+        : fifo (capacity + 1)
+        , buffer (numChannels, capacity + 1)
+    {
+        buffer.clear();
+    }
+
+    int getNumChannels() const noexcept
+    {
+        return buffer.getNumChannels();
+    }
+
+    int getCapacity() const noexcept
+    {
+        return fifo.getTotalSize() - 1;
+    }
+
+    int getNumReady() const noexcept
+    {
+        return fifo.getNumReady();
+    }
+
+    int getFreeSpace() const noexcept
+    {
+        return fifo.getFreeSpace();
+    }
+
+    /** Discards all the frames ready to be read. Must not be called while pushing or popping. */
+    void reset() noexcept
+    {
+        fifo.reset();
+    }
+
+    /** Writes up to numSamples frames, returning how many fitted. Missing channels are written as silence. */
+    int push (const float* const* channels, int numChannels, int numSamples) noexcept
+    {
+        const auto scope = fifo.write (numSamples);
+
+        copyIntoRing (channels, numChannels, scope.startIndex1, 0, scope.blockSize1);
+        copyIntoRing (channels, numChannels, scope.startIndex2, scope.blockSize1, scope.blockSize2);
+
+        return scope.blockSize1 + scope.blockSize2;
+    }
+
+    /** Reads up to numSamples frames, returning how many were available. Extra channels are left untouched. */
+    int pop (float* const* channels, int numChannels, int numSamples) noexcept
+    {
+        const auto scope = fifo.read (numSamples);
+
+        copyFromRing (channels, numChannels, scope.startIndex1, 0, scope.blockSize1);
+        copyFromRing (channels, numChannels, scope.startIndex2, scope.blockSize1, scope.blockSize2);
+
+        return scope.blockSize1 + scope.blockSize2;
+    }
+
+    static int pushCallback (void* fifo, const float* const* channels, int numChannels, int numSamples) noexcept
+    {
+        return static_cast<PyAudioFifo*> (fifo)->push (channels, numChannels, numSamples);
+    }
+
+    static int popCallback (void* fifo, float* const* channels, int numChannels, int numSamples) noexcept
+    {
+        return static_cast<PyAudioFifo*> (fifo)->pop (channels, numChannels, numSamples);
+    }
+
+private:
+    void copyIntoRing (const float* const* channels, int numChannels, int ringIndex, int sourceIndex, int numSamples) noexcept
+    {
+        if (numSamples <= 0)
+            return;
+
+        for (int channel = 0; channel < buffer.getNumChannels(); ++channel)
+        {
+            if (channel < numChannels && channels[channel] != nullptr)
+                buffer.copyFrom (channel, ringIndex, channels[channel] + sourceIndex, numSamples);
+            else
+                buffer.clear (channel, ringIndex, numSamples);
+        }
+    }
+
+    void copyFromRing (float* const* channels, int numChannels, int ringIndex, int destIndex, int numSamples) const noexcept
+    {
+        if (numSamples <= 0)
+            return;
+
+        for (int channel = 0; channel < juce::jmin (numChannels, buffer.getNumChannels()); ++channel)
+        {
+            if (channels[channel] != nullptr)
+                juce::FloatVectorOperations::copy (channels[channel] + destIndex, buffer.getReadPointer (channel, ringIndex), numSamples);
+        }
+    }
+
+    juce::AbstractFifo fifo;
+    juce::AudioBuffer<float> buffer;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (PyAudioFifo)
+};
+
+// =================================================================================================
+
+/**
+ * @brief Single producer, single consumer ring buffer of fixed size records, built on a juce::AbstractFifo.
+ *
+ * Records are opaque blocks of bytes (a meter reading, an FFT frame, a struct) copied in and out in bulk, without
+ * allocating or locking. The C entry points take the address of the fifo as first argument and never touch python.
+ */
+class PyRecordFifo
+{
+public:
+    using PushFunction = int (*) (void* fifo, const void* records, int numRecords);
+    using PopFunction = int (*) (void* fifo, void* records, int maxRecords);
+
+    PyRecordFifo (int capacity, int recordSizeInBytes)
+        : fifo (capacity + 1)
+        , recordSize (recordSizeInBytes)
+        , storage (static_cast<size_t> (capacity + 1) * static_cast<size_t> (recordSizeInBytes), true)
+    {
+        jassert (recordSize > 0);
+    }
+
+    virtual ~PyRecordFifo() = default;
+
+    int getCapacity() const noexcept
+    {
+        return fifo.getTotalSize() - 1;
+    }
+
+    /** Returns the size of a single record, in bytes. */
+    int getRecordSize() const noexcept
+    {
+        return recordSize;
+    }
+
+    int getNumReady() const noexcept
+    {
+        return fifo.getNumReady();
+    }
+
+    int getFreeSpace() const noexcept
+    {
+        return fifo.getFreeSpace();
+    }
+
+    /** Discards all the records ready to be read. Must not be called while pushing or popping. */
+    void reset() noexcept
+    {
+        fifo.reset();
+    }
+
+    /** Writes up to numRecords consecutive records, returning how many fitted. */
+    int push (const void* records, int numRecords) noexcept
+    {
+        const auto scope = fifo.write (numRecords);
+        const auto* source = static_cast<const char*> (records);
+
+        copyBytes (getRecord (scope.startIndex1), source, scope.blockSize1);
+        copyBytes (getRecord (scope.startIndex2), source + getNumBytes (scope.blockSize1), scope.blockSize2);
+
+        return scope.blockSize1 + scope.blockSize2;
+    }
+
+    /** Reads up to maxRecords consecutive records, returning how many were available. */
+    int pop (void* records, int maxRecords) noexcept
+    {
+        const auto scope = fifo.read (maxRecords);
+        auto* destination = static_cast<char*> (records);
+
+        copyBytes (destination, getRecord (scope.startIndex1), scope.blockSize1);
+        copyBytes (destination + getNumBytes (scope.blockSize1), getRecord (scope.startIndex2), scope.blockSize2);
+
+        return scope.blockSize1 + scope.blockSize2;
+    }
+
+    static int pushCallback (void* fifo, const void* records, int numRecords) noexcept
+    {
+        return static_cast<PyRecordFifo*> (fifo)->push (records, numRecords);
+    }
+
+    static int popCallback (void* fifo, void* records, int maxRecords) noexcept
+    {
+        return static_cast<PyRecordFifo*> (fifo)->pop (records, maxRecords);
+    }
+
+private:
+    size_t getNumBytes (int numRecords) const noexcept
+    {
+        return static_cast<size_t> (numRecords) * static_cast<size_t> (recordSize);
+    }
+
+    char* getRecord (int index) const noexcept
+    {
+        return storage.get() + getNumBytes (index);
+    }
+
+    void copyBytes (void* destination, const void* source, int numRecords) const noexcept
+    {
+        if (numRecords > 0)
+            std::memcpy (destination, source, getNumBytes (numRecords));
+    }
+
+    juce::AbstractFifo fifo;
+    int recordSize = 0;
+    juce::HeapBlock<char> storage;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (PyRecordFifo)
+};
+
+// =================================================================================================
+
+template <class Base = juce::AudioSource>
+struct PyAudioSource : Base, PyCallbackTimingStatsHolder
+{
+    using Base::Base;
+
+    void prepareToPlay (int newSamplesPerBlockExpected, double newSampleRate) override
+    {
+        timingStats.prepare (newSampleRate, newSamplesPerBlockExpected);
+
+        if constexpr (std::is_abstract_v<Base>)
+            POPSICLE_OVERRIDE_PURE (void, Base, prepareToPlay, newSamplesPerBlockExpected, newSampleRate);
+        else
+            POPSICLE_OVERRIDE (void, Base, prepareToPlay, newSamplesPerBlockExpected, newSampleRate);
+    }
+
+    void releaseResources() override
+    {
+        if constexpr (std::is_abstract_v<Base>)
+            POPSICLE_OVERRIDE_PURE (void, Base, releaseResources);
+        else
+            POPSICLE_OVERRIDE (void, Base, releaseResources);
+    }
+
+    void getNextAudioBlock (const juce::AudioSourceChannelInfo& bufferToFill) override
+    {
+        {
+            PyCallbackTimingStats::ScopedBlock timedBlock (timingStats, bufferToFill.numSamples);
+
+            pybind11::gil_scoped_acquire gil;
+            timedBlock.gilAcquired();
+
+            if (auto override_ = Helpers::getCachedOverride (static_cast<const Base*> (this), "getNextAudioBlock"))
+            {
+                override_ (bufferToFill);
+                timedBlock.pythonFinished();
+                return;
+            }
+        }
+
+        if constexpr (std::is_abstract_v<Base>)
+            pybind11::pybind11_fail ("Tried to call pure virtual function \"AudioSource::getNextAudioBlock\"");
+        else
+            Base::getNextAudioBlock (bufferToFill);
+    }
+};
+
+/**
+ * @brief An audio source forwarding to native C function pointers, that never takes the GIL.
+ *
+ * The process function receives the channels of the buffer to fill unchanged, along with the region to render.
+ */
+struct PyNativeAudioSource : juce::AudioSource
+{
+    using ProcessFunction = void (*) (void* userData, float* const* channels, int numChannels, int startSample, int numSamples);
+    using PrepareFunction = void (*) (void* userData, int samplesPerBlockExpected, double sampleRate);
+    using ReleaseFunction = void (*) (void* userData);
+
+    PyNativeAudioSource (ProcessFunction process, void* userData, PrepareFunction prepare, ReleaseFunction release) noexcept
+        : process (process)
+        , prepare (prepare)
+        , release (release)
+        , userData (userData)
+    {
+    }
+
+    void prepareToPlay (int samplesPerBlockExpected, double sampleRate) override
+    {
+        if (prepare != nullptr)
+            prepare (userData, samplesPerBlockExpected, sampleRate);
+    }
+
+    void releaseResources() override
+    {
+        if (release != nullptr)
+            release (userData);
+    }
+
+    void getNextAudioBlock (const juce::AudioSourceChannelInfo& bufferToFill) override
+    {
+        if (process == nullptr || bufferToFill.buffer == nullptr)
+        {
+            bufferToFill.clearActiveBufferRegion();
+            return;
+        }
+
+        process (userData,
+                 bufferToFill.buffer->getArrayOfWritePointers(),
+                 bufferToFill.buffer->getNumChannels(),
+                 bufferToFill.startSample,
+                 bufferToFill.numSamples);
+    }
+
+    void* getUserData() const noexcept
+    {
+        return userData;
+    }
+
+private:
+    ProcessFunction process = nullptr;
+    PrepareFunction prepare = nullptr;
+    ReleaseFunction release = nullptr;
+    void* userData = nullptr;
+};
+
+// =================================================================================================
+
+template <class Base = juce::PositionableAudioSource>
+struct PyPositionableAudioSource : PyAudioSource<Base>
+{
+    using PyAudioSource<Base>::PyAudioSource;
+
+    void setNextReadPosition (juce::int64 newPosition) override
+    {
+        POPSICLE_OVERRIDE_PURE (void, PyAudioSource<Base>, setNextReadPosition, newPosition);
+    }
+
+    juce::int64 getNextReadPosition() const override
+    {
+        POPSICLE_OVERRIDE_PURE (juce::int64, PyAudioSource<Base>, getNextReadPosition);
+    }
+
+    juce::int64 getTotalLength() const override
+    {
+        POPSICLE_OVERRIDE_PURE (juce::int64, PyAudioSource<Base>, getTotalLength);
+    }
+
+    bool isLooping() const override
+    {
+        POPSICLE_OVERRIDE_PURE (bool, PyAudioSource<Base>, isLooping);
+    }
+};
+
+// =================================================================================================
+
+struct PySynthesiserSound : juce::SynthesiserSound
+{
+    bool appliesToNote (int midiNoteNumber) override
+    {
+        POPSICLE_OVERRIDE_PURE (bool, juce::SynthesiserSound, appliesToNote, midiNoteNumber);
+    }
+
+    bool appliesToChannel (int midiChannel) override
+    {
+        POPSICLE_OVERRIDE_PURE (bool, juce::SynthesiserSound, appliesToChannel, midiChannel);
+    }
+};
+
+// =================================================================================================
+
+template <class Base = juce::SynthesiserVoice>
+struct PySynthesiserVoice : Base
+{
+    using Base::Base;
+    using Base::renderNextBlock;
+
+    bool canPlaySound (juce::SynthesiserSound* sound) override
+    {
+        POPSICLE_OVERRIDE_PURE (bool, Base, canPlaySound, sound);
+    }
+
+    void startNote (int midiNoteNumber, float velocity, juce::SynthesiserSound* sound, int currentPitchWheelPosition) override
+    {
+        POPSICLE_OVERRIDE_PURE (void, Base, startNote, midiNoteNumber, velocity, sound, currentPitchWheelPosition);
+    }
+
+    void stopNote (float velocity, bool allowTailOff) override
+    {
+        POPSICLE_OVERRIDE_PURE (void, Base, stopNote, velocity, allowTailOff);
+    }
+
+    bool isVoiceActive() const override
+    {
+        POPSICLE_OVERRIDE (bool, Base, isVoiceActive);
+    }
+
+    void pitchWheelMoved (int newPitchWheelValue) override
+    {
+        POPSICLE_OVERRIDE_PURE (void, Base, pitchWheelMoved, newPitchWheelValue);
+    }
+
+    void controllerMoved (int controllerNumber, int newControllerValue) override
+    {
+        POPSICLE_OVERRIDE_PURE (void, Base, controllerMoved, controllerNumber, newControllerValue);
+    }
+
+    void aftertouchChanged (int newAftertouchValue) override
+    {
+        POPSICLE_OVERRIDE (void, Base, aftertouchChanged, newAftertouchValue);
+    }
+
+    void channelPressureChanged (int newChannelPressureValue) override
+    {
+        POPSICLE_OVERRIDE (void, Base, channelPressureChanged, newChannelPressureValue);
+    }
+
+    void renderNextBlock (juce::AudioBuffer<float>& outputBuffer, int startSample, int numSamples) override
+    {
+        POPSICLE_OVERRIDE_PURE (void, Base, renderNextBlock, std::addressof (outputBuffer), startSample, numSamples);
+    }
+
+    void setCurrentPlaybackSampleRate (double newRate) override
+    {
+        POPSICLE_OVERRIDE (void, Base, setCurrentPlaybackSampleRate, newRate);
+    }
+
+    bool isPlayingChannel (int midiChannel) const override
+    {
+        POPSICLE_OVERRIDE (bool, Base, isPlayingChannel, midiChannel);
+    }
+};
+
+// =================================================================================================
+
+/**
+ * @brief Trampoline for synthesisers subclassed in python.
+ *
+ * JUCE calls the note and controller handlers with the synthesiser lock held, so python overrides of them run under
+ * that lock on the audio thread. Whether a method is overridden is resolved with the GIL the first time it's called:
+ * methods without an override then go straight to the juce::Synthesiser implementation without ever taking the GIL,
+ * so overrides must be defined on the class before the synthesiser starts receiving events.
+ */
+template <class Base = juce::Synthesiser>
+struct PySynthesiser : Base
+{
+    using Base::Base;
+
+    void noteOn (int midiChannel, int midiNoteNumber, float velocity) override
+    {
+        if (! callOverride (Method::noteOn, "noteOn", midiChannel, midiNoteNumber, velocity))
+            Base::noteOn (midiChannel, midiNoteNumber, velocity);
+    }
+
+    void noteOff (int midiChannel, int midiNoteNumber, float velocity, bool allowTailOff) override
+    {
+        if (! callOverride (Method::noteOff, "noteOff", midiChannel, midiNoteNumber, velocity, allowTailOff))
+            Base::noteOff (midiChannel, midiNoteNumber, velocity, allowTailOff);
+    }
+
+    void allNotesOff (int midiChannel, bool allowTailOff) override
+    {
+        if (! callOverride (Method::allNotesOff, "allNotesOff", midiChannel, allowTailOff))
+            Base::allNotesOff (midiChannel, allowTailOff);
+    }
+
+    void handlePitchWheel (int midiChannel, int wheelValue) override
+    {
+        if (! callOverride (Method::handlePitchWheel, "handlePitchWheel", midiChannel, wheelValue))
+            Base::handlePitchWheel (midiChannel, wheelValue);
+    }
+
+    void handleController (int midiChannel, int controllerNumber, int controllerValue) override
+    {
+        if (! callOverride (Method::handleController, "handleController", midiChannel, controllerNumber, controllerValue))
+            Base::handleController (midiChannel, controllerNumber, controllerValue);
+    }
+
+    void handleAftertouch (int midiChannel, int midiNoteNumber, int aftertouchValue) override
+    {
+        if (! callOverride (Method::handleAftertouch, "handleAftertouch", midiChannel, midiNoteNumber, aftertouchValue))
+            Base::handleAftertouch (midiChannel, midiNoteNumber, aftertouchValue);
+    }
+
+    void handleChannelPressure (int midiChannel, int channelPressureValue) override
+    {
+        if (! callOverride (Method::handleChannelPressure, "handleChannelPressure", midiChannel, channelPressureValue))
+            Base::handleChannelPressure (midiChannel, channelPressureValue);
+    }
+
+    void handleSustainPedal (int midiChannel, bool isDown) override
+    {
+        if (! callOverride (Method::handleSustainPedal, "handleSustainPedal", midiChannel, isDown))
+            Base::handleSustainPedal (midiChannel, isDown);
+    }
+
+    void handleSostenutoPedal (int midiChannel, bool isDown) override
+    {
+        if (! callOverride (Method::handleSostenutoPedal, "handleSostenutoPedal", midiChannel, isDown))
+            Base::handleSostenutoPedal (midiChannel, isDown);
+    }
+
+    void handleSoftPedal (int midiChannel, bool isDown) override
+    {
+        if (! callOverride (Method::handleSoftPedal, "handleSoftPedal", midiChannel, isDown))
+            Base::handleSoftPedal (midiChannel, isDown);
+    }
+
+    void handleProgramChange (int midiChannel, int programNumber) override
+    {
+        if (! callOverride (Method::handleProgramChange, "handleProgramChange", midiChannel, programNumber))
+            Base::handleProgramChange (midiChannel, programNumber);
+    }
+
+    void setCurrentPlaybackSampleRate (double sampleRate) override
+    {
+        if (! callOverride (Method::setCurrentPlaybackSampleRate, "setCurrentPlaybackSampleRate", sampleRate))
+            Base::setCurrentPlaybackSampleRate (sampleRate);
+    }
+
+    juce::SynthesiserVoice* findFreeVoice (juce::SynthesiserSound* soundToPlay, int midiChannel, int midiNoteNumber, bool stealIfNoneAvailable) const override
+    {
+        if (mayBeOverridden (Method::findFreeVoice))
+        {
+            pybind11::gil_scoped_acquire gil;
+
+            if (auto override_ = resolveOverride (Method::findFreeVoice, "findFreeVoice"))
+                return override_ (soundToPlay, midiChannel, midiNoteNumber, stealIfNoneAvailable).template cast<juce::SynthesiserVoice*>();
+        }
+
+        return Base::findFreeVoice (soundToPlay, midiChannel, midiNoteNumber, stealIfNoneAvailable);
+    }
+
+    juce::SynthesiserVoice* findVoiceToSteal (juce::SynthesiserSound* soundToPlay, int midiChannel, int midiNoteNumber) const override
+    {
+        if (mayBeOverridden (Method::findVoiceToSteal))
+        {
+            pybind11::gil_scoped_acquire gil;
+
+            if (auto override_ = resolveOverride (Method::findVoiceToSteal, "findVoiceToSteal"))
+                return override_ (soundToPlay, midiChannel, midiNoteNumber).template cast<juce::SynthesiserVoice*>();
+        }
+
+        return Base::findVoiceToSteal (soundToPlay, midiChannel, midiNoteNumber);
+    }
+
+private:
+    enum class Method
+    {
+        noteOn,
+        noteOff,
+        allNotesOff,
+        handlePitchWheel,
+        handleController,
+        handleAftertouch,
+        handleChannelPressure,
+        handleSustainPedal,
+        handleSostenutoPedal,
+        handleSoftPedal,
+        handleProgramChange,
+        setCurrentPlaybackSampleRate,
+        findFreeVoice,
+        findVoiceToSteal,
+        numMethods
+    };
+
+    enum class OverrideState
+    {
+        unresolved,
+        overridden,
+        notOverridden
+    };
+
+    bool mayBeOverridden (Method method) const noexcept
+    {
+        return overrideStates[static_cast<size_t> (method)].load (std::memory_order_acquire) != OverrideState::notOverridden;
+    }
+
+    /** Resolves the python override of a method, must be called with the GIL held. */
+    Helpers::PythonOverride resolveOverride (Method method, const char* name) const
+    {
+        auto override_ = Helpers::getCachedOverride (static_cast<const Base*> (this), name);
+
+        overrideStates[static_cast<size_t> (method)].store (override_ ? OverrideState::overridden : OverrideState::notOverridden,
+                                                            std::memory_order_release);
+
+        return override_;
+    }
+
+    template <class... Args>
+    bool callOverride (Method method, const char* name, Args... args) const
+    {
+        if (! mayBeOverridden (method))
+            return false;
+
+        pybind11::gil_scoped_acquire gil;
+
+        auto override_ = resolveOverride (method, name);
+        if (! override_)
+            return false;
+
+        override_ (args...);
+        return true;
+    }
+
+    mutable std::array<std::atomic<OverrideState>, static_cast<size_t> (Method::numMethods)> overrideStates {};
+};
+
+// =================================================================================================
+
+/**
+ * @brief A synthesiser sound covering a range of notes on one or all the MIDI channels, played by the native voices.
+ */
+class PySimpleSynthesiserSound : public juce::SynthesiserSound
+{
+public:
+    PySimpleSynthesiserSound (int lowestNote = 0, int highestNote = 127, int midiChannel = 0) noexcept
+        : lowestNote (lowestNote)
+        , highestNote (highestNote)
+        , midiChannel (midiChannel)
+    {
+    }
+
+    bool appliesToNote (int midiNoteNumber) override
+    {
+        return midiNoteNumber >= lowestNote && midiNoteNumber <= highestNote;
+    }
+
+    bool appliesToChannel (int channel) override
+    {
+        return midiChannel <= 0 || midiChannel == channel;
+    }
+
+    int getLowestNote() const noexcept { return lowestNote; }
+    int getHighestNote() const noexcept { return highestNote; }
+    int getMidiChannel() const noexcept { return midiChannel; }
+
+private:
+    const int lowestNote;
+    const int highestNote;
+    const int midiChannel;
+};
+
+// =================================================================================================
+
+/**
+ * @brief Base of the voices rendering entirely in C++, never taking the GIL.
+ *
+ * Handles the note level, the pitch wheel and an ADSR envelope, leaving to subclasses only the generation of the
+ * oscillator samples. The gain, envelope and pitch wheel range can be changed from any thread, they are picked up
+ * by the next started note.
+ */
+class PyNativeSynthesiserVoice : public juce::SynthesiserVoice
+{
+public:
+    using juce::SynthesiserVoice::renderNextBlock;
+
+    bool canPlaySound (juce::SynthesiserSound* sound) override
+    {
+        return dynamic_cast<PySimpleSynthesiserSound*> (sound) != nullptr;
+    }
+
+    void startNote (int midiNoteNumber, float velocity, juce::SynthesiserSound*, int currentPitchWheelPosition) override
+    {
+        level = velocity * gain.load (std::memory_order_relaxed);
+        pitchWheelPosition = currentPitchWheelPosition;
+
+        if (getSampleRate() > 0.0)
+            envelope.setSampleRate (getSampleRate());
+
+        envelope.setParameters (getEnvelopeParameters());
+        envelope.noteOn();
+
+        resetOscillator (getCyclesPerSample (midiNoteNumber));
+    }
+
+    void stopNote (float, bool allowTailOff) override
+    {
+        if (allowTailOff)
+        {
+            envelope.noteOff();
+            return;
+        }
+
+        envelope.reset();
+        clearCurrentNote();
+    }
+
+    void pitchWheelMoved (int newPitchWheelValue) override
+    {
+        pitchWheelPosition = newPitchWheelValue;
+
+        if (const auto note = getCurrentlyPlayingNote(); note >= 0)
+            setCyclesPerSample (getCyclesPerSample (note));
+    }
+
+    void controllerMoved (int, int) override
+    {
+    }
+
+    void renderNextBlock (juce::AudioBuffer<float>& outputBuffer, int startSample, int numSamples) override
+    {
+        if (! isVoiceActive())
+            return;
+
+        const auto numChannels = outputBuffer.getNumChannels();
+        auto* const* channels = outputBuffer.getArrayOfWritePointers();
+
+        for (int sample = startSample; sample < startSample + numSamples; ++sample)
+        {
+            const auto value = getNextOscillatorSample() * level * envelope.getNextSample();
+
+            for (int channel = 0; channel < numChannels; ++channel)
+                channels[channel][sample] += value;
+
+            if (! envelope.isActive())
+            {
+                clearCurrentNote();
+                break;
+            }
+        }
+    }
+
+    void setGain (float newGain) noexcept
+    {
+        gain.store (newGain, std::memory_order_relaxed);
+    }
+
+    float getGain() const noexcept
+    {
+        return gain.load (std::memory_order_relaxed);
+    }
+
+    void setEnvelopeParameters (const juce::ADSR::Parameters& parameters) noexcept
+    {
+        attack.store (parameters.attack, std::memory_order_relaxed);
+        decay.store (parameters.decay, std::memory_order_relaxed);
+        sustain.store (parameters.sustain, std::memory_order_relaxed);
+        release.store (parameters.release, std::memory_order_relaxed);
+    }
+
+    juce::ADSR::Parameters getEnvelopeParameters() const noexcept
+    {
+        return { attack.load (std::memory_order_relaxed),
+                 decay.load (std::memory_order_relaxed),
+                 sustain.load (std::memory_order_relaxed),
+                 release.load (std::memory_order_relaxed) };
+    }
+
+    void setPitchWheelRange (float newRangeInSemitones) noexcept
+    {
+        pitchWheelRange.store (newRangeInSemitones, std::memory_order_relaxed);
+    }
+
+    float getPitchWheelRange() const noexcept
+    {
+        return pitchWheelRange.load (std::memory_order_relaxed);
+    }
+
+protected:
+    /** Restarts the oscillator at the given frequency, expressed in cycles per sample. */
+    virtual void resetOscillator (double cyclesPerSample) noexcept = 0;
+
+    /** Changes the frequency of the running oscillator, expressed in cycles per sample. */
+    virtual void setCyclesPerSample (double cyclesPerSample) noexcept = 0;
+
+    /** Returns the next sample of the oscillator, in the -1 to 1 range. */
+    virtual float getNextOscillatorSample() noexcept = 0;
+
+private:
+    double getCyclesPerSample (int midiNoteNumber) const noexcept
+    {
+        const auto semitones = pitchWheelRange.load (std::memory_order_relaxed) * (pitchWheelPosition - 8192) / 8192.0;
+        const auto frequency = juce::MidiMessage::getMidiNoteInHertz (midiNoteNumber) * std::pow (2.0, semitones / 12.0);
+
+        return getSampleRate() > 0.0 ? frequency / getSampleRate() : 0.0;
+    }
+
+    juce::ADSR envelope;
+    float level = 0.0f;
+    int pitchWheelPosition = 8192;
+
+    std::atomic<float> gain { 0.25f };
+    std::atomic<float> attack { 0.005f };
+    std::atomic<float> decay { 0.0f };
+    std::atomic<float> sustain { 1.0f };
+    std::atomic<float> release { 0.05f };
+    std::atomic<float> pitchWheelRange { 2.0f };
+};
+
+// =================================================================================================
+
+class PySineVoice : public PyNativeSynthesiserVoice
+{
+protected:
+    void resetOscillator (double cyclesPerSample) noexcept override
+    {
+        phase = 0.0;
+        setCyclesPerSample (cyclesPerSample);
+    }
+
+    void setCyclesPerSample (double cyclesPerSample) noexcept override
+    {
+        phaseDelta = cyclesPerSample * juce::MathConstants<double>::twoPi;
+    }
+
+    float getNextOscillatorSample() noexcept override
+    {
+        const auto value = static_cast<float> (std::sin (phase));
+
+        phase += phaseDelta;
+        if (phase >= juce::MathConstants<double>::twoPi)
+            phase -= juce::MathConstants<double>::twoPi;
+
+        return value;
+    }
+
+private:
+    double phase = 0.0;
+    double phaseDelta = 0.0;
+};
+
+// =================================================================================================
+
+/**
+ * @brief A voice looping over a single cycle wavetable with linear interpolation.
+ *
+ * The table is copied from the first channel of the buffer when the voice is created.
+ */
+class PyWavetableVoice : public PyNativeSynthesiserVoice
+{
+public:
+    explicit PyWavetableVoice (const juce::AudioBuffer<float>& wavetable)
+        : table (static_cast<size_t> (juce::jmax (1, wavetable.getNumSamples())) + 1, 0.0f)
+    {
+        if (wavetable.getNumChannels() > 0)
+            std::copy_n (wavetable.getReadPointer (0), wavetable.getNumSamples(), table.begin());
+
+        table.back() = table.front();
+    }
+
+    int getTableSize() const noexcept
+    {
+        return static_cast<int> (table.size()) - 1;
+    }
+
+protected:
+    void resetOscillator (double cyclesPerSample) noexcept override
+    {
+        position = 0.0;
+        setCyclesPerSample (cyclesPerSample);
+    }
+
+    void setCyclesPerSample (double cyclesPerSample) noexcept override
+    {
+        increment = cyclesPerSample * getTableSize();
+    }
+
+    float getNextOscillatorSample() noexcept override
+    {
+        const auto index = static_cast<size_t> (position);
+        const auto fraction = static_cast<float> (position - static_cast<double> (index));
+        const auto value = table[index] + fraction * (table[index + 1] - table[index]);
+
+        position += increment;
+        while (position >= getTableSize())
+            position -= getTableSize();
+
+        return value;
+    }
+
+private:
+    std::vector<float> table;
+    double position = 0.0;
+    double increment = 0.0;
+};
+
 } // namespace popsicle::Bindings
@@ -25,6 +25,7 @@
 #include <string_view>
 #include <typeinfo>
 #include <tuple>
+#include <unordered_map>
 
 namespace popsicle::Bindings {
 
@@ -35,6 +36,58 @@ using namespace py::literals;
 
 // ============================================================================================
 
+template <class F>
+py::list makeMidiDeviceInfoList (F&& getDevices)
+{
+    Array<MidiDeviceInfo> devices;
+
+    {
+        py::gil_scoped_release release;
+        devices = getDevices();
+    }
+
+    py::list result;
+
+    for (const auto& device : devices)
+        result.append (device);
+
+    return result;
+}
+
+// ============================================================================================
+
+/** Returns the MIDI input callbacks registered on a device manager wrapper, keyed by device and callback address. */
+py::dict& getRegisteredMidiInputCallbacks (py::handle manager)
+{
+    // Intentionally leaked, entries are dropped by the manager weak reference callbacks instead
+    static auto* registered = new std::unordered_map<PyObject*, py::dict>();
+
+    if (auto it = registered->find (manager.ptr()); it != registered->end())
+        return it->second;
+
+    py::cpp_function removeEntry ([key = manager.ptr()] (py::handle weakref)
+    {
+        if (auto entry = registered->find (key); entry != registered->end())
+        {
+            auto callbacks = std::move (entry->second);
+            registered->erase (entry);
+        }
+
+        weakref.dec_ref();
+    });
+
+    (void) py::weakref (manager, removeEntry).release();
+
+    return registered->emplace (manager.ptr(), py::dict()).first->second;
+}
+
+py::tuple makeMidiInputCallbackKey (const String& deviceIdentifier, MidiInputCallback* callback)
+{
+    return py::make_tuple (deviceIdentifier, reinterpret_cast<std::uintptr_t> (callback));
+}
+
+// ============================================================================================
+
 void registerJuceAudioDevicesBindings (py::module_& m)
 {
     // ============================================================================================ juce::WASAPIDeviceMode
@@ -86,17 +139,95 @@ void registerJuceAudioDevicesBindings (py::module_& m)
 
     py::class_<AudioIODeviceCallback, PyAudioIODeviceCallback<>> classAudioIODeviceCallback (m, "AudioIODeviceCallback");
 
+    py::enum_<PyAudioIODeviceCallbackDispatcher::DispatchMode> (classAudioIODeviceCallback, "DispatchMode")
+        .value ("channelLists", PyAudioIODeviceCallbackDispatcher::DispatchMode::channelLists)
+        .value ("channelViews", PyAudioIODeviceCallbackDispatcher::DispatchMode::channelViews)
+        .export_values();
+
     classAudioIODeviceCallback
         .def (py::init<>())
-        //.def ("audioDeviceIOCallbackWithContext", [](AudioIODeviceCallback& self, py::buffer inputs, int numInputs, py::buffer outputs, int numOutputs, int numSamples, const AudioIODeviceCallbackContext& ctx)
-        //{
-        //})
+        .def ("audioDeviceIOCallbackWithContext", [](AudioIODeviceCallback& self, py::object inputs, int numInputChannels, py::object outputs, int numOutputChannels, int numSamples, const AudioIODeviceCallbackContext& context)
+        {
+            PyChannelPointers<const float> inputChannels (inputs);
+            PyChannelPointers<float> outputChannels (outputs);
+
+            if (numInputChannels < 0 || numInputChannels > inputChannels.getNumChannels()
+                || numOutputChannels < 0 || numOutputChannels > outputChannels.getNumChannels())
+                throw py::value_error ("Invalid number of channels specified");
+
+            if (numSamples < 0
+                || (numInputChannels > 0 && numSamples > inputChannels.getNumSamples())
+                || (numOutputChannels > 0 && numSamples > outputChannels.getNumSamples()))
+                throw py::value_error ("Invalid number of samples specified");
+
+            py::gil_scoped_release release;
+
+            self.audioDeviceIOCallbackWithContext (inputChannels.data(), numInputChannels, outputChannels.data(), numOutputChannels, numSamples, context);
+        }, "inputChannelData"_a, "numInputChannels"_a, "outputChannelData"_a, "numOutputChannels"_a, "numSamples"_a, "context"_a)
+        .def ("setDispatchMode", [](AudioIODeviceCallback& self, PyAudioIODeviceCallbackDispatcher::DispatchMode mode)
+        {
+            auto dispatcher = dynamic_cast<PyAudioIODeviceCallbackDispatcher*> (&self);
+            if (dispatcher == nullptr)
+                throw py::type_error ("The dispatch mode can only be changed on python subclasses of AudioIODeviceCallback");
+
+            dispatcher->setDispatchMode (mode);
+        }, "mode"_a)
+        .def ("getDispatchMode", [](const AudioIODeviceCallback& self)
+        {
+            auto dispatcher = dynamic_cast<const PyAudioIODeviceCallbackDispatcher*> (&self);
+            return dispatcher != nullptr ? dispatcher->getDispatchMode() : PyAudioIODeviceCallbackDispatcher::DispatchMode::channelLists;
+        })
+        .def ("setLookaheadBlocks", [](AudioIODeviceCallback& self, int numBlocks)
+        {
+            auto dispatcher = dynamic_cast<PyAudioIODeviceCallbackDispatcher*> (&self);
+            if (dispatcher == nullptr)
+                throw py::type_error ("The lookahead can only be changed on python subclasses of AudioIODeviceCallback");
+
+            dispatcher->setLookaheadBlocks (numBlocks);
+        }, "numBlocks"_a)
+        .def ("getLookaheadBlocks", [](const AudioIODeviceCallback& self)
+        {
+            auto dispatcher = dynamic_cast<const PyAudioIODeviceCallbackDispatcher*> (&self);
+            return dispatcher != nullptr ? dispatcher->getLookaheadBlocks() : 0;
+        })
+        .def ("getUnderrunCount", [](const AudioIODeviceCallback& self)
+        {
+            auto dispatcher = dynamic_cast<const PyAudioIODeviceCallbackDispatcher*> (&self);
+            return dispatcher != nullptr ? dispatcher->getUnderrunCount() : 0;
+        })
+        .def ("getOverrunCount", [](const AudioIODeviceCallback& self)
+        {
+            auto dispatcher = dynamic_cast<const PyAudioIODeviceCallbackDispatcher*> (&self);
+            return dispatcher != nullptr ? dispatcher->getOverrunCount() : 0;
+        })
+        .def ("getAddedLatencyInSamples", [](const AudioIODeviceCallback& self)
+        {
+            auto dispatcher = dynamic_cast<const PyAudioIODeviceCallbackDispatcher*> (&self);
+            return dispatcher != nullptr ? dispatcher->getAddedLatencyInSamples() : 0;
+        })
         .def ("audioDeviceAboutToStart", &AudioIODeviceCallback::audioDeviceAboutToStart, "device"_a)
         .def ("audioDeviceStopped", &AudioIODeviceCallback::audioDeviceStopped)
         .def ("audioDeviceError", &AudioIODeviceCallback::audioDeviceError, "errorMessage"_a)
     ;
 
-    // ============================================================================================ juce::AudioIODeviceCallback
+    bindCallbackTimingStats (classAudioIODeviceCallback);
+
+    py::class_<PyNativeAudioIODeviceCallback, AudioIODeviceCallback> classNativeAudioIODeviceCallback (m, "NativeAudioIODeviceCallback");
+
+    classNativeAudioIODeviceCallback
+        .def (py::init ([](py::object process, py::object userData, py::object aboutToStart, py::object stopped)
+        {
+            return new PyNativeAudioIODeviceCallback (
+                Helpers::getNativeFunction<PyNativeAudioIODeviceCallback::ProcessFunction> (process),
+                Helpers::getNativeAddress (userData),
+                Helpers::getNativeFunction<PyNativeAudioIODeviceCallback::AboutToStartFunction> (aboutToStart),
+                Helpers::getNativeFunction<PyNativeAudioIODeviceCallback::StoppedFunction> (stopped));
+        }), "process"_a, "userData"_a = py::none(), "aboutToStart"_a = py::none(), "stopped"_a = py::none(),
+            py::keep_alive<1, 2>(), py::keep_alive<1, 3>(), py::keep_alive<1, 4>(), py::keep_alive<1, 5>())
+        .def ("getUserData", [](const PyNativeAudioIODeviceCallback& self) { return reinterpret_cast<std::uintptr_t> (self.getUserData()); })
+    ;
+
+    // ============================================================================================ juce::AudioIODevice
 
     py::class_<AudioIODevice, PyAudioIODevice> classAudioIODevice (m, "AudioIODevice");
 
@@ -112,11 +243,11 @@ void registerJuceAudioDevicesBindings (py::module_& m)
         .def ("getAvailableSampleRates", &AudioIODevice::getAvailableSampleRates)
         .def ("getAvailableBufferSizes", &AudioIODevice::getAvailableBufferSizes)
         .def ("getDefaultBufferSize", &AudioIODevice::getDefaultBufferSize)
-        .def ("open", &AudioIODevice::open)
-        .def ("close", &AudioIODevice::close)
+        .def ("open", &AudioIODevice::open, py::call_guard<py::gil_scoped_release>())
+        .def ("close", &AudioIODevice::close, py::call_guard<py::gil_scoped_release>())
         .def ("isOpen", &AudioIODevice::isOpen)
-        .def ("start", &AudioIODevice::start)
-        .def ("stop", &AudioIODevice::stop)
+        .def ("start", &AudioIODevice::start, py::call_guard<py::gil_scoped_release>())
+        .def ("stop", &AudioIODevice::stop, py::call_guard<py::gil_scoped_release>())
         .def ("isPlaying", &AudioIODevice::isPlaying)
         .def ("getLastError", &AudioIODevice::getLastError)
         .def ("getCurrentBufferSizeSamples", &AudioIODevice::getCurrentBufferSizeSamples)
@@ -132,6 +263,180 @@ void registerJuceAudioDevicesBindings (py::module_& m)
         .def ("getXRunCount", &AudioIODevice::getXRunCount)
     ;
 
+    // ============================================================================================ juce::RenderAudioIODeviceType
+
+    py::class_<PyRenderAudioIODevice, AudioIODevice> classRenderAudioIODevice (m, "RenderAudioIODevice");
+
+    classRenderAudioIODevice
+        .def ("getNumSamplesRendered", &PyRenderAudioIODevice::getNumSamplesRendered)
+        .def ("waitForRenderToFinish", &PyRenderAudioIODevice::waitForRenderToFinish, "timeOutMilliseconds"_a = -1, py::call_guard<py::gil_scoped_release>())
+    ;
+
+    py::class_<PyRenderAudioIODeviceType, AudioIODeviceType> classRenderAudioIODeviceType (m, "RenderAudioIODeviceType");
+
+    classRenderAudioIODeviceType
+        .def (py::init ([](double sampleRate, int bufferSize, int numInputChannels, int numOutputChannels, double speed, int64 lengthInSamples)
+        {
+            if (sampleRate <= 0.0 || bufferSize <= 0 || numInputChannels < 0 || numOutputChannels < 0 || speed < 0.0)
+                throw py::value_error ("Invalid render device settings");
+
+            PyRenderAudioIODeviceOptions options;
+            options.sampleRate = sampleRate;
+            options.bufferSize = bufferSize;
+            options.numInputChannels = numInputChannels;
+            options.numOutputChannels = numOutputChannels;
+            options.speed = speed;
+            options.lengthInSamples = lengthInSamples;
+
+            return new PyRenderAudioIODeviceType (options);
+        }), "sampleRate"_a = 44100.0, "bufferSize"_a = 512, "numInputChannels"_a = 0, "numOutputChannels"_a = 2, "speed"_a = 0.0, "lengthInSamples"_a = -1)
+        .def_static ("getRenderTypeName", &PyRenderAudioIODeviceType::getRenderTypeName)
+        .def ("getSampleRate", [](const PyRenderAudioIODeviceType& self) { return self.getOptions().sampleRate; })
+        .def ("getBufferSize", [](const PyRenderAudioIODeviceType& self) { return self.getOptions().bufferSize; })
+        .def ("getNumInputChannels", [](const PyRenderAudioIODeviceType& self) { return self.getOptions().numInputChannels; })
+        .def ("getNumOutputChannels", [](const PyRenderAudioIODeviceType& self) { return self.getOptions().numOutputChannels; })
+        .def ("getSpeed", [](const PyRenderAudioIODeviceType& self) { return self.getOptions().speed; })
+        .def ("getLengthInSamples", [](const PyRenderAudioIODeviceType& self) { return self.getOptions().lengthInSamples; })
+    ;
+
+    // ============================================================================================ juce::MidiDeviceInfo
+
+    py::class_<MidiDeviceInfo> classMidiDeviceInfo (m, "MidiDeviceInfo");
+
+    classMidiDeviceInfo
+        .def (py::init<>())
+        .def (py::init<const String&, const String&>(), "name"_a, "identifier"_a)
+        .def_readwrite ("name", &MidiDeviceInfo::name)
+        .def_readwrite ("identifier", &MidiDeviceInfo::identifier)
+        .def (py::self == py::self)
+        .def (py::self != py::self)
+        .def ("__repr__", [](const MidiDeviceInfo& self)
+        {
+            String result;
+            result
+                << Helpers::pythonizeModuleClassName (PythonModuleName, typeid (self).name())
+                << "('" << self.name << "', '" << self.identifier << "')";
+            return result;
+        })
+    ;
+
+    // ============================================================================================ juce::MidiInputCallback
+
+    py::class_<MidiInputCallback, PyMidiInputCallback> classMidiInputCallback (m, "MidiInputCallback");
+
+    classMidiInputCallback
+        .def (py::init<>())
+        .def ("handleIncomingMidiMessage", &MidiInputCallback::handleIncomingMidiMessage, "source"_a, "message"_a)
+        .def ("handlePartialSysexMessage", [](MidiInputCallback& self, MidiInput* source, py::buffer messageData, double timestamp)
+        {
+            const auto info = messageData.request();
+            self.handlePartialSysexMessage (source, static_cast<const uint8*> (info.ptr), static_cast<int> (info.size * info.itemsize), timestamp);
+        }, "source"_a, "messageData"_a, "timestamp"_a)
+    ;
+
+    // ============================================================================================ juce::MidiInputQueue
+
+    py::class_<PyMidiInputQueue, MidiInputCallback> classMidiInputQueue (m, "MidiInputQueue");
+
+    classMidiInputQueue
+        .def (py::init<int>(), "capacity"_a = 4096)
+        .def ("push", &PyMidiInputQueue::push, "message"_a)
+        .def ("pop", [](PyMidiInputQueue& self, int maxRecords)
+        {
+            const auto numRecords = self.pop (maxRecords);
+            return makeMidiEventRecords (self.getPoppedRecords(), numRecords);
+        }, "maxRecords"_a = -1)
+        .def ("popInto", [](PyMidiInputQueue& self, MidiBuffer& buffer, double startTime, double sampleRate, int maxRecords)
+        {
+            if (sampleRate <= 0.0)
+                throw py::value_error ("The sample rate must be positive");
+
+            // The queue is drained into a local buffer without the GIL, the python owned one is only touched with it
+            MidiBuffer events;
+            int numRecords = 0;
+
+            {
+                py::gil_scoped_release release;
+                numRecords = self.popInto (events, startTime, sampleRate, maxRecords);
+            }
+
+            if (buffer.isEmpty())
+                buffer.swapWith (events);
+            else
+                buffer.addEvents (events, 0, -1, 0);
+
+            return numRecords;
+        }, "buffer"_a, "startTime"_a = 0.0, "sampleRate"_a = 1.0, "maxRecords"_a = -1)
+        .def ("getNumReady", &PyMidiInputQueue::getNumReady)
+        .def ("getCapacity", &PyMidiInputQueue::getCapacity)
+        .def ("getNumDropped", &PyMidiInputQueue::getNumDropped)
+        .def ("reset", &PyMidiInputQueue::reset)
+        .def ("__len__", &PyMidiInputQueue::getNumReady)
+    ;
+
+    // ============================================================================================ juce::MidiInput
+
+    py::class_<MidiInput> classMidiInput (m, "MidiInput");
+
+    classMidiInput
+        .def_static ("getAvailableDevices", []
+        {
+            return makeMidiDeviceInfoList ([] { return MidiInput::getAvailableDevices(); });
+        })
+        .def_static ("getDefaultDevice", &MidiInput::getDefaultDevice, py::call_guard<py::gil_scoped_release>())
+        .def_static ("openDevice", &MidiInput::openDevice,
+            "deviceIdentifier"_a, "callback"_a, py::keep_alive<0, 2>(), py::call_guard<py::gil_scoped_release>())
+        .def_static ("createNewDevice", &MidiInput::createNewDevice,
+            "deviceName"_a, "callback"_a, py::keep_alive<0, 2>(), py::call_guard<py::gil_scoped_release>())
+        .def ("getDeviceInfo", &MidiInput::getDeviceInfo)
+        .def ("getIdentifier", &MidiInput::getIdentifier)
+        .def ("getName", &MidiInput::getName)
+        .def ("setName", &MidiInput::setName, "newName"_a)
+        .def ("start", &MidiInput::start, py::call_guard<py::gil_scoped_release>())
+        .def ("stop", &MidiInput::stop, py::call_guard<py::gil_scoped_release>())
+    ;
+
+    // ============================================================================================ juce::MidiOutput
+
+    py::class_<MidiOutput> classMidiOutput (m, "MidiOutput");
+
+    classMidiOutput
+        .def_static ("getAvailableDevices", []
+        {
+            return makeMidiDeviceInfoList ([] { return MidiOutput::getAvailableDevices(); });
+        })
+        .def_static ("getDefaultDevice", &MidiOutput::getDefaultDevice, py::call_guard<py::gil_scoped_release>())
+        .def_static ("openDevice", &MidiOutput::openDevice, "deviceIdentifier"_a, py::call_guard<py::gil_scoped_release>())
+        .def_static ("createNewDevice", &MidiOutput::createNewDevice, "deviceName"_a, py::call_guard<py::gil_scoped_release>())
+        .def ("getDeviceInfo", &MidiOutput::getDeviceInfo)
+        .def ("getIdentifier", &MidiOutput::getIdentifier)
+        .def ("getName", &MidiOutput::getName)
+        .def ("setName", &MidiOutput::setName, "newName"_a)
+        .def ("sendMessageNow", &MidiOutput::sendMessageNow, "message"_a, py::call_guard<py::gil_scoped_release>())
+        .def ("sendBlockOfMessagesNow", &MidiOutput::sendBlockOfMessagesNow, "buffer"_a, py::call_guard<py::gil_scoped_release>())
+        .def ("sendBlockOfMessages", &MidiOutput::sendBlockOfMessages,
+            "buffer"_a, "millisecondCounterToStartAt"_a, "samplesPerSecondForBuffer"_a, py::call_guard<py::gil_scoped_release>())
+        .def ("clearAllPendingMessages", &MidiOutput::clearAllPendingMessages, py::call_guard<py::gil_scoped_release>())
+        .def ("startBackgroundThread", &MidiOutput::startBackgroundThread, py::call_guard<py::gil_scoped_release>())
+        .def ("stopBackgroundThread", &MidiOutput::stopBackgroundThread, py::call_guard<py::gil_scoped_release>())
+        .def ("isBackgroundThreadRunning", &MidiOutput::isBackgroundThreadRunning)
+    ;
+
+    // ============================================================================================ juce::MidiMessageCollector
+
+    py::class_<MidiMessageCollector, MidiInputCallback> classMidiMessageCollector (m, "MidiMessageCollector");
+
+    classMidiMessageCollector
+        .def (py::init<>())
+        .def ("reset", &MidiMessageCollector::reset, "sampleRate"_a, py::call_guard<py::gil_scoped_release>())
+        .def ("ensureStorageAllocated", &MidiMessageCollector::ensureStorageAllocated, "bytes"_a, py::call_guard<py::gil_scoped_release>())
+        .def ("addMessageToQueue", &MidiMessageCollector::addMessageToQueue, "message"_a, py::call_guard<py::gil_scoped_release>())
+        .def ("removeNextBlockOfMessages", &MidiMessageCollector::removeNextBlockOfMessages,
+            "destBuffer"_a, "numSamples"_a, py::call_guard<py::gil_scoped_release>())
+        .def ("handleIncomingMidiMessage", &MidiMessageCollector::handleIncomingMidiMessage,
+            "source"_a, "message"_a, py::call_guard<py::gil_scoped_release>())
+    ;
+
     // ============================================================================================ juce::AudioDeviceManager
 
     py::class_<AudioDeviceManager, ChangeBroadcaster> classAudioDeviceManager (m, "AudioDeviceManager");
@@ -167,11 +472,11 @@ void registerJuceAudioDevicesBindings (py::module_& m)
         .def ("createStateXml", &AudioDeviceManager::createStateXml)
         .def ("getAudioDeviceSetup", py::overload_cast<> (&AudioDeviceManager::getAudioDeviceSetup, py::const_))
         .def ("getAudioDeviceSetup", py::overload_cast<AudioDeviceManager::AudioDeviceSetup&> (&AudioDeviceManager::getAudioDeviceSetup, py::const_))
-        .def ("setAudioDeviceSetup", &AudioDeviceManager::setAudioDeviceSetup)
+        .def ("setAudioDeviceSetup", &AudioDeviceManager::setAudioDeviceSetup, py::call_guard<py::gil_scoped_release>())
         .def ("getCurrentAudioDevice", &AudioDeviceManager::getCurrentAudioDevice, py::return_value_policy::reference)
         .def ("getCurrentAudioDeviceType", &AudioDeviceManager::getCurrentAudioDeviceType)
         .def ("getCurrentDeviceTypeObject", &AudioDeviceManager::getCurrentDeviceTypeObject, py::return_value_policy::reference)
-        .def ("setCurrentAudioDeviceType", &AudioDeviceManager::setCurrentAudioDeviceType)
+        .def ("setCurrentAudioDeviceType", &AudioDeviceManager::setCurrentAudioDeviceType, py::call_guard<py::gil_scoped_release>())
         .def ("getDeviceAudioWorkgroup", &AudioDeviceManager::getDeviceAudioWorkgroup)
         .def ("closeAudioDevice", &AudioDeviceManager::closeAudioDevice, py::call_guard<py::gil_scoped_release>())
         .def ("restartLastAudioDevice", &AudioDeviceManager::restartLastAudioDevice, py::call_guard<py::gil_scoped_release>())
@@ -180,15 +485,53 @@ void registerJuceAudioDevicesBindings (py::module_& m)
         .def ("getCpuUsage", &AudioDeviceManager::getCpuUsage)
         .def ("setMidiInputDeviceEnabled", &AudioDeviceManager::setMidiInputDeviceEnabled)
         .def ("isMidiInputDeviceEnabled", &AudioDeviceManager::isMidiInputDeviceEnabled)
-    //.def ("addMidiInputDeviceCallback", &AudioDeviceManager::addMidiInputDeviceCallback)
-    //.def ("removeMidiInputDeviceCallback", &AudioDeviceManager::removeMidiInputDeviceCallback)
-        .def ("setDefaultMidiOutputDevice", &AudioDeviceManager::setDefaultMidiOutputDevice)
+        .def ("addMidiInputDeviceCallback", [](py::object selfObject, const String& deviceIdentifier, py::object callbackObject)
+        {
+            auto& self = selfObject.cast<AudioDeviceManager&>();
+            auto* callback = callbackObject.cast<MidiInputCallback*>();
+
+            {
+                py::gil_scoped_release release;
+                self.addMidiInputDeviceCallback (deviceIdentifier, callback);
+            }
+
+            // Keep the callback alive while it's registered, until removed or the manager is deleted
+            if (callback != nullptr)
+                getRegisteredMidiInputCallbacks (selfObject)[makeMidiInputCallbackKey (deviceIdentifier, callback)] = callbackObject;
+        }, "deviceIdentifier"_a, "callback"_a)
+        .def ("removeMidiInputDeviceCallback", [](py::object selfObject, const String& deviceIdentifier, py::object callbackObject)
+        {
+            auto& self = selfObject.cast<AudioDeviceManager&>();
+            auto* callback = callbackObject.cast<MidiInputCallback*>();
+
+            {
+                py::gil_scoped_release release;
+                self.removeMidiInputDeviceCallback (deviceIdentifier, callback);
+            }
+
+            getRegisteredMidiInputCallbacks (selfObject).attr ("pop") (makeMidiInputCallbackKey (deviceIdentifier, callback), py::none());
+        }, "deviceIdentifier"_a, "callback"_a)
+        .def ("setDefaultMidiOutputDevice", &AudioDeviceManager::setDefaultMidiOutputDevice, py::call_guard<py::gil_scoped_release>())
         .def ("getDefaultMidiOutputIdentifier", &AudioDeviceManager::getDefaultMidiOutputIdentifier)
-    //.def ("getDefaultMidiOutput", &AudioDeviceManager::getDefaultMidiOutput)
-    //.def ("getAvailableDeviceTypes", &AudioDeviceManager::getAvailableDeviceTypes)
+        .def ("getDefaultMidiOutput", &AudioDeviceManager::getDefaultMidiOutput, py::return_value_policy::reference_internal)
+        .def ("getAvailableDeviceTypes", [](AudioDeviceManager& self)
+        {
+            py::list result;
+
+            for (auto deviceType : self.getAvailableDeviceTypes())
+                result.append (py::cast (deviceType, py::return_value_policy::reference));
+
+            return result;
+        })
     //.def ("createAudioDeviceTypes", &AudioDeviceManager::createAudioDeviceTypes)
-    //.def ("addAudioDeviceType", &AudioDeviceManager::addAudioDeviceType)
-    //.def ("removeAudioDeviceType", &AudioDeviceManager::removeAudioDeviceType)
+        .def ("addAudioDeviceType", [](AudioDeviceManager& self, py::object deviceType)
+        {
+            if (deviceType.is_none() || ! py::isinstance<AudioIODeviceType> (deviceType))
+                py::pybind11_fail ("Invalid specified device type in \"AudioDeviceManager::addAudioDeviceType\"");
+
+            self.addAudioDeviceType (std::unique_ptr<AudioIODeviceType> (deviceType.release().cast<AudioIODeviceType*>()));
+        }, "newDeviceType"_a)
+        .def ("removeAudioDeviceType", &AudioDeviceManager::removeAudioDeviceType, "deviceTypeToRemove"_a, py::call_guard<py::gil_scoped_release>())
         .def ("playTestSound", &AudioDeviceManager::playTestSound, py::call_guard<py::gil_scoped_release>())
         .def ("getInputLevelGetter", &AudioDeviceManager::getInputLevelGetter)
         .def ("getOutputLevelGetter", &AudioDeviceManager::getOutputLevelGetter)
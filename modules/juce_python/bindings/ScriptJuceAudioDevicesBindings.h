@@ -32,6 +32,10 @@
 
 #include "../utilities/PythonInterop.h"
 
+#include <atomic>
+#include <functional>
+#include <vector>
+
 namespace popsicle::Bindings {
 
 // =================================================================================================
@@ -51,32 +55,32 @@ struct PyAudioIODeviceType : juce::AudioIODeviceType
 
     void scanForDevices() override
     {
-        PYBIND11_OVERRIDE_PURE (void, juce::AudioIODeviceType, scanForDevices);
+        POPSICLE_OVERRIDE_PURE (void, juce::AudioIODeviceType, scanForDevices);
     }
 
     juce::StringArray getDeviceNames (bool wantInputNames = false) const override
     {
-        PYBIND11_OVERRIDE_PURE (juce::StringArray, juce::AudioIODeviceType, getDeviceNames, wantInputNames);
+        POPSICLE_OVERRIDE_PURE (juce::StringArray, juce::AudioIODeviceType, getDeviceNames, wantInputNames);
     }
 
     int getDefaultDeviceIndex (bool forInput) const override
     {
-        PYBIND11_OVERRIDE_PURE (int, juce::AudioIODeviceType, getDefaultDeviceIndex, forInput);
+        POPSICLE_OVERRIDE_PURE (int, juce::AudioIODeviceType, getDefaultDeviceIndex, forInput);
     }
 
     int getIndexOfDevice (juce::AudioIODevice* device, bool asInput) const override
     {
-        PYBIND11_OVERRIDE_PURE (int, juce::AudioIODeviceType, getIndexOfDevice, device, asInput);
+        POPSICLE_OVERRIDE_PURE (int, juce::AudioIODeviceType, getIndexOfDevice, device, asInput);
     }
 
     bool hasSeparateInputsAndOutputs() const override
     {
-        PYBIND11_OVERRIDE_PURE (bool, juce::AudioIODeviceType, hasSeparateInputsAndOutputs);
+        POPSICLE_OVERRIDE_PURE (bool, juce::AudioIODeviceType, hasSeparateInputsAndOutputs);
     }
 
     juce::AudioIODevice* createDevice (const juce::String& outputDeviceName, const juce::String& inputDeviceName) override
     {
-        PYBIND11_OVERRIDE_PURE (juce::AudioIODevice*, juce::AudioIODeviceType, createDevice, outputDeviceName, inputDeviceName);
+        POPSICLE_OVERRIDE_PURE (juce::AudioIODevice*, juce::AudioIODeviceType, createDevice, outputDeviceName, inputDeviceName);
     }
 };
 
@@ -86,33 +90,369 @@ struct PyAudioIODeviceTypeListener : juce::AudioIODeviceType::Listener
 
     void audioDeviceListChanged() override
     {
-        PYBIND11_OVERRIDE_PURE (void, juce::AudioIODeviceType::Listener, audioDeviceListChanged);
+        POPSICLE_OVERRIDE_PURE (void, juce::AudioIODeviceType::Listener, audioDeviceListChanged);
     }
 };
 
 // =================================================================================================
 
-template <class Base = juce::AudioIODeviceCallback>
-struct PyAudioIODeviceCallback : Base
+/**
+ * @brief Renders an audio device callback on a dedicated thread, a number of blocks ahead of the device.
+ *
+ * The device thread only exchanges samples with the worker through lock-free single producer single consumer fifos
+ * and never touches the interpreter. It only signals the thread event of the worker when the worker is waiting on it.
+ * When the worker can't keep up, the missing samples are played as silence and counted as underruns. When the worker
+ * doesn't consume the inputs in time, they are dropped and counted as overruns.
+ */
+class PyAudioIODeviceCallbackWorker : private juce::Thread
 {
-    using Base::Base;
+public:
+    using RenderCallback = std::function<void (const float* const*, int, float* const*, int, int)>;
 
-    void audioDeviceIOCallbackWithContext (const float* const* inputChannelData,
-                                           int numInputChannels,
-                                           float* const* outputChannelData,
-                                           int numOutputChannels,
-                                           int numSamples,
-                                           const juce::AudioIODeviceCallbackContext& context) override
+    explicit PyAudioIODeviceCallbackWorker (RenderCallback renderCallback)
+        : juce::Thread ("popsicle audio worker")
+        , renderCallback (std::move (renderCallback))
     {
-        pybind11::gil_scoped_acquire gil;
+    }
 
-        if (! override_)
+    ~PyAudioIODeviceCallbackWorker() override
+    {
+        stop();
+    }
+
+    /** Prepares the fifos, renders the lookahead blocks and starts the worker thread. */
+    void start (int numInputChannels, int numOutputChannels, int newBlockSize, int numLookaheadBlocks)
+    {
+        stop();
+
+        blockSize = juce::jmax (1, newBlockSize);
+        lookaheadBlocks = juce::jmax (1, numLookaheadBlocks);
+
+        // Inputs can't be rendered ahead, so when there are inputs the lookahead is primed with silence and one more
+        // block of space is left for the worker to write into while the next input block is being recorded
+        const auto capacity = blockSize * (lookaheadBlocks + (numInputChannels > 0 ? 1 : 0));
+
+        inputFifo.setTotalSize (capacity + 1);
+        outputFifo.setTotalSize (capacity + 1);
+        inputRing.setSize (numInputChannels, capacity + 1, false, true, false);
+        outputRing.setSize (numOutputChannels, capacity + 1, false, true, false);
+        inputBlock.setSize (numInputChannels, blockSize, false, true, false);
+        outputBlock.setSize (numOutputChannels, blockSize, false, true, false);
+
+        underrunCount.store (0);
+        overrunCount.store (0);
+
+        if (numInputChannels > 0)
         {
-            override_ = pybind11::get_override (static_cast<Base*> (this), "audioDeviceIOCallbackWithContext");
-            if (! override_)
-                return;
+            const auto scope = outputFifo.write (lookaheadBlocks * blockSize);
+            outputRing.clear (scope.startIndex1, scope.blockSize1);
+            outputRing.clear (scope.startIndex2, scope.blockSize2);
+        }
+        else
+        {
+            while (renderNextBlock())
+                ;
+        }
+
+        running.store (true);
+        startThread (juce::Thread::Priority::high);
+    }
+
+    /** Stops the worker thread. Releases the GIL while waiting, as the worker might need it to finish its block. */
+    void stop()
+    {
+        running.store (false);
+
+        if (! isThreadRunning())
+            return;
+
+        if (PyGILState_Check())
+        {
+            pybind11::gil_scoped_release release;
+            stopThread (-1);
+        }
+        else
+        {
+            stopThread (-1);
+        }
+    }
+
+    bool isRunning() const noexcept
+    {
+        return running.load();
+    }
+
+    /** Called on the device thread: queues the inputs for the worker and plays back the samples rendered ahead. */
+    void process (const float* const* inputChannelData,
+                  int numInputChannels,
+                  float* const* outputChannelData,
+                  int numOutputChannels,
+                  int numSamples) noexcept
+    {
+        if (inputRing.getNumChannels() > 0)
+        {
+            const auto scope = inputFifo.write (numSamples);
+            if (scope.blockSize1 + scope.blockSize2 < numSamples)
+                overrunCount.fetch_add (1);
+
+            for (int channel = 0; channel < inputRing.getNumChannels(); ++channel)
+            {
+                if (channel < numInputChannels && inputChannelData[channel] != nullptr)
+                {
+                    inputRing.copyFrom (channel, scope.startIndex1, inputChannelData[channel], scope.blockSize1);
+                    inputRing.copyFrom (channel, scope.startIndex2, inputChannelData[channel] + scope.blockSize1, scope.blockSize2);
+                }
+                else
+                {
+                    inputRing.clear (channel, scope.startIndex1, scope.blockSize1);
+                    inputRing.clear (channel, scope.startIndex2, scope.blockSize2);
+                }
+            }
         }
 
+        {
+            const auto scope = outputFifo.read (numSamples);
+            const auto numRead = scope.blockSize1 + scope.blockSize2;
+            if (numRead < numSamples)
+                underrunCount.fetch_add (1);
+
+            for (int channel = 0; channel < numOutputChannels; ++channel)
+            {
+                auto* destination = outputChannelData[channel];
+                if (destination == nullptr)
+                    continue;
+
+                if (channel < outputRing.getNumChannels())
+                {
+                    juce::FloatVectorOperations::copy (destination, outputRing.getReadPointer (channel, scope.startIndex1), scope.blockSize1);
+                    juce::FloatVectorOperations::copy (destination + scope.blockSize1, outputRing.getReadPointer (channel, scope.startIndex2), scope.blockSize2);
+                    juce::FloatVectorOperations::clear (destination + numRead, numSamples - numRead);
+                }
+                else
+                {
+                    juce::FloatVectorOperations::clear (destination, numSamples);
+                }
+            }
+        }
+
+        // The event is only signalled when the worker sleeps on it, so the device thread rarely touches its lock, which
+        // is otherwise held just long enough to flip its state
+        blockProcessed.store (true);
+        if (workerWaiting.load())
+            notify();
+    }
+
+    int getUnderrunCount() const noexcept
+    {
+        return underrunCount.load();
+    }
+
+    int getOverrunCount() const noexcept
+    {
+        return overrunCount.load();
+    }
+
+    /** Returns the latency added by rendering ahead of the device, in samples. */
+    int getAddedLatencyInSamples() const noexcept
+    {
+        return isRunning() ? lookaheadBlocks * blockSize : 0;
+    }
+
+private:
+    void run() override
+    {
+        // Keep the thread state of the worker alive for its whole lifetime, instead of creating one every block
+        pybind11::gil_scoped_acquire acquire;
+        pybind11::gil_scoped_release release;
+
+        while (! threadShouldExit())
+        {
+            if (! renderNextBlock())
+                waitForProcessedBlock();
+        }
+    }
+
+    void waitForProcessedBlock()
+    {
+        // Publishing the waiting state before checking the flag guarantees that either the flag set by the device
+        // thread is seen here, or the device thread sees the worker waiting and signals it
+        workerWaiting.store (true);
+
+        if (! blockProcessed.exchange (false) && ! threadShouldExit())
+            wait (-1);
+
+        workerWaiting.store (false);
+        blockProcessed.store (false);
+    }
+
+    bool renderNextBlock()
+    {
+        const auto numInputChannels = inputBlock.getNumChannels();
+        const auto numOutputChannels = outputBlock.getNumChannels();
+
+        if (outputFifo.getFreeSpace() < blockSize || (numInputChannels > 0 && inputFifo.getNumReady() < blockSize))
+            return false;
+
+        if (numInputChannels > 0)
+        {
+            const auto scope = inputFifo.read (blockSize);
+
+            for (int channel = 0; channel < numInputChannels; ++channel)
+            {
+                inputBlock.copyFrom (channel, 0, inputRing, channel, scope.startIndex1, scope.blockSize1);
+                inputBlock.copyFrom (channel, scope.blockSize1, inputRing, channel, scope.startIndex2, scope.blockSize2);
+            }
+        }
+
+        outputBlock.clear();
+
+        renderCallback (inputBlock.getArrayOfReadPointers(), numInputChannels,
+                        outputBlock.getArrayOfWritePointers(), numOutputChannels,
+                        blockSize);
+
+        const auto scope = outputFifo.write (blockSize);
+
+        for (int channel = 0; channel < numOutputChannels; ++channel)
+        {
+            outputRing.copyFrom (channel, scope.startIndex1, outputBlock, channel, 0, scope.blockSize1);
+            outputRing.copyFrom (channel, scope.startIndex2, outputBlock, channel, scope.blockSize1, scope.blockSize2);
+        }
+
+        return true;
+    }
+
+    RenderCallback renderCallback;
+
+    juce::AbstractFifo inputFifo { 1 }, outputFifo { 1 };
+    juce::AudioBuffer<float> inputRing, outputRing;
+    juce::AudioBuffer<float> inputBlock, outputBlock;
+
+    int blockSize = 0;
+    int lookaheadBlocks = 0;
+    std::atomic<bool> running { false };
+    std::atomic<bool> blockProcessed { false };
+    std::atomic<bool> workerWaiting { false };
+    std::atomic<int> underrunCount { 0 };
+    std::atomic<int> overrunCount { 0 };
+};
+
+// =================================================================================================
+
+/**
+ * @brief State shared by all python audio device callbacks, independent of the wrapped base class.
+ *
+ * In channelLists mode (the default) every block builds new lists of channel views. In channelViews mode the
+ * channel containers are allocated in audioDeviceAboutToStart and only rebound each block, so the steady state
+ * dispatch into python doesn't allocate.
+ */
+struct PyAudioIODeviceCallbackDispatcher : PyCallbackTimingStatsHolder
+{
+    enum class DispatchMode
+    {
+        channelLists,
+        channelViews
+    };
+
+    PyAudioIODeviceCallbackDispatcher()
+        : worker ([this] (const float* const* inputs, int numInputs, float* const* outputs, int numOutputs, int numSamples)
+          {
+              renderBlock (inputs, numInputs, outputs, numOutputs, numSamples, juce::AudioIODeviceCallbackContext{}, false);
+          })
+    {
+    }
+
+    ~PyAudioIODeviceCallbackDispatcher() override = default;
+
+    void setDispatchMode (DispatchMode newMode) noexcept
+    {
+        dispatchMode.store (newMode);
+    }
+
+    DispatchMode getDispatchMode() const noexcept
+    {
+        return dispatchMode.load();
+    }
+
+    /**
+     * Sets how many blocks are rendered ahead on a worker thread, or 0 to call python on the device thread.
+     *
+     * Applied on the next device start.
+     */
+    void setLookaheadBlocks (int numBlocks) noexcept
+    {
+        lookaheadBlocks.store (juce::jmax (0, numBlocks));
+    }
+
+    int getLookaheadBlocks() const noexcept
+    {
+        return lookaheadBlocks.load();
+    }
+
+    int getUnderrunCount() const noexcept
+    {
+        return worker.getUnderrunCount();
+    }
+
+    int getOverrunCount() const noexcept
+    {
+        return worker.getOverrunCount();
+    }
+
+    int getAddedLatencyInSamples() const noexcept
+    {
+        return worker.getAddedLatencyInSamples();
+    }
+
+protected:
+    /** Renders a block through python, either on the device thread or on the lookahead worker thread. */
+    virtual void renderBlock (const float* const* inputChannelData,
+                              int numInputChannels,
+                              float* const* outputChannelData,
+                              int numOutputChannels,
+                              int numSamples,
+                              const juce::AudioIODeviceCallbackContext& context,
+                              bool isDeviceThread) = 0;
+
+    void startLookahead (juce::AudioIODevice* device)
+    {
+        worker.stop();
+
+        const auto numBlocks = getLookaheadBlocks();
+        if (device == nullptr || numBlocks <= 0)
+            return;
+
+        worker.start (device->getActiveInputChannels().countNumberOfSetBits(),
+                      device->getActiveOutputChannels().countNumberOfSetBits(),
+                      device->getCurrentBufferSizeSamples(),
+                      numBlocks);
+    }
+
+    PyAudioIODeviceCallbackWorker worker;
+
+    /** Allocates the reusable channel views for the device. Must be called with the GIL held. */
+    void prepareChannelViews (juce::AudioIODevice* device)
+    {
+        const auto numInputs = device != nullptr ? device->getActiveInputChannels().countNumberOfSetBits() : 0;
+        const auto numOutputs = device != nullptr ? device->getActiveOutputChannels().countNumberOfSetBits() : 0;
+
+        inputChannels.prepare (numInputs);
+        outputChannels.prepare (numOutputs);
+
+        inputsObject = pybind11::cast (std::addressof (inputChannels), pybind11::return_value_policy::reference);
+        outputsObject = pybind11::cast (std::addressof (outputChannels), pybind11::return_value_policy::reference);
+        contextObject = pybind11::cast (std::addressof (currentContext), pybind11::return_value_policy::reference);
+
+        lastNumInputChannels = lastNumOutputChannels = lastNumSamples = -1;
+    }
+
+    void dispatchChannelLists (const Helpers::PythonOverride& callback,
+                               const float* const* inputChannelData,
+                               int numInputChannels,
+                               float* const* outputChannelData,
+                               int numOutputChannels,
+                               int numSamples,
+                               const juce::AudioIODeviceCallbackContext& context)
+    {
         const auto numInputs = static_cast<size_t> (numInputChannels);
 
         pybind11::list inputs (numInputs);
@@ -125,26 +465,232 @@ struct PyAudioIODeviceCallback : Base
         for (size_t i = 0; i < numOutputs; ++i)
             outputs[i] = PyArrayView<float> (outputChannelData[i], static_cast<size_t> (numSamples));
 
-        override_ (inputs, numInputChannels, outputs, numOutputChannels, numSamples, context);
+        callback (inputs, numInputChannels, outputs, numOutputChannels, numSamples, context);
+    }
+
+    void dispatchChannelViews (const Helpers::PythonOverride& callback,
+                               const float* const* inputChannelData,
+                               int numInputChannels,
+                               float* const* outputChannelData,
+                               int numOutputChannels,
+                               int numSamples,
+                               const juce::AudioIODeviceCallbackContext& context)
+    {
+        if (! inputsObject || ! outputsObject)
+            prepareChannelViews (nullptr);
+
+        inputChannels.rebind (inputChannelData, numInputChannels, numSamples);
+        outputChannels.rebind (outputChannelData, numOutputChannels, numSamples);
+        currentContext = context;
+
+        updateCachedInteger (numInputsObject, lastNumInputChannels, numInputChannels);
+        updateCachedInteger (numOutputsObject, lastNumOutputChannels, numOutputChannels);
+        updateCachedInteger (numSamplesObject, lastNumSamples, numSamples);
+
+        callback (inputsObject, numInputsObject, outputsObject, numOutputsObject, numSamplesObject, contextObject);
+    }
+
+private:
+    static void updateCachedInteger (pybind11::object& object, int& lastValue, int newValue)
+    {
+        if (lastValue != newValue)
+        {
+            object = pybind11::int_ (newValue);
+            lastValue = newValue;
+        }
+    }
+
+    std::atomic<DispatchMode> dispatchMode { DispatchMode::channelLists };
+
+    PyAudioChannelsView<const float> inputChannels;
+    PyAudioChannelsView<float> outputChannels;
+    juce::AudioIODeviceCallbackContext currentContext;
+
+    pybind11::object inputsObject, outputsObject, contextObject;
+    pybind11::object numInputsObject, numOutputsObject, numSamplesObject;
+    int lastNumInputChannels = -1, lastNumOutputChannels = -1, lastNumSamples = -1;
+};
+
+// =================================================================================================
+
+template <class Base = juce::AudioIODeviceCallback>
+struct PyAudioIODeviceCallback : Base, PyAudioIODeviceCallbackDispatcher
+{
+    using Base::Base;
+
+    ~PyAudioIODeviceCallback() override
+    {
+        worker.stop();
+    }
+
+    void audioDeviceIOCallbackWithContext (const float* const* inputChannelData,
+                                           int numInputChannels,
+                                           float* const* outputChannelData,
+                                           int numOutputChannels,
+                                           int numSamples,
+                                           const juce::AudioIODeviceCallbackContext& context) override
+    {
+        if (worker.isRunning())
+            worker.process (inputChannelData, numInputChannels, outputChannelData, numOutputChannels, numSamples);
+        else
+            renderBlock (inputChannelData, numInputChannels, outputChannelData, numOutputChannels, numSamples, context, true);
     }
 
     void audioDeviceAboutToStart (juce::AudioIODevice* device) override
     {
-        PYBIND11_OVERRIDE_PURE (void, Base, audioDeviceAboutToStart, device);
+        {
+            pybind11::gil_scoped_acquire gil;
+
+            if (getDispatchMode() == DispatchMode::channelViews)
+                prepareChannelViews (device);
+
+            if (device != nullptr)
+                timingStats.prepare (device->getCurrentSampleRate(), device->getCurrentBufferSizeSamples());
+
+            if (auto aboutToStart = Helpers::getCachedOverride (static_cast<const Base*> (this), "audioDeviceAboutToStart"))
+                aboutToStart (device);
+            else
+                pybind11::pybind11_fail ("Tried to call pure virtual function \"AudioIODeviceCallback::audioDeviceAboutToStart\"");
+        }
+
+        startLookahead (device);
     }
 
     void audioDeviceStopped() override
     {
-        PYBIND11_OVERRIDE_PURE (void, Base, audioDeviceStopped);
+        worker.stop();
+
+        POPSICLE_OVERRIDE_PURE (void, Base, audioDeviceStopped);
     }
 
     void audioDeviceError (const juce::String& errorMessage) override
     {
-        PYBIND11_OVERRIDE (void, Base, audioDeviceError, errorMessage);
+        POPSICLE_OVERRIDE (void, Base, audioDeviceError, errorMessage);
     }
 
 private:
-    pybind11::function override_;
+    void renderBlock (const float* const* inputChannelData,
+                      int numInputChannels,
+                      float* const* outputChannelData,
+                      int numOutputChannels,
+                      int numSamples,
+                      const juce::AudioIODeviceCallbackContext& context,
+                      bool isDeviceThread) override
+    {
+        {
+            PyCallbackTimingStats::ScopedBlock timedBlock (timingStats, numSamples);
+
+            pybind11::gil_scoped_acquire gil;
+            timedBlock.gilAcquired();
+
+            if (auto override_ = Helpers::getCachedOverride (static_cast<const Base*> (this), "audioDeviceIOCallbackWithContext"))
+            {
+                if (isDeviceThread)
+                {
+                    // Keep the thread state of the device thread alive, instead of creating and destroying it every block
+                    static thread_local bool threadStateRetained = false;
+                    if (getDispatchMode() == DispatchMode::channelViews && ! std::exchange (threadStateRetained, true))
+                        gil.inc_ref();
+
+                    dispatch (override_, inputChannelData, numInputChannels, outputChannelData, numOutputChannels, numSamples, context);
+                }
+                else
+                {
+                    // There is nobody to propagate errors to on the worker thread, report them and keep rendering
+                    try
+                    {
+                        dispatch (override_, inputChannelData, numInputChannels, outputChannelData, numOutputChannels, numSamples, context);
+                    }
+                    catch (pybind11::error_already_set& e)
+                    {
+                        e.discard_as_unraisable (__func__);
+                    }
+                }
+
+                timedBlock.pythonFinished();
+                return;
+            }
+        }
+
+        Base::audioDeviceIOCallbackWithContext (inputChannelData, numInputChannels, outputChannelData, numOutputChannels, numSamples, context);
+    }
+
+    void dispatch (const Helpers::PythonOverride& callback,
+                   const float* const* inputChannelData,
+                   int numInputChannels,
+                   float* const* outputChannelData,
+                   int numOutputChannels,
+                   int numSamples,
+                   const juce::AudioIODeviceCallbackContext& context)
+    {
+        if (getDispatchMode() == DispatchMode::channelViews)
+            dispatchChannelViews (callback, inputChannelData, numInputChannels, outputChannelData, numOutputChannels, numSamples, context);
+        else
+            dispatchChannelLists (callback, inputChannelData, numInputChannels, outputChannelData, numOutputChannels, numSamples, context);
+    }
+};
+
+// =================================================================================================
+
+/**
+ * @brief An audio device callback forwarding to native C function pointers, that never takes the GIL.
+ */
+struct PyNativeAudioIODeviceCallback : juce::AudioIODeviceCallback
+{
+    using ProcessFunction = void (*) (void* userData, const float* const* inputs, int numInputs, float* const* outputs, int numOutputs, int numSamples);
+    using AboutToStartFunction = void (*) (void* userData, double sampleRate, int bufferSize);
+    using StoppedFunction = void (*) (void* userData);
+
+    PyNativeAudioIODeviceCallback (ProcessFunction process, void* userData, AboutToStartFunction aboutToStart, StoppedFunction stopped) noexcept
+        : process (process)
+        , aboutToStart (aboutToStart)
+        , stopped (stopped)
+        , userData (userData)
+    {
+    }
+
+    void audioDeviceIOCallbackWithContext (const float* const* inputChannelData,
+                                           int numInputChannels,
+                                           float* const* outputChannelData,
+                                           int numOutputChannels,
+                                           int numSamples,
+                                           const juce::AudioIODeviceCallbackContext& context) override
+    {
+        juce::ignoreUnused (context);
+
+        if (process != nullptr)
+        {
+            process (userData, inputChannelData, numInputChannels, outputChannelData, numOutputChannels, numSamples);
+            return;
+        }
+
+        for (int channel = 0; channel < numOutputChannels; ++channel)
+            if (outputChannelData[channel] != nullptr)
+                juce::FloatVectorOperations::clear (outputChannelData[channel], numSamples);
+    }
+
+    void audioDeviceAboutToStart (juce::AudioIODevice* device) override
+    {
+        if (aboutToStart != nullptr && device != nullptr)
+            aboutToStart (userData, device->getCurrentSampleRate(), device->getCurrentBufferSizeSamples());
+    }
+
+    void audioDeviceStopped() override
+    {
+        if (stopped != nullptr)
+            stopped (userData);
+    }
+
+    void* getUserData() const noexcept
+    {
+        return userData;
+    }
+
+private:
+    ProcessFunction process = nullptr;
+    AboutToStartFunction aboutToStart = nullptr;
+    StoppedFunction stopped = nullptr;
+    void* userData = nullptr;
 };
 
 // =================================================================================================
@@ -160,133 +706,635 @@ struct PyAudioIODevice : juce::AudioIODevice
 
     juce::StringArray getOutputChannelNames() override
     {
-        PYBIND11_OVERRIDE_PURE (juce::StringArray, juce::AudioIODevice, getOutputChannelNames);
+        POPSICLE_OVERRIDE_PURE (juce::StringArray, juce::AudioIODevice, getOutputChannelNames);
     }
 
     juce::StringArray getInputChannelNames() override
     {
-        PYBIND11_OVERRIDE_PURE (juce::StringArray, juce::AudioIODevice, getInputChannelNames);
+        POPSICLE_OVERRIDE_PURE (juce::StringArray, juce::AudioIODevice, getInputChannelNames);
     }
 
     std::optional<juce::BigInteger> getDefaultOutputChannels() const override
     {
-        PYBIND11_OVERRIDE (std::optional<juce::BigInteger>, juce::AudioIODevice, getDefaultOutputChannels);
+        POPSICLE_OVERRIDE (std::optional<juce::BigInteger>, juce::AudioIODevice, getDefaultOutputChannels);
     }
 
     std::optional<juce::BigInteger> getDefaultInputChannels() const override
     {
-        PYBIND11_OVERRIDE (std::optional<juce::BigInteger>, juce::AudioIODevice, getDefaultInputChannels);
+        POPSICLE_OVERRIDE (std::optional<juce::BigInteger>, juce::AudioIODevice, getDefaultInputChannels);
     }
 
     juce::Array<double> getAvailableSampleRates() override
     {
-        PYBIND11_OVERRIDE_PURE (juce::Array<double>, juce::AudioIODevice, getAvailableSampleRates);
+        POPSICLE_OVERRIDE_PURE (juce::Array<double>, juce::AudioIODevice, getAvailableSampleRates);
     }
 
     juce::Array<int> getAvailableBufferSizes() override
     {
-        PYBIND11_OVERRIDE_PURE (juce::Array<int>, juce::AudioIODevice, getAvailableBufferSizes);
+        POPSICLE_OVERRIDE_PURE (juce::Array<int>, juce::AudioIODevice, getAvailableBufferSizes);
     }
 
     int getDefaultBufferSize() override
     {
-        PYBIND11_OVERRIDE_PURE (int, juce::AudioIODevice, getDefaultBufferSize);
+        POPSICLE_OVERRIDE_PURE (int, juce::AudioIODevice, getDefaultBufferSize);
     }
 
     juce::String open (const juce::BigInteger& inputChannels, const juce::BigInteger& outputChannels, double sampleRate, int bufferSizeSamples) override
     {
-        PYBIND11_OVERRIDE_PURE (juce::String, juce::AudioIODevice, open, inputChannels, outputChannels, sampleRate, bufferSizeSamples);
+        POPSICLE_OVERRIDE_PURE (juce::String, juce::AudioIODevice, open, inputChannels, outputChannels, sampleRate, bufferSizeSamples);
     }
 
     void close() override
     {
-        PYBIND11_OVERRIDE_PURE (void, juce::AudioIODevice, close);
+        POPSICLE_OVERRIDE_PURE (void, juce::AudioIODevice, close);
     }
 
     bool isOpen() override
     {
-        PYBIND11_OVERRIDE_PURE (bool, juce::AudioIODevice, isOpen);
+        POPSICLE_OVERRIDE_PURE (bool, juce::AudioIODevice, isOpen);
     }
 
     void start (juce::AudioIODeviceCallback* callback) override
     {
-        PYBIND11_OVERRIDE_PURE (void, juce::AudioIODevice, start, callback);
+        POPSICLE_OVERRIDE_PURE (void, juce::AudioIODevice, start, callback);
     }
 
     void stop() override
     {
-        PYBIND11_OVERRIDE_PURE (void, juce::AudioIODevice, stop);
+        POPSICLE_OVERRIDE_PURE (void, juce::AudioIODevice, stop);
     }
 
     bool isPlaying() override
     {
-        PYBIND11_OVERRIDE_PURE (bool, juce::AudioIODevice, isPlaying);
+        POPSICLE_OVERRIDE_PURE (bool, juce::AudioIODevice, isPlaying);
     }
 
     juce::String getLastError() override
     {
-        PYBIND11_OVERRIDE_PURE (juce::String, juce::AudioIODevice, getLastError);
+        POPSICLE_OVERRIDE_PURE (juce::String, juce::AudioIODevice, getLastError);
     }
 
     int getCurrentBufferSizeSamples() override
     {
-        PYBIND11_OVERRIDE_PURE (int, juce::AudioIODevice, getCurrentBufferSizeSamples);
+        POPSICLE_OVERRIDE_PURE (int, juce::AudioIODevice, getCurrentBufferSizeSamples);
     }
 
     double getCurrentSampleRate() override
     {
-        PYBIND11_OVERRIDE_PURE (double, juce::AudioIODevice, getCurrentSampleRate);
+        POPSICLE_OVERRIDE_PURE (double, juce::AudioIODevice, getCurrentSampleRate);
     }
 
     int getCurrentBitDepth() override
     {
-        PYBIND11_OVERRIDE_PURE (int, juce::AudioIODevice, getCurrentBitDepth);
+        POPSICLE_OVERRIDE_PURE (int, juce::AudioIODevice, getCurrentBitDepth);
     }
 
     juce::BigInteger getActiveOutputChannels() const override
     {
-        PYBIND11_OVERRIDE_PURE (juce::BigInteger, juce::AudioIODevice, getActiveOutputChannels);
+        POPSICLE_OVERRIDE_PURE (juce::BigInteger, juce::AudioIODevice, getActiveOutputChannels);
     }
 
     juce::BigInteger getActiveInputChannels() const override
     {
-        PYBIND11_OVERRIDE_PURE (juce::BigInteger, juce::AudioIODevice, getActiveInputChannels);
+        POPSICLE_OVERRIDE_PURE (juce::BigInteger, juce::AudioIODevice, getActiveInputChannels);
     }
 
     int getOutputLatencyInSamples() override
     {
-        PYBIND11_OVERRIDE_PURE (int, juce::AudioIODevice, getOutputLatencyInSamples);
+        POPSICLE_OVERRIDE_PURE (int, juce::AudioIODevice, getOutputLatencyInSamples);
     }
 
     int getInputLatencyInSamples() override
     {
-        PYBIND11_OVERRIDE_PURE (int, juce::AudioIODevice, getInputLatencyInSamples);
+        POPSICLE_OVERRIDE_PURE (int, juce::AudioIODevice, getInputLatencyInSamples);
     }
 
     juce::AudioWorkgroup getWorkgroup() const override
     {
-        PYBIND11_OVERRIDE (juce::AudioWorkgroup, juce::AudioIODevice, getWorkgroup);
+        POPSICLE_OVERRIDE (juce::AudioWorkgroup, juce::AudioIODevice, getWorkgroup);
     }
 
     bool hasControlPanel() const override
     {
-        PYBIND11_OVERRIDE_PURE (bool, juce::AudioIODevice, hasControlPanel);
+        POPSICLE_OVERRIDE_PURE (bool, juce::AudioIODevice, hasControlPanel);
     }
 
     bool showControlPanel() override
     {
-        PYBIND11_OVERRIDE_PURE (bool, juce::AudioIODevice, showControlPanel);
+        POPSICLE_OVERRIDE_PURE (bool, juce::AudioIODevice, showControlPanel);
     }
 
     bool setAudioPreprocessingEnabled (bool shouldBeEnabled) override
     {
-        PYBIND11_OVERRIDE_PURE (bool, juce::AudioIODevice, setAudioPreprocessingEnabled, shouldBeEnabled);
+        POPSICLE_OVERRIDE_PURE (bool, juce::AudioIODevice, setAudioPreprocessingEnabled, shouldBeEnabled);
     }
 
     int getXRunCount() const noexcept override
     {
-        PYBIND11_OVERRIDE (int, juce::AudioIODevice, getXRunCount);
+        POPSICLE_OVERRIDE (int, juce::AudioIODevice, getXRunCount);
+    }
+};
+
+// =================================================================================================
+
+/**
+ * @brief Settings of the offline render device.
+ */
+struct PyRenderAudioIODeviceOptions
+{
+    double sampleRate = 44100.0;
+    int bufferSize = 512;
+    int numInputChannels = 0;
+    int numOutputChannels = 2;
+    double speed = 0.0; /**< Multiple of realtime to render at, or 0 to render as fast as possible. */
+    juce::int64 lengthInSamples = -1; /**< Number of samples after which rendering stops, or -1 to render until stopped. */
+};
+
+// =================================================================================================
+
+/**
+ * @brief A virtual audio device without hardware, driving its callback from a thread at a multiple of realtime or
+ * as fast as possible. Inputs are fed with silence.
+ */
+class PyRenderAudioIODevice : public juce::AudioIODevice, private juce::Thread
+{
+public:
+    PyRenderAudioIODevice (const juce::String& deviceName, const juce::String& typeName, const PyRenderAudioIODeviceOptions& options)
+        : juce::AudioIODevice (deviceName, typeName)
+        , juce::Thread ("popsicle render device")
+        , options (options)
+    {
     }
+
+    ~PyRenderAudioIODevice() override
+    {
+        close();
+    }
+
+    juce::StringArray getOutputChannelNames() override
+    {
+        return makeChannelNames ("Output", options.numOutputChannels);
+    }
+
+    juce::StringArray getInputChannelNames() override
+    {
+        return makeChannelNames ("Input", options.numInputChannels);
+    }
+
+    juce::Array<double> getAvailableSampleRates() override
+    {
+        juce::Array<double> result { 22050.0, 32000.0, 44100.0, 48000.0, 88200.0, 96000.0, 176400.0, 192000.0 };
+        result.addIfNotAlreadyThere (options.sampleRate);
+        result.sort();
+        return result;
+    }
+
+    juce::Array<int> getAvailableBufferSizes() override
+    {
+        juce::Array<int> result { 16, 32, 64, 128, 256, 512, 1024, 2048, 4096 };
+        result.addIfNotAlreadyThere (options.bufferSize);
+        result.sort();
+        return result;
+    }
+
+    int getDefaultBufferSize() override
+    {
+        return options.bufferSize;
+    }
+
+    juce::String open (const juce::BigInteger& inputChannels,
+                       const juce::BigInteger& outputChannels,
+                       double sampleRate,
+                       int bufferSizeSamples) override
+    {
+        close();
+
+        activeInputChannels = inputChannels;
+        activeInputChannels.setRange (options.numInputChannels, activeInputChannels.getHighestBit() + 1, false);
+        activeOutputChannels = outputChannels;
+        activeOutputChannels.setRange (options.numOutputChannels, activeOutputChannels.getHighestBit() + 1, false);
+
+        currentSampleRate = sampleRate > 0.0 ? sampleRate : options.sampleRate;
+        currentBufferSize = bufferSizeSamples > 0 ? bufferSizeSamples : options.bufferSize;
+
+        inputBuffer.setSize (activeInputChannels.countNumberOfSetBits(), currentBufferSize);
+        outputBuffer.setSize (activeOutputChannels.countNumberOfSetBits(), currentBufferSize);
+
+        opened = true;
+
+        return {};
+    }
+
+    void close() override
+    {
+        stop();
+
+        opened = false;
+    }
+
+    bool isOpen() override
+    {
+        return opened;
+    }
+
+    void start (juce::AudioIODeviceCallback* newCallback) override
+    {
+        if (! opened || newCallback == nullptr)
+            return;
+
+        stop();
+
+        newCallback->audioDeviceAboutToStart (this);
+
+        {
+            const juce::ScopedLock sl (callbackLock);
+            callback = newCallback;
+        }
+
+        numSamplesRendered.store (0);
+        finishedEvent.reset();
+        startThread (juce::Thread::Priority::high);
+    }
+
+    void stop() override
+    {
+        juce::AudioIODeviceCallback* lastCallback = nullptr;
+
+        {
+            const juce::ScopedLock sl (callbackLock);
+            lastCallback = std::exchange (callback, nullptr);
+        }
+
+        // The render thread might be waiting for the GIL to finish its block
+        if (PyGILState_Check())
+        {
+            pybind11::gil_scoped_release release;
+            stopThread (-1);
+        }
+        else
+        {
+            stopThread (-1);
+        }
+
+        if (lastCallback != nullptr)
+            lastCallback->audioDeviceStopped();
+    }
+
+    bool isPlaying() override
+    {
+        return isThreadRunning();
+    }
+
+    juce::String getLastError() override
+    {
+        return {};
+    }
+
+    int getCurrentBufferSizeSamples() override
+    {
+        return currentBufferSize;
+    }
+
+    double getCurrentSampleRate() override
+    {
+        return currentSampleRate;
+    }
+
+    int getCurrentBitDepth() override
+    {
+        return 32;
+    }
+
+    juce::BigInteger getActiveOutputChannels() const override
+    {
+        return activeOutputChannels;
+    }
+
+    juce::BigInteger getActiveInputChannels() const override
+    {
+        return activeInputChannels;
+    }
+
+    int getOutputLatencyInSamples() override
+    {
+        return 0;
+    }
+
+    int getInputLatencyInSamples() override
+    {
+        return 0;
+    }
+
+    /** Returns the number of samples passed to the callback since the device was last started. */
+    juce::int64 getNumSamplesRendered() const noexcept
+    {
+        return numSamplesRendered.load();
+    }
+
+    /** Waits until the configured length has been rendered, returns false on timeout or if the device was stopped before. */
+    bool waitForRenderToFinish (int timeOutMilliseconds = -1)
+    {
+        return finishedEvent.wait (timeOutMilliseconds);
+    }
+
+private:
+    static juce::StringArray makeChannelNames (const juce::String& prefix, int numChannels)
+    {
+        juce::StringArray result;
+
+        for (int i = 1; i <= numChannels; ++i)
+            result.add (prefix + " " + juce::String (i));
+
+        return result;
+    }
+
+    void run() override
+    {
+        const auto startTimeMs = juce::Time::getMillisecondCounterHiRes();
+        juce::int64 samplesSinceStart = 0;
+
+        bool reachedLength = false;
+
+        while (! threadShouldExit())
+        {
+            auto numSamples = currentBufferSize;
+
+            if (options.lengthInSamples >= 0)
+            {
+                numSamples = static_cast<int> (juce::jmin (static_cast<juce::int64> (numSamples), options.lengthInSamples - numSamplesRendered.load()));
+
+                if (numSamples <= 0)
+                {
+                    reachedLength = true;
+                    break;
+                }
+            }
+
+            inputBuffer.clear();
+            outputBuffer.clear();
+
+            // Only the pointer is read under the lock, stop() waits for this thread before notifying the callback
+            juce::AudioIODeviceCallback* currentCallback = nullptr;
+
+            {
+                const juce::ScopedLock sl (callbackLock);
+                currentCallback = callback;
+            }
+
+            if (currentCallback != nullptr)
+            {
+                auto hostTimeNs = static_cast<juce::uint64> ((static_cast<double> (numSamplesRendered.load()) * 1.0e9) / currentSampleRate);
+
+                juce::AudioIODeviceCallbackContext context;
+                context.hostTimeNs = &hostTimeNs;
+
+                currentCallback->audioDeviceIOCallbackWithContext (inputBuffer.getArrayOfReadPointers(),
+                                                                   inputBuffer.getNumChannels(),
+                                                                   outputBuffer.getArrayOfWritePointers(),
+                                                                   outputBuffer.getNumChannels(),
+                                                                   numSamples,
+                                                                   context);
+            }
+
+            numSamplesRendered.fetch_add (numSamples);
+            samplesSinceStart += numSamples;
+
+            if (options.speed > 0.0)
+            {
+                const auto targetTimeMs = startTimeMs + (static_cast<double> (samplesSinceStart) * 1000.0) / (currentSampleRate * options.speed);
+                const auto remainingMs = static_cast<int> (targetTimeMs - juce::Time::getMillisecondCounterHiRes());
+
+                if (remainingMs > 0)
+                    wait (remainingMs);
+            }
+        }
+
+        if (reachedLength)
+            finishedEvent.signal();
+    }
+
+    const PyRenderAudioIODeviceOptions options;
+
+    juce::CriticalSection callbackLock;
+    juce::AudioIODeviceCallback* callback = nullptr;
+
+    juce::BigInteger activeInputChannels, activeOutputChannels;
+    juce::AudioBuffer<float> inputBuffer, outputBuffer;
+    double currentSampleRate = 0.0;
+    int currentBufferSize = 0;
+    bool opened = false;
+
+    std::atomic<juce::int64> numSamplesRendered { 0 };
+    juce::WaitableEvent finishedEvent { true };
+};
+
+// =================================================================================================
+
+/**
+ * @brief An audio device type exposing a single offline render device, see PyRenderAudioIODevice.
+ */
+class PyRenderAudioIODeviceType : public juce::AudioIODeviceType
+{
+public:
+    explicit PyRenderAudioIODeviceType (const PyRenderAudioIODeviceOptions& options)
+        : juce::AudioIODeviceType (getRenderTypeName())
+        , options (options)
+    {
+    }
+
+    static juce::String getRenderTypeName()
+    {
+        return "Render";
+    }
+
+    void scanForDevices() override
+    {
+    }
+
+    juce::StringArray getDeviceNames (bool wantInputNames) const override
+    {
+        juce::ignoreUnused (wantInputNames);
+
+        return { getRenderTypeName() };
+    }
+
+    int getDefaultDeviceIndex (bool forInput) const override
+    {
+        juce::ignoreUnused (forInput);
+
+        return 0;
+    }
+
+    int getIndexOfDevice (juce::AudioIODevice* device, bool asInput) const override
+    {
+        juce::ignoreUnused (asInput);
+
+        return dynamic_cast<PyRenderAudioIODevice*> (device) != nullptr ? 0 : -1;
+    }
+
+    bool hasSeparateInputsAndOutputs() const override
+    {
+        return false;
+    }
+
+    juce::AudioIODevice* createDevice (const juce::String& outputDeviceName, const juce::String& inputDeviceName) override
+    {
+        if ((outputDeviceName.isNotEmpty() && outputDeviceName != getRenderTypeName())
+            || (inputDeviceName.isNotEmpty() && inputDeviceName != getRenderTypeName()))
+            return nullptr;
+
+        return new PyRenderAudioIODevice (getRenderTypeName(), getRenderTypeName(), options);
+    }
+
+    const PyRenderAudioIODeviceOptions& getOptions() const noexcept
+    {
+        return options;
+    }
+
+private:
+    const PyRenderAudioIODeviceOptions options;
+};
+
+// =================================================================================================
+
+struct PyMidiInputCallback : juce::MidiInputCallback
+{
+    void handleIncomingMidiMessage (juce::MidiInput* source, const juce::MidiMessage& message) override
+    {
+        POPSICLE_OVERRIDE_PURE (void, juce::MidiInputCallback, handleIncomingMidiMessage, source, message);
+    }
+
+    void handlePartialSysexMessage (juce::MidiInput* source, const juce::uint8* messageData, int numBytesSoFar, double timestamp) override
+    {
+        pybind11::gil_scoped_acquire gil;
+
+        if (auto override_ = Helpers::getCachedOverride (static_cast<const juce::MidiInputCallback*> (this), "handlePartialSysexMessage"); override_)
+        {
+            override_ (source, pybind11::bytes (reinterpret_cast<const char*> (messageData), static_cast<size_t> (numBytesSoFar)), timestamp);
+            return;
+        }
+
+        juce::MidiInputCallback::handlePartialSysexMessage (source, messageData, numBytesSoFar, timestamp);
+    }
+};
+
+// =================================================================================================
+
+/**
+ * @brief A MIDI input callback queueing the incoming messages with their timestamps, without ever taking the GIL.
+ *
+ * The MIDI thread pushes each short message into a single producer single consumer ring buffer of MidiEventRecord,
+ * which python drains in batches as structured numpy arrays. Messages that don't fit in a record (sysex) or that
+ * arrive while the queue is full are dropped and counted.
+ */
+class PyMidiInputQueue : public juce::MidiInputCallback
+{
+public:
+    explicit PyMidiInputQueue (int capacity)
+        : fifo (juce::jmax (1, capacity) + 1)
+        , records (static_cast<size_t> (fifo.getTotalSize()))
+        , scratch (static_cast<size_t> (fifo.getTotalSize()))
+    {
+    }
+
+    void handleIncomingMidiMessage (juce::MidiInput*, const juce::MidiMessage& message) override
+    {
+        push (message);
+    }
+
+    bool push (const juce::MidiMessage& message) noexcept
+    {
+        const auto* data = message.getRawData();
+        const auto numBytes = message.getRawDataSize();
+
+        if (numBytes <= 0 || numBytes > 3 || message.isSysEx() || message.isMetaEvent())
+        {
+            numDropped.fetch_add (1, std::memory_order_relaxed);
+            return false;
+        }
+
+        const auto scope = fifo.write (1);
+        if (scope.blockSize1 + scope.blockSize2 == 0)
+        {
+            numDropped.fetch_add (1, std::memory_order_relaxed);
+            return false;
+        }
+
+        records[static_cast<size_t> (scope.blockSize1 > 0 ? scope.startIndex1 : scope.startIndex2)] = {
+            message.getTimeStamp(),
+            data[0],
+            numBytes > 1 ? data[1] : juce::uint8 (0),
+            numBytes > 2 ? data[2] : juce::uint8 (0)
+        };
+
+        return true;
+    }
+
+    /** Moves up to maxRecords queued records into the internal scratch space, returning how many were read. */
+    int pop (int maxRecords) noexcept
+    {
+        const auto scope = fifo.read (maxRecords < 0 ? fifo.getNumReady() : juce::jmin (maxRecords, fifo.getNumReady()));
+
+        std::copy_n (records.data() + scope.startIndex1, scope.blockSize1, scratch.data());
+        std::copy_n (records.data() + scope.startIndex2, scope.blockSize2, scratch.data() + scope.blockSize1);
+
+        return scope.blockSize1 + scope.blockSize2;
+    }
+
+    /**
+     * Moves up to maxRecords queued records into a MIDI buffer, returning how many were read.
+     *
+     * Events are placed at the sample position of their timestamp relative to startTime. Doesn't need the GIL, so the
+     * destination must not be owned by python.
+     */
+    int popInto (juce::MidiBuffer& destination, double startTime, double sampleRate, int maxRecords)
+    {
+        const auto scope = fifo.read (maxRecords < 0 ? fifo.getNumReady() : juce::jmin (maxRecords, fifo.getNumReady()));
+
+        scope.forEach ([&] (int index)
+        {
+            const auto& record = records[static_cast<size_t> (index)];
+            const juce::uint8 bytes[] = { record.status, record.data1, record.data2 };
+            const auto samplePosition = juce::jmax (0, juce::roundToInt ((record.timestamp - startTime) * sampleRate));
+
+            destination.addEvent (bytes, juce::MidiMessage::getMessageLengthFromFirstByte (bytes[0]), samplePosition);
+        });
+
+        return scope.blockSize1 + scope.blockSize2;
+    }
+
+    const MidiEventRecord* getPoppedRecords() const noexcept
+    {
+        return scratch.data();
+    }
+
+    int getNumReady() const noexcept
+    {
+        return fifo.getNumReady();
+    }
+
+    int getCapacity() const noexcept
+    {
+        return fifo.getTotalSize() - 1;
+    }
+
+    int getNumDropped() const noexcept
+    {
+        return numDropped.load (std::memory_order_relaxed);
+    }
+
+    /** Discards the queued records and the dropped count, it must not be called while the queue is being fed. */
+    void reset() noexcept
+    {
+        fifo.reset();
+        numDropped.store (0, std::memory_order_relaxed);
+    }
+
+private:
+    juce::AbstractFifo fifo;
+    std::vector<MidiEventRecord> records;
+    std::vector<MidiEventRecord> scratch;
+    std::atomic<int> numDropped { 0 };
 };
 
 } // namespace popsicle::Bindings
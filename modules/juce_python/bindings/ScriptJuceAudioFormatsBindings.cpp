@@ -18,6 +18,18 @@
 
 #include "ScriptJuceAudioFormatsBindings.h"
 
+#define JUCE_PYTHON_INCLUDE_PYBIND11_NUMPY
+#include "../utilities/PyBind11Includes.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <deque>
+#include <limits>
+#include <string>
+#include <type_traits>
+#include <vector>
+
 namespace popsicle::Bindings {
 
 using namespace juce;
@@ -27,6 +39,1278 @@ using namespace py::literals;
 
 // ============================================================================================
 
+/** Reads the samples of an AudioBuffer as floating point data, used to load samplers from memory. */
+class AudioBufferFormatReader : public AudioFormatReader
+{
+public:
+    AudioBufferFormatReader (const AudioBuffer<float>& sourceBuffer, double sourceSampleRate)
+        : AudioFormatReader (nullptr, "AudioBuffer")
+        , buffer (sourceBuffer)
+    {
+        sampleRate = sourceSampleRate;
+        bitsPerSample = 32;
+        lengthInSamples = buffer.getNumSamples();
+        numChannels = static_cast<unsigned int> (buffer.getNumChannels());
+        usesFloatingPointData = true;
+    }
+
+    bool readSamples (int* const* destChannels, int numDestChannels, int startOffsetInDestBuffer,
+                      int64 startSampleInFile, int numSamples) override
+    {
+        const auto available = Range<int64> (0, lengthInSamples)
+            .getIntersectionWith (Range<int64> (startSampleInFile, startSampleInFile + numSamples));
+
+        for (int channel = 0; channel < numDestChannels; ++channel)
+        {
+            if (destChannels[channel] == nullptr)
+                continue;
+
+            auto* destination = reinterpret_cast<float*> (destChannels[channel]) + startOffsetInDestBuffer;
+            FloatVectorOperations::clear (destination, numSamples);
+
+            if (channel < buffer.getNumChannels() && ! available.isEmpty())
+                FloatVectorOperations::copy (destination + (available.getStart() - startSampleInFile),
+                                             buffer.getReadPointer (channel, static_cast<int> (available.getStart())),
+                                             static_cast<int> (available.getLength()));
+        }
+
+        return true;
+    }
+
+private:
+    const AudioBuffer<float>& buffer;
+};
+
+// ============================================================================================
+
+template <class F>
+decltype(auto) withAudioSampleType (const py::object& channels, F&& func)
+{
+    auto firstChannel = channels;
+    if (! py::isinstance<py::buffer> (channels) && py::isinstance<py::sequence> (channels) && py::len (channels) > 0)
+        firstChannel = py::reinterpret_borrow<py::sequence> (channels)[0];
+
+    if (! py::isinstance<py::buffer> (firstChannel))
+        throw py::type_error ("Audio data must be a 2D buffer or a sequence of 1D buffers");
+
+    const auto info = py::reinterpret_borrow<py::buffer> (firstChannel).request();
+
+    if (Helpers::isBufferFormatOf<float> (info))
+        return func (float{});
+
+    if (Helpers::isBufferFormatOf<int> (info))
+        return func (int{});
+
+    if (Helpers::isBufferFormatOf<int16_t> (info))
+        return func (int16_t{});
+
+    throw py::type_error ("Audio data must contain float32, int32 or int16 samples, got '" + info.format + "'");
+}
+
+template <class F>
+decltype(auto) withAudioSampleType (const py::dtype& type, F&& func)
+{
+    if (type.equal (py::dtype::of<float>()))
+        return func (float{});
+
+    if (type.equal (py::dtype::of<int>()))
+        return func (int{});
+
+    if (type.equal (py::dtype::of<int16_t>()))
+        return func (int16_t{});
+
+    throw py::type_error ("Audio data can only be read as float32, int32 or int16 samples");
+}
+
+/** Converts floating point samples read through the integer interface of a reader to full scale 32 bit integers. */
+void convertFloatSamplesToInt32 (int* samples, int numSamples) noexcept
+{
+    for (int i = 0; i < numSamples; ++i)
+    {
+        float value;
+        std::memcpy (&value, samples + i, sizeof (float));
+
+        samples[i] = static_cast<int> (jlimit (-2147483648.0, 2147483647.0, static_cast<double> (value) * 2147483648.0));
+    }
+}
+
+bool readSamplesInto (AudioFormatReader& reader, float* const* channels, int numChannels, int64 startSample, int numSamples)
+{
+    return numChannels == 0 || reader.read (channels, numChannels, startSample, numSamples);
+}
+
+bool readSamplesInto (AudioFormatReader& reader, int* const* channels, int numChannels, int64 startSample, int numSamples)
+{
+    if (numChannels == 0)
+        return true;
+
+    if (! reader.read (channels, numChannels, startSample, numSamples, false))
+        return false;
+
+    if (reader.usesFloatingPointData)
+    {
+        for (int channel = 0; channel < numChannels; ++channel)
+            convertFloatSamplesToInt32 (channels[channel], numSamples);
+    }
+
+    return true;
+}
+
+bool readSamplesInto (AudioFormatReader& reader, int16_t* const* channels, int numChannels, int64 startSample, int numSamples)
+{
+    if (numChannels == 0)
+        return true;
+
+    // There is no 16 bit interface in the readers, so samples are decoded in small chunks and narrowed in place
+    constexpr int samplesPerChunk = 4096;
+    const auto chunkSize = jmin (samplesPerChunk, numSamples);
+
+    HeapBlock<int> scratch (static_cast<size_t> (numChannels) * static_cast<size_t> (chunkSize));
+    std::vector<int*> scratchChannels;
+    for (int channel = 0; channel < numChannels; ++channel)
+        scratchChannels.push_back (scratch.get() + channel * chunkSize);
+
+    for (int offset = 0; offset < numSamples; offset += chunkSize)
+    {
+        const auto numToRead = jmin (chunkSize, numSamples - offset);
+
+        if (! reader.read (scratchChannels.data(), numChannels, startSample + offset, numToRead, false))
+            return false;
+
+        for (int channel = 0; channel < numChannels; ++channel)
+        {
+            const auto* source = scratchChannels[static_cast<size_t> (channel)];
+            auto* destination = channels[channel] + offset;
+
+            if (reader.usesFloatingPointData)
+            {
+                for (int i = 0; i < numToRead; ++i)
+                {
+                    float value;
+                    std::memcpy (&value, source + i, sizeof (float));
+
+                    destination[i] = static_cast<int16_t> (jlimit (-32768.0f, 32767.0f, value * 32768.0f));
+                }
+            }
+            else
+            {
+                for (int i = 0; i < numToRead; ++i)
+                    destination[i] = static_cast<int16_t> (source[i] >> 16);
+            }
+        }
+    }
+
+    return true;
+}
+
+// ============================================================================================
+
+int floatBitsAsInt (float value) noexcept
+{
+    int result;
+    std::memcpy (&result, &value, sizeof (float));
+    return result;
+}
+
+int toWriterSample (int sample, bool floatingPoint) noexcept
+{
+    return floatingPoint ? floatBitsAsInt (static_cast<float> (sample / 2147483648.0)) : sample;
+}
+
+int toWriterSample (int16_t sample, bool floatingPoint) noexcept
+{
+    return floatingPoint ? floatBitsAsInt (sample / 32768.0f) : static_cast<int> (sample) * 65536;
+}
+
+/** Writes integer samples converting them in small chunks to the sample format expected by the writer. */
+template <class T>
+bool writeSamplesInChunks (AudioFormatWriter& writer, const T* const* channels, int numChannels, int numSamples)
+{
+    constexpr int samplesPerChunk = 4096;
+    const auto chunkSize = jmin (samplesPerChunk, numSamples);
+    const auto floatingPoint = writer.isFloatingPoint();
+
+    HeapBlock<int> scratch (static_cast<size_t> (numChannels) * static_cast<size_t> (chunkSize));
+    std::vector<const int*> scratchChannels;
+    for (int channel = 0; channel < numChannels; ++channel)
+        scratchChannels.push_back (scratch.get() + channel * chunkSize);
+
+    scratchChannels.push_back (nullptr);
+
+    for (int offset = 0; offset < numSamples; offset += chunkSize)
+    {
+        const auto numToWrite = jmin (chunkSize, numSamples - offset);
+
+        for (int channel = 0; channel < numChannels; ++channel)
+        {
+            auto* destination = scratch.get() + channel * chunkSize;
+
+            for (int i = 0; i < numToWrite; ++i)
+                destination[i] = toWriterSample (channels[channel][offset + i], floatingPoint);
+        }
+
+        if (! writer.write (scratchChannels.data(), numToWrite))
+            return false;
+    }
+
+    return true;
+}
+
+bool writeSamplesFrom (AudioFormatWriter& writer, const float* const* channels, int numChannels, int numSamples)
+{
+    // Floating point writers receive the channels as they are, so they must be null terminated
+    std::vector<const float*> sourceChannels (channels, channels + numChannels);
+    sourceChannels.push_back (nullptr);
+
+    return writer.writeFromFloatArrays (sourceChannels.data(), numChannels, numSamples);
+}
+
+bool writeSamplesFrom (AudioFormatWriter& writer, const int* const* channels, int numChannels, int numSamples)
+{
+    if (writer.isFloatingPoint())
+        return writeSamplesInChunks (writer, channels, numChannels, numSamples);
+
+    std::vector<const int*> sourceChannels (channels, channels + numChannels);
+    sourceChannels.push_back (nullptr);
+
+    return writer.write (sourceChannels.data(), numSamples);
+}
+
+bool writeSamplesFrom (AudioFormatWriter& writer, const int16_t* const* channels, int numChannels, int numSamples)
+{
+    return writeSamplesInChunks (writer, channels, numChannels, numSamples);
+}
+
+/** A threaded writer remembering the number of channels of its writer, to validate the data pushed from python. */
+class ThreadedAudioFormatWriter : public AudioFormatWriter::ThreadedWriter
+{
+public:
+    ThreadedAudioFormatWriter (AudioFormatWriter* writer, TimeSliceThread& backgroundThread, int numSamplesToBuffer)
+        : AudioFormatWriter::ThreadedWriter (writer, backgroundThread, numSamplesToBuffer)
+        , numChannels (writer->getNumChannels())
+    {
+    }
+
+    int getNumChannels() const noexcept
+    {
+        return numChannels;
+    }
+
+private:
+    const int numChannels;
+};
+
+/** Hands the ownership of a python stream to the created writer, python keeps it if the writer can't be created. */
+template <class F>
+AudioFormatWriter* createWriterTakingStream (py::object stream, F&& createWriter)
+{
+    if (! py::isinstance<OutputStream> (stream))
+        throw py::type_error ("The stream to write to must be an instance of OutputStream");
+
+    auto* writer = createWriter (stream.cast<OutputStream*>());
+    if (writer != nullptr)
+        stream.release();
+
+    return writer;
+}
+
+/** Tries all the formats on a stream, the reader owns the stream when one is created, otherwise the caller still does. */
+AudioFormatReader* createReaderForStream (AudioFormatManager& formatManager, InputStream* stream)
+{
+    const auto originalPosition = stream->getPosition();
+
+    for (auto* format : formatManager)
+    {
+        if (auto* reader = format->createReaderFor (stream, false))
+            return reader;
+
+        stream->setPosition (originalPosition);
+    }
+
+    return nullptr;
+}
+
+/** A memory stream over an exported python buffer, which stays locked until the stream is deleted. */
+class BufferInputStream : public MemoryInputStream
+{
+public:
+    explicit BufferInputStream (std::unique_ptr<py::buffer_info> bufferInfo)
+        : MemoryInputStream (bufferInfo->ptr, static_cast<size_t> (bufferInfo->size * bufferInfo->itemsize), false)
+        , info (std::move (bufferInfo))
+    {
+    }
+
+    ~BufferInputStream() override
+    {
+        // Readers can outlive the interpreter, which stops being initialized as soon as its finalization starts: the
+        // GIL can't be taken anymore then, so the exported buffer is leaked instead of being released
+        if (! Py_IsInitialized())
+        {
+            (void) info.release();
+            return;
+        }
+
+        py::gil_scoped_acquire acquire;
+        info.reset();
+    }
+
+private:
+    std::unique_ptr<py::buffer_info> info;
+};
+
+/** Opens a reader decompressing a zip entry while reading, the zip file must outlive it. */
+AudioFormatReader* createReaderForZipEntry (AudioFormatManager& formatManager, ZipFile& zipFile, int index)
+{
+    std::unique_ptr<InputStream> stream (zipFile.createStreamForEntry (index));
+    if (stream == nullptr)
+        return nullptr;
+
+    auto* reader = createReaderForStream (formatManager, stream.get());
+    if (reader != nullptr)
+        stream.release();
+
+    return reader;
+}
+
+/** Returns true if the buffer is laid out as a single contiguous block of memory. */
+bool isContiguousBuffer (const py::buffer_info& info)
+{
+    auto expectedStride = info.itemsize;
+
+    for (auto dimension = info.ndim; --dimension >= 0;)
+    {
+        if (info.shape[static_cast<size_t> (dimension)] > 1 && info.strides[static_cast<size_t> (dimension)] != expectedStride)
+            return false;
+
+        expectedStride *= info.shape[static_cast<size_t> (dimension)];
+    }
+
+    return true;
+}
+
+// ============================================================================================
+
+struct MemoryMappedAudioFormatReaderPublicist : MemoryMappedAudioFormatReader
+{
+    using MemoryMappedAudioFormatReader::dataChunkStart;
+    using MemoryMappedAudioFormatReader::bytesPerFrame;
+};
+
+/** Returns true for AIFC files storing little endian samples, which the AIFF readers handle transparently. */
+bool isLittleEndianAiffFile (const File& file)
+{
+    FileInputStream input (file);
+    if (! input.openedOk())
+        return false;
+
+    char chunkType[4], formType[4];
+    if (input.read (chunkType, 4) != 4 || std::memcmp (chunkType, "FORM", 4) != 0)
+        return false;
+
+    input.readIntBigEndian();
+    if (input.read (formType, 4) != 4 || std::memcmp (formType, "AIFC", 4) != 0)
+        return false;
+
+    while (input.read (chunkType, 4) == 4)
+    {
+        const auto chunkSize = static_cast<uint32> (input.readIntBigEndian());
+
+        if (std::memcmp (chunkType, "COMM", 4) == 0)
+        {
+            char compressionType[4];
+            input.skipNextBytes (18);
+            return input.read (compressionType, 4) == 4 && std::memcmp (compressionType, "sowt", 4) == 0;
+        }
+
+        input.skipNextBytes (static_cast<int64> (chunkSize) + (chunkSize & 1));
+    }
+
+    return false;
+}
+
+/** Returns the numpy type of the samples stored in the file of an uncompressed memory mapped reader. */
+py::dtype getMappedSampleType (const MemoryMappedAudioFormatReader& reader)
+{
+    const auto formatName = reader.getFormatName();
+    const auto isWav = formatName.containsIgnoreCase ("WAV");
+
+    if (! isWav && ! formatName.containsIgnoreCase ("AIFF"))
+        throw py::value_error ("Sample views are only available for WAV and AIFF files");
+
+    const std::string byteOrder = isWav || isLittleEndianAiffFile (reader.getFile()) ? "<" : ">";
+
+    if (reader.usesFloatingPointData && (reader.bitsPerSample == 32 || reader.bitsPerSample == 64))
+        return py::dtype::from_args (py::str (byteOrder + "f" + std::to_string (reader.bitsPerSample / 8)));
+
+    switch (reader.bitsPerSample)
+    {
+        case 8:  return py::dtype::from_args (py::str (isWav ? "u1" : "i1"));
+        case 16: return py::dtype::from_args (py::str (byteOrder + "i2"));
+        case 32: return py::dtype::from_args (py::str (byteOrder + "i4"));
+        default: break;
+    }
+
+    throw py::value_error ("Samples of " + std::to_string (reader.bitsPerSample) + " bits have no matching numpy type, use readArray instead");
+}
+
+// ============================================================================================
+
+File toFile (const py::handle& path)
+{
+    if (py::isinstance<File> (path))
+        return path.cast<File>();
+
+    if (py::isinstance<py::str> (path) || py::hasattr (path, "__fspath__"))
+        return File::getCurrentWorkingDirectory().getChildFile (py::str (py::module_::import ("os").attr ("fspath") (path)).cast<String>());
+
+    throw py::type_error ("Files must be specified as File instances or paths");
+}
+
+enum class AudioSampleType
+{
+    float32,
+    int32,
+    int16
+};
+
+AudioSampleType toAudioSampleType (const py::object& dtype)
+{
+    return withAudioSampleType (py::dtype::from_args (dtype), [](auto sampleType)
+    {
+        using SampleType = decltype (sampleType);
+
+        if constexpr (std::is_same_v<SampleType, float>)
+            return AudioSampleType::float32;
+        else if constexpr (std::is_same_v<SampleType, int>)
+            return AudioSampleType::int32;
+        else
+            return AudioSampleType::int16;
+    });
+}
+
+size_t getSampleSize (AudioSampleType sampleType) noexcept
+{
+    return sampleType == AudioSampleType::int16 ? sizeof (int16_t) : sizeof (float);
+}
+
+py::dtype toDtype (AudioSampleType sampleType)
+{
+    switch (sampleType)
+    {
+        case AudioSampleType::int32: return py::dtype::of<int>();
+        case AudioSampleType::int16: return py::dtype::of<int16_t>();
+        case AudioSampleType::float32: break;
+    }
+
+    return py::dtype::of<float>();
+}
+
+struct AudioFileDecodeOptions
+{
+    int numChannels = -1;
+    AudioSampleType sampleType = AudioSampleType::float32;
+    double maxSeconds = 0.0;
+    double sampleRate = 0.0;
+    ResamplingInterpolator interpolator = ResamplingInterpolator::lagrange;
+};
+
+struct DecodedAudioFile
+{
+    int index = 0;
+    String error;
+    double sampleRate = 0.0;
+    int numChannels = 0;
+    int numSamples = 0;
+    HeapBlock<char> data;
+};
+
+/** Reads the samples of a file remixed to numChannels: mono is a mix of all the channels, otherwise missing channels repeat the last one of the file. */
+bool readRemixedSamples (AudioFormatReader& reader, float* const* channels, int numChannels, int numSamples)
+{
+    const auto numSourceChannels = static_cast<int> (reader.numChannels);
+
+    if (numChannels == 1 && numSourceChannels > 1)
+    {
+        // Mixed down in small chunks, so the file is never decoded whole in a second buffer
+        constexpr int samplesPerChunk = 4096;
+        AudioBuffer<float> chunk (numSourceChannels, jmin (samplesPerChunk, numSamples));
+        const auto gain = 1.0f / static_cast<float> (numSourceChannels);
+
+        for (int offset = 0; offset < numSamples; offset += chunk.getNumSamples())
+        {
+            const auto numToRead = jmin (chunk.getNumSamples(), numSamples - offset);
+
+            if (! reader.read (chunk.getArrayOfWritePointers(), numSourceChannels, offset, numToRead))
+                return false;
+
+            FloatVectorOperations::copyWithMultiply (channels[0] + offset, chunk.getReadPointer (0), gain, numToRead);
+
+            for (int channel = 1; channel < numSourceChannels; ++channel)
+                FloatVectorOperations::addWithMultiply (channels[0] + offset, chunk.getReadPointer (channel), gain, numToRead);
+        }
+
+        return true;
+    }
+
+    const auto numChannelsToRead = jmin (numChannels, numSourceChannels);
+    if (! reader.read (channels, numChannelsToRead, 0, numSamples))
+        return false;
+
+    for (int channel = numChannelsToRead; channel < numChannels; ++channel)
+        FloatVectorOperations::copy (channels[channel], channels[numChannelsToRead - 1], numSamples);
+
+    return true;
+}
+
+/** Converts contiguous float samples to the requested sample type in place, packing them at the start of the memory. */
+void convertDecodedSamplesInPlace (char* data, size_t numSamples, AudioSampleType sampleType) noexcept
+{
+    switch (sampleType)
+    {
+        case AudioSampleType::int32:
+            for (size_t i = 0; i < numSamples; ++i)
+            {
+                float value;
+                std::memcpy (&value, data + i * sizeof (float), sizeof (float));
+
+                const auto sample = static_cast<int> (jlimit (-2147483648.0, 2147483647.0, static_cast<double> (value) * 2147483648.0));
+                std::memcpy (data + i * sizeof (int), &sample, sizeof (int));
+            }
+            break;
+
+        case AudioSampleType::int16:
+            // Each narrowed sample lands at or before the float it comes from, so a forward pass never overwrites unread input
+            for (size_t i = 0; i < numSamples; ++i)
+            {
+                float value;
+                std::memcpy (&value, data + i * sizeof (float), sizeof (float));
+
+                const auto sample = static_cast<int16_t> (jlimit (-32768.0f, 32767.0f, value * 32768.0f));
+                std::memcpy (data + i * sizeof (int16_t), &sample, sizeof (int16_t));
+            }
+            break;
+
+        case AudioSampleType::float32:
+            break;
+    }
+}
+
+/**
+ * Decodes a whole file in contiguous (channels x samples) memory, remixing, resampling and converting it as requested.
+ *
+ * Samples are decoded straight into the result memory, only resampling needs an intermediate buffer at the file rate.
+ * Integer types are converted in place from the decoded floats, so the memory is first sized for float samples.
+ */
+DecodedAudioFile decodeAudioFile (AudioFormatManager& formatManager, const File& file, const AudioFileDecodeOptions& options)
+{
+    DecodedAudioFile result;
+
+    std::unique_ptr<AudioFormatReader> reader (formatManager.createReaderFor (file));
+    if (reader == nullptr || reader->numChannels == 0 || reader->sampleRate <= 0.0)
+    {
+        result.error = "Unable to open a reader for " + file.getFullPathName();
+        return result;
+    }
+
+    auto numInputSamples = reader->lengthInSamples;
+    if (options.maxSeconds > 0.0)
+        numInputSamples = jmin (numInputSamples, static_cast<int64> (std::ceil (options.maxSeconds * reader->sampleRate)));
+
+    const auto ratio = options.sampleRate > 0.0 ? reader->sampleRate / options.sampleRate : 1.0;
+    const auto numOutputSamples = getResampledLength (numInputSamples, ratio);
+
+    if (numInputSamples > std::numeric_limits<int>::max() || numOutputSamples > std::numeric_limits<int>::max())
+    {
+        result.error = "Too many samples to decode in " + file.getFullPathName();
+        return result;
+    }
+
+    const auto numChannels = options.numChannels > 0 ? options.numChannels : static_cast<int> (reader->numChannels);
+    const auto numSamples = static_cast<size_t> (numChannels) * static_cast<size_t> (numOutputSamples);
+
+    result.sampleRate = ratio != 1.0 ? options.sampleRate : reader->sampleRate;
+    result.numChannels = numChannels;
+    result.numSamples = static_cast<int> (numOutputSamples);
+    result.data.allocate (numSamples * sizeof (float), false);
+
+    std::vector<float*> channels;
+    for (int channel = 0; channel < numChannels; ++channel)
+        channels.push_back (reinterpret_cast<float*> (result.data.get()) + static_cast<size_t> (channel) * static_cast<size_t> (result.numSamples));
+
+    bool decoded;
+
+    if (ratio != 1.0)
+    {
+        AudioBuffer<float> audio (numChannels, static_cast<int> (numInputSamples));
+        decoded = readRemixedSamples (*reader, audio.getArrayOfWritePointers(), numChannels, audio.getNumSamples());
+
+        for (int channel = 0; decoded && channel < numChannels; ++channel)
+            resampleChannel (options.interpolator, audio.getReadPointer (channel), audio.getNumSamples(),
+                             channels[static_cast<size_t> (channel)], result.numSamples, ratio);
+    }
+    else
+    {
+        decoded = readRemixedSamples (*reader, channels.data(), numChannels, result.numSamples);
+    }
+
+    if (! decoded)
+    {
+        result.error = "Unable to decode the samples of " + file.getFullPathName();
+        result.data.free();
+        return result;
+    }
+
+    convertDecodedSamplesInPlace (result.data.get(), numSamples, options.sampleType);
+
+    if (const auto sampleSize = getSampleSize (options.sampleType); sampleSize < sizeof (float))
+        result.data.realloc (numSamples * sampleSize);
+
+    return result;
+}
+
+/**
+ * Decodes many files concurrently on a thread pool, delivering the results in completion order.
+ *
+ * Only a bounded number of files are decoded ahead of the consumer, so that the memory used doesn't depend on the number
+ * of files. The format manager must not be modified while decoding.
+ */
+class AudioFileBatchDecoder
+{
+public:
+    AudioFileBatchDecoder (AudioFormatManager& manager, Array<File> filesToDecode, AudioFileDecodeOptions decodeOptions, int numThreads)
+        : formatManager (manager)
+        , files (std::move (filesToDecode))
+        , options (decodeOptions)
+        , pool (ThreadPoolOptions{}.withThreadName ("Audio decoding").withNumberOfThreads (numThreads))
+        , maxPendingFiles (numThreads * 2)
+    {
+        scheduleJobs();
+    }
+
+    ~AudioFileBatchDecoder()
+    {
+        cancelled = true;
+        pool.removeAllJobs (true, -1);
+    }
+
+    int getNumFiles() const noexcept
+    {
+        return files.size();
+    }
+
+    const AudioFileDecodeOptions& getOptions() const noexcept
+    {
+        return options;
+    }
+
+    /** Waits for the next decoded file, returns false once all the files have been delivered. Called without the GIL. */
+    bool getNextResult (DecodedAudioFile& result)
+    {
+        if (numDelivered >= files.size())
+            return false;
+
+        for (;;)
+        {
+            {
+                const ScopedLock sl (lock);
+
+                if (! completed.empty())
+                {
+                    result = std::move (completed.front());
+                    completed.pop_front();
+                    --numPendingFiles;
+                    break;
+                }
+            }
+
+            resultAvailable.wait (100);
+        }
+
+        ++numDelivered;
+        scheduleJobs();
+        return true;
+    }
+
+private:
+    void scheduleJobs()
+    {
+        const ScopedLock sl (lock);
+
+        while (nextFile < files.size() && numPendingFiles < maxPendingFiles)
+        {
+            const auto index = nextFile++;
+            ++numPendingFiles;
+
+            pool.addJob ([this, index]
+            {
+                auto result = cancelled ? DecodedAudioFile{} : decodeAudioFile (formatManager, files.getReference (index), options);
+                result.index = index;
+
+                {
+                    const ScopedLock sl2 (lock);
+                    completed.push_back (std::move (result));
+                }
+
+                resultAvailable.signal();
+            });
+        }
+    }
+
+    AudioFormatManager& formatManager;
+    const Array<File> files;
+    const AudioFileDecodeOptions options;
+
+    CriticalSection lock;
+    WaitableEvent resultAvailable;
+    std::deque<DecodedAudioFile> completed;
+    std::atomic<bool> cancelled { false };
+    int nextFile = 0;
+    int numPendingFiles = 0;
+    int numDelivered = 0;
+
+    ThreadPool pool;
+    const int maxPendingFiles;
+};
+
+// ============================================================================================
+
+/**
+ * Multi resolution min, max and RMS overview of a reader, where every level bins the samples of the previous one.
+ *
+ * The first level is computed in a single streaming pass over the reader, the others are merged from the level below.
+ * Queries pick the coarsest level with bins no larger than a pixel, so they visit a bounded number of bins per pixel
+ * whatever the zoom. Pyramids can be cached on disk, keyed by the path, size and modification time of the source file.
+ */
+class AudioPeakPyramid
+{
+public:
+    enum Value
+    {
+        minimum,
+        maximum,
+        rms,
+        numValues
+    };
+
+    struct Level
+    {
+        int64 binSize = 0;
+        int numBins = 0;
+        std::vector<float> values; // [channel][bin][value]
+    };
+
+    /** Identifies the version of a source file a cached pyramid was built from. */
+    struct SourceKey
+    {
+        String path;
+        int64 size = 0;
+        int64 modificationTime = 0;
+
+        static SourceKey fromFile (const File& file)
+        {
+            return { file.getFullPathName(), file.getSize(), file.getLastModificationTime().toMilliseconds() };
+        }
+
+        bool operator== (const SourceKey& other) const
+        {
+            return path == other.path && size == other.size && modificationTime == other.modificationTime;
+        }
+    };
+
+    /** Reads the whole reader, called without the GIL. */
+    static std::unique_ptr<AudioPeakPyramid> build (AudioFormatReader& reader, int binSize, int factor)
+    {
+        auto pyramid = std::make_unique<AudioPeakPyramid>();
+        pyramid->sampleRate = reader.sampleRate;
+        pyramid->numChannels = static_cast<int> (reader.numChannels);
+        pyramid->lengthInSamples = jmax (static_cast<int64> (0), reader.lengthInSamples);
+        pyramid->factor = factor;
+
+        if (! pyramid->buildFirstLevel (reader, binSize))
+            return nullptr;
+
+        while (pyramid->levels.back().numBins > 1)
+            pyramid->mergeLevel();
+
+        return pyramid;
+    }
+
+    /** Loads a pyramid saved with save, returning nullptr when the file can't be parsed. */
+    static std::unique_ptr<AudioPeakPyramid> load (const File& file, SourceKey* sourceKey = nullptr)
+    {
+        FileInputStream stream (file);
+        if (! stream.openedOk() || stream.readInt() != magic || stream.readInt() != version)
+            return nullptr;
+
+        SourceKey key;
+        key.path = stream.readString();
+        key.size = stream.readInt64();
+        key.modificationTime = stream.readInt64();
+
+        auto pyramid = std::make_unique<AudioPeakPyramid>();
+        pyramid->sampleRate = stream.readDouble();
+        pyramid->numChannels = stream.readInt();
+        pyramid->lengthInSamples = stream.readInt64();
+        pyramid->factor = stream.readInt();
+
+        const auto numLevels = stream.readInt();
+        if (pyramid->numChannels < 0 || pyramid->lengthInSamples < 0 || numLevels <= 0)
+            return nullptr;
+
+        for (int index = 0; index < numLevels; ++index)
+        {
+            Level level;
+            level.binSize = stream.readInt64();
+            level.numBins = stream.readInt();
+
+            if (level.binSize <= 0 || level.numBins < 0)
+                return nullptr;
+
+            const auto numFloats = static_cast<size_t> (pyramid->numChannels) * static_cast<size_t> (level.numBins) * numValues;
+            if (static_cast<int64> (numFloats * sizeof (float)) > stream.getNumBytesRemaining())
+                return nullptr;
+
+            level.values.resize (numFloats);
+            stream.read (level.values.data(), static_cast<int> (numFloats * sizeof (float)));
+
+            pyramid->levels.push_back (std::move (level));
+        }
+
+        if (sourceKey != nullptr)
+            *sourceKey = std::move (key);
+
+        return pyramid;
+    }
+
+    /** Writes the pyramid through a temporary file, so that readers never see a partially written cache. */
+    bool save (const File& file, const SourceKey& sourceKey = {}) const
+    {
+        TemporaryFile temporaryFile (file);
+
+        {
+            FileOutputStream stream (temporaryFile.getFile());
+            if (! stream.openedOk())
+                return false;
+
+            stream.writeInt (magic);
+            stream.writeInt (version);
+            stream.writeString (sourceKey.path);
+            stream.writeInt64 (sourceKey.size);
+            stream.writeInt64 (sourceKey.modificationTime);
+            stream.writeDouble (sampleRate);
+            stream.writeInt (numChannels);
+            stream.writeInt64 (lengthInSamples);
+            stream.writeInt (factor);
+            stream.writeInt (static_cast<int> (levels.size()));
+
+            // Values are stored in the native byte order, caches are not meant to be shared across machines
+            for (const auto& level : levels)
+            {
+                stream.writeInt64 (level.binSize);
+                stream.writeInt (level.numBins);
+                stream.write (level.values.data(), level.values.size() * sizeof (float));
+            }
+
+            stream.flush();
+            if (stream.getStatus().failed())
+                return false;
+        }
+
+        return temporaryFile.overwriteTargetFileWithTemporary();
+    }
+
+    /** Returns where the pyramid of a file is cached, next to it or in the cache directory when one is given. */
+    static File getCacheFileFor (const File& file, const File& cacheDirectory)
+    {
+        if (cacheDirectory == File())
+            return file.getSiblingFile (file.getFileName() + ".peaks");
+
+        return cacheDirectory.getChildFile (file.getFileNameWithoutExtension()
+            + "_" + String::toHexString (file.getFullPathName().hashCode64()) + ".peaks");
+    }
+
+    /** Loads the cached pyramid of a file if it's up to date, otherwise builds it and refreshes the cache. Called without the GIL. */
+    static std::unique_ptr<AudioPeakPyramid> createFor (AudioFormatManager& formatManager, const File& file, const File& cacheDirectory, int binSize, int factor)
+    {
+        const auto cacheFile = getCacheFileFor (file, cacheDirectory);
+        const auto sourceKey = SourceKey::fromFile (file);
+
+        SourceKey cachedKey;
+        if (auto cached = load (cacheFile, &cachedKey))
+        {
+            if (cachedKey == sourceKey && cached->getBinSize (0) == binSize && cached->factor == factor)
+                return cached;
+        }
+
+        std::unique_ptr<AudioFormatReader> reader (formatManager.createReaderFor (file));
+        if (reader == nullptr)
+            return nullptr;
+
+        auto pyramid = build (*reader, binSize, factor);
+
+        if (pyramid != nullptr)
+        {
+            if (cacheDirectory != File())
+                cacheDirectory.createDirectory();
+
+            pyramid->save (cacheFile, sourceKey);
+        }
+
+        return pyramid;
+    }
+
+    double getSampleRate() const noexcept { return sampleRate; }
+    int getNumChannels() const noexcept { return numChannels; }
+    int64 getLengthInSamples() const noexcept { return lengthInSamples; }
+    int getFactor() const noexcept { return factor; }
+    int getNumLevels() const noexcept { return static_cast<int> (levels.size()); }
+    int64 getBinSize (int level) const { return levels[static_cast<size_t> (level)].binSize; }
+
+    const Level& getLevel (int level) const
+    {
+        return levels[static_cast<size_t> (level)];
+    }
+
+    /**
+     * Fills (channels x pixels x values) with the levels of the pixels evenly spanning the samples from start to end.
+     *
+     * Pixels smaller than the bins of the first level repeat the values of the bin they fall in, pixels past the end of
+     * the source are silent.
+     */
+    void getPixels (int64 startSample, int64 endSample, int numPixels, float* destination) const
+    {
+        const auto samplesPerPixel = static_cast<double> (endSample - startSample) / numPixels;
+
+        auto levelIndex = static_cast<size_t> (0);
+        while (levelIndex + 1 < levels.size() && static_cast<double> (levels[levelIndex + 1].binSize) <= samplesPerPixel)
+            ++levelIndex;
+
+        const auto& level = levels[levelIndex];
+
+        for (int pixel = 0; pixel < numPixels; ++pixel)
+        {
+            const auto pixelStart = static_cast<double> (startSample) + pixel * samplesPerPixel;
+            const auto pixelEnd = pixelStart + samplesPerPixel;
+
+            const auto firstBin = jmax (static_cast<int64> (0), static_cast<int64> (std::floor (pixelStart / static_cast<double> (level.binSize))));
+            const auto lastBin = jmin (static_cast<int64> (level.numBins), jmax (firstBin + 1, static_cast<int64> (std::ceil (pixelEnd / static_cast<double> (level.binSize)))));
+
+            for (int channel = 0; channel < numChannels; ++channel)
+            {
+                auto* pixelValues = destination + (static_cast<size_t> (channel) * static_cast<size_t> (numPixels) + static_cast<size_t> (pixel)) * numValues;
+
+                if (firstBin >= lastBin)
+                {
+                    std::fill (pixelValues, pixelValues + numValues, 0.0f);
+                    continue;
+                }
+
+                mergeBins (level, channel, firstBin, lastBin, pixelValues);
+            }
+        }
+    }
+
+private:
+    static constexpr int magic = 0x4b504550; // "PEPK"
+    static constexpr int version = 1;
+
+    int64 getNumSamplesInBin (const Level& level, int64 bin) const noexcept
+    {
+        return jmin (level.binSize, lengthInSamples - bin * level.binSize);
+    }
+
+    const float* getBin (const Level& level, int channel, int64 bin) const noexcept
+    {
+        return level.values.data() + (static_cast<size_t> (channel) * static_cast<size_t> (level.numBins) + static_cast<size_t> (bin)) * numValues;
+    }
+
+    /** Combines a range of bins, the RMS being weighted by the number of samples of each bin. */
+    void mergeBins (const Level& level, int channel, int64 firstBin, int64 lastBin, float* destination) const noexcept
+    {
+        auto low = std::numeric_limits<float>::max();
+        auto high = std::numeric_limits<float>::lowest();
+        double sumOfSquares = 0.0;
+        int64 numSamples = 0;
+
+        for (auto bin = firstBin; bin < lastBin; ++bin)
+        {
+            const auto* values = getBin (level, channel, bin);
+            const auto binSamples = getNumSamplesInBin (level, bin);
+
+            low = jmin (low, values[minimum]);
+            high = jmax (high, values[maximum]);
+            sumOfSquares += static_cast<double> (values[rms]) * static_cast<double> (values[rms]) * static_cast<double> (binSamples);
+            numSamples += binSamples;
+        }
+
+        destination[minimum] = low;
+        destination[maximum] = high;
+        destination[rms] = numSamples > 0 ? static_cast<float> (std::sqrt (sumOfSquares / static_cast<double> (numSamples))) : 0.0f;
+    }
+
+    bool buildFirstLevel (AudioFormatReader& reader, int binSize)
+    {
+        Level level;
+        level.binSize = binSize;
+        level.numBins = static_cast<int> ((lengthInSamples + binSize - 1) / binSize);
+        level.values.resize (static_cast<size_t> (numChannels) * static_cast<size_t> (level.numBins) * numValues);
+
+        const auto binsPerBlock = jmax (1, 65536 / binSize);
+        AudioBuffer<float> block (numChannels, binsPerBlock * binSize);
+
+        for (int firstBin = 0; firstBin < level.numBins; firstBin += binsPerBlock)
+        {
+            const auto startSample = static_cast<int64> (firstBin) * binSize;
+            const auto numSamples = static_cast<int> (jmin (static_cast<int64> (block.getNumSamples()), lengthInSamples - startSample));
+
+            if (! reader.read (block.getArrayOfWritePointers(), numChannels, startSample, numSamples))
+                return false;
+
+            for (int channel = 0; channel < numChannels; ++channel)
+            {
+                const auto* samples = block.getReadPointer (channel);
+
+                for (int offset = 0, bin = firstBin; offset < numSamples; offset += binSize, ++bin)
+                {
+                    const auto binSamples = jmin (binSize, numSamples - offset);
+                    const auto range = FloatVectorOperations::findMinAndMax (samples + offset, binSamples);
+
+                    double sumOfSquares = 0.0;
+                    for (int index = 0; index < binSamples; ++index)
+                        sumOfSquares += static_cast<double> (samples[offset + index]) * static_cast<double> (samples[offset + index]);
+
+                    auto* values = level.values.data() + (static_cast<size_t> (channel) * static_cast<size_t> (level.numBins) + static_cast<size_t> (bin)) * numValues;
+                    values[minimum] = range.getStart();
+                    values[maximum] = range.getEnd();
+                    values[rms] = static_cast<float> (std::sqrt (sumOfSquares / binSamples));
+                }
+            }
+        }
+
+        levels.push_back (std::move (level));
+        return true;
+    }
+
+    void mergeLevel()
+    {
+        const auto& source = levels.back();
+
+        Level level;
+        level.binSize = source.binSize * factor;
+        level.numBins = (source.numBins + factor - 1) / factor;
+        level.values.resize (static_cast<size_t> (numChannels) * static_cast<size_t> (level.numBins) * numValues);
+
+        for (int channel = 0; channel < numChannels; ++channel)
+        {
+            for (int bin = 0; bin < level.numBins; ++bin)
+            {
+                const auto firstBin = static_cast<int64> (bin) * factor;
+                mergeBins (source, channel, firstBin, jmin (firstBin + factor, static_cast<int64> (source.numBins)),
+                           level.values.data() + (static_cast<size_t> (channel) * static_cast<size_t> (level.numBins) + static_cast<size_t> (bin)) * numValues);
+            }
+        }
+
+        levels.push_back (std::move (level));
+    }
+
+    double sampleRate = 0.0;
+    int numChannels = 0;
+    int64 lengthInSamples = 0;
+    int factor = 4;
+    std::vector<Level> levels;
+};
+
+// ============================================================================================
+
+/**
+ * Iterates the samples of a reader in fixed size (optionally overlapping) chunks, copied in the same preallocated array.
+ *
+ * Samples are decoded once in a ring buffer, ahead of the consumer on a TimeSliceThread when one is running, or on demand
+ * otherwise. The last chunk is padded with zeros. While a thread prefetches, the reader must not be used elsewhere.
+ */
+class AudioFormatReaderChunks : private TimeSliceClient
+{
+public:
+    AudioFormatReaderChunks (AudioFormatReader& sourceReader, int chunkSizeToUse, int overlap, int64 startSample, int64 numSamples,
+                             TimeSliceThread* prefetchThread, int prefetchChunks)
+        : reader (sourceReader)
+        , thread (prefetchThread)
+        , numChannels (static_cast<int> (sourceReader.numChannels))
+        , chunkSize (chunkSizeToUse)
+        , hopSize (chunkSizeToUse - overlap)
+        , startPosition (startSample)
+        , endPosition (startSample + numSamples)
+        , writePosition (startSample)
+    {
+        if (chunkSize <= 0 || overlap < 0 || overlap >= chunkSize)
+            throw py::value_error ("The chunk size must be positive and the overlap smaller than the chunk size");
+
+        if (numSamples < 0 || prefetchChunks < 1)
+            throw py::value_error ("The number of samples can't be negative and at least one chunk must be prefetched");
+
+        if (numSamples > 0)
+            numChunks = numSamples <= chunkSize ? 1 : 1 + (numSamples - chunkSize + hopSize - 1) / hopSize;
+
+        producedEnd = numChunks > 0 ? startPosition + (numChunks - 1) * hopSize + chunkSize : startPosition;
+
+        const auto capacity = chunkSize + hopSize * prefetchChunks + 1;
+        fifo.setTotalSize (capacity);
+        ring.setSize (numChannels, capacity);
+        ring.clear();
+        ringChannels.resize (static_cast<size_t> (numChannels));
+
+        chunk = py::array_t<float> (std::vector<py::ssize_t> { numChannels, chunkSize });
+        std::fill_n (chunk.mutable_data(), chunk.size(), 0.0f);
+
+        for (int channel = 0; channel < numChannels; ++channel)
+            chunkChannels.push_back (chunk.mutable_data (channel, 0));
+
+        if (thread != nullptr)
+            thread->addTimeSliceClient (this);
+    }
+
+    ~AudioFormatReaderChunks() override
+    {
+        if (thread != nullptr)
+            thread->removeTimeSliceClient (this);
+    }
+
+    /** Copies the next chunk in the output array, returns false once all the chunks have been read. Called without the GIL. */
+    bool readNextChunk()
+    {
+        if (chunkIndex >= numChunks)
+            return false;
+
+        while (fifo.getNumReady() < chunkSize && ! failed)
+        {
+            if (thread != nullptr && thread->isThreadRunning())
+            {
+                thread->moveToFrontOfQueue (this);
+                dataReady.wait (readTimeoutMs);
+            }
+            else if (! fillRing())
+            {
+                break;
+            }
+        }
+
+        if (failed || fifo.getNumReady() < chunkSize)
+            throw py::value_error ("Unable to read the samples of the next chunk");
+
+        int start1, size1, start2, size2;
+        fifo.prepareToRead (chunkSize, start1, size1, start2, size2);
+
+        for (int channel = 0; channel < numChannels; ++channel)
+        {
+            FloatVectorOperations::copy (chunkChannels[static_cast<size_t> (channel)], ring.getReadPointer (channel, start1), size1);
+
+            if (size2 > 0)
+                FloatVectorOperations::copy (chunkChannels[static_cast<size_t> (channel)] + size1, ring.getReadPointer (channel, start2), size2);
+        }
+
+        fifo.finishedRead (hopSize);
+
+        chunkPosition = startPosition + chunkIndex * hopSize;
+        ++chunkIndex;
+
+        if (thread != nullptr && thread->isThreadRunning())
+            thread->moveToFrontOfQueue (this);
+
+        return true;
+    }
+
+    const py::array_t<float>& getChunk() const noexcept { return chunk; }
+    int getChunkSize() const noexcept { return chunkSize; }
+    int getHopSize() const noexcept { return hopSize; }
+    int64 getNumChunks() const noexcept { return numChunks; }
+    int64 getChunkPosition() const noexcept { return chunkPosition; }
+
+    int getNumValidSamples() const noexcept
+    {
+        return chunkIndex > 0 ? static_cast<int> (jlimit (static_cast<int64> (0), static_cast<int64> (chunkSize), endPosition - chunkPosition)) : 0;
+    }
+
+private:
+    int useTimeSlice() override
+    {
+        return fillRing() && writePosition < producedEnd ? 1 : 100;
+    }
+
+    /** Decodes as many samples as fit in the ring, returns false when nothing could be decoded. */
+    bool fillRing()
+    {
+        const ScopedLock sl (fillLock);
+
+        const auto numToWrite = static_cast<int> (jmin (static_cast<int64> (fifo.getFreeSpace()), producedEnd - writePosition));
+        if (numToWrite <= 0 || failed)
+            return false;
+
+        int start1, size1, start2, size2;
+        fifo.prepareToWrite (numToWrite, start1, size1, start2, size2);
+
+        if (! decodeInto (start1, size1, writePosition) || ! decodeInto (start2, size2, writePosition + size1))
+        {
+            failed = true;
+            dataReady.signal();
+            return false;
+        }
+
+        fifo.finishedWrite (size1 + size2);
+        writePosition += size1 + size2;
+
+        dataReady.signal();
+        return true;
+    }
+
+    bool decodeInto (int ringOffset, int numSamples, int64 position)
+    {
+        if (numSamples <= 0 || numChannels == 0)
+            return true;
+
+        for (int channel = 0; channel < numChannels; ++channel)
+            ringChannels[static_cast<size_t> (channel)] = ring.getWritePointer (channel, ringOffset);
+
+        // Samples past the end of the requested range are padding, even if the reader has more
+        const auto numToRead = static_cast<int> (jlimit (static_cast<int64> (0), static_cast<int64> (numSamples), endPosition - position));
+
+        if (numToRead > 0 && ! reader.read (ringChannels.data(), numChannels, position, numToRead))
+            return false;
+
+        for (auto* channel : ringChannels)
+            FloatVectorOperations::clear (channel + numToRead, numSamples - numToRead);
+
+        return true;
+    }
+
+    static constexpr int readTimeoutMs = 100;
+
+    AudioFormatReader& reader;
+    TimeSliceThread* thread = nullptr;
+
+    const int numChannels;
+    const int chunkSize;
+    const int hopSize;
+    const int64 startPosition;
+    const int64 endPosition;
+    int64 producedEnd = 0;
+    int64 numChunks = 0;
+
+    AbstractFifo fifo { 1 };
+    AudioBuffer<float> ring;
+    std::vector<float*> ringChannels;
+    CriticalSection fillLock;
+    WaitableEvent dataReady;
+    std::atomic<bool> failed { false };
+    int64 writePosition = 0;
+
+    py::array_t<float> chunk;
+    std::vector<float*> chunkChannels;
+    int64 chunkIndex = 0;
+    int64 chunkPosition = 0;
+};
+
+// ============================================================================================
+
 void registerJuceAudioFormatsBindings (py::module_& m)
 {
     // ============================================================================================ juce::AudioFormatReader
@@ -39,6 +1323,86 @@ void registerJuceAudioFormatsBindings (py::module_& m)
     //.def ("read", py::overload_cast<float* const*, int, juce::int64, int> (&AudioFormatReader::read))
     //.def ("read", py::overload_cast<int* const*, int, juce::int64, int, bool> (&AudioFormatReader::read))
         .def ("read", py::overload_cast<AudioBuffer<float>*, int, int, juce::int64, bool, bool> (&AudioFormatReader::read))
+        .def ("readInto", [](AudioFormatReader& self, py::object destination, int64 startSample, int numSamples)
+        {
+            return withAudioSampleType (destination, [&](auto sampleType)
+            {
+                PyChannelPointers<decltype (sampleType)> channels (destination);
+
+                if (numSamples < 0)
+                    numSamples = channels.getNumSamples();
+                else if (numSamples > channels.getNumSamples())
+                    throw py::value_error ("The destination is too small for the requested samples");
+
+                py::gil_scoped_release release;
+                return readSamplesInto (self, channels.data(), channels.getNumChannels(), startSample, numSamples);
+            });
+        }, "destination"_a, "startSample"_a = 0, "numSamples"_a = -1)
+        .def ("readArray", [](AudioFormatReader& self, int64 startSample, int64 numSamples, py::object dtype)
+        {
+            if (numSamples < 0)
+                numSamples = jmax (static_cast<int64> (0), self.lengthInSamples - startSample);
+
+            if (numSamples > std::numeric_limits<int>::max())
+                throw py::value_error ("Too many samples requested in a single read");
+
+            return withAudioSampleType (py::dtype::from_args (dtype), [&](auto sampleType) -> py::object
+            {
+                using SampleType = decltype (sampleType);
+
+                py::array_t<SampleType> result (std::vector<py::ssize_t> { static_cast<py::ssize_t> (self.numChannels), static_cast<py::ssize_t> (numSamples) });
+                PyChannelPointers<SampleType> channels (result);
+
+                bool success;
+
+                {
+                    py::gil_scoped_release release;
+                    success = readSamplesInto (self, channels.data(), channels.getNumChannels(), startSample, static_cast<int> (numSamples));
+                }
+
+                if (! success)
+                    throw py::value_error ("Unable to read the requested samples");
+
+                return result;
+            });
+        }, "startSample"_a = 0, "numSamples"_a = -1, "dtype"_a = "float32")
+        .def ("readResampled", [](AudioFormatReader& self, double sampleRate, int64 startSample, int64 numSamples, ResamplingInterpolator interpolator, ThreadPool* threadPool)
+        {
+            if (sampleRate <= 0.0 || self.sampleRate <= 0.0)
+                throw py::value_error ("Sample rates must be positive");
+
+            if (numSamples < 0)
+                numSamples = jmax (static_cast<int64> (0), self.lengthInSamples - startSample);
+
+            const auto ratio = self.sampleRate / sampleRate;
+            const auto numOutputSamples = getResampledLength (numSamples, ratio);
+
+            if (numSamples > std::numeric_limits<int>::max() || numOutputSamples > std::numeric_limits<int>::max())
+                throw py::value_error ("Too many samples requested in a single read");
+
+            const auto numChannels = static_cast<int> (self.numChannels);
+
+            py::array_t<float> result (std::vector<py::ssize_t> { numChannels, static_cast<py::ssize_t> (numOutputSamples) });
+            PyChannelPointers<float> output (result);
+
+            bool success;
+
+            {
+                py::gil_scoped_release release;
+
+                AudioBuffer<float> input (numChannels, static_cast<int> (numSamples));
+                success = readSamplesInto (self, input.getArrayOfWritePointers(), numChannels, startSample, input.getNumSamples());
+
+                if (success)
+                    resampleChannels (interpolator, input.getArrayOfReadPointers(), numChannels, input.getNumSamples(),
+                                      output.data(), static_cast<int> (numOutputSamples), ratio, threadPool);
+            }
+
+            if (! success)
+                throw py::value_error ("Unable to read the requested samples");
+
+            return result;
+        }, "sampleRate"_a, "startSample"_a = 0, "numSamples"_a = -1, "interpolator"_a = ResamplingInterpolator::lagrange, "threadPool"_a = nullptr)
         .def ("readMaxLevels", py::overload_cast<juce::int64, juce::int64, Range<float>*, int> (&AudioFormatReader::readMaxLevels))
     //.def ("readMaxLevels", py::overload_cast<juce::int64, juce::int64, float&, float&, float&, float&> (&AudioFormatReader::readMaxLevels))
         .def ("searchForLevel", &AudioFormatReader::searchForLevel)
@@ -51,6 +1415,42 @@ void registerJuceAudioFormatsBindings (py::module_& m)
         .def_readwrite ("input", &AudioFormatReader::input)
         .def ("getChannelLayout", &AudioFormatReader::getChannelLayout)
     //.def ("readSamples", &AudioFormatReader::readSamples)
+        .def ("chunks", [](AudioFormatReader& self, int chunkSize, int overlap, int64 startSample, int64 numSamples, TimeSliceThread* thread, int prefetchChunks)
+        {
+            if (numSamples < 0)
+                numSamples = jmax (static_cast<int64> (0), self.lengthInSamples - startSample);
+
+            return std::make_unique<AudioFormatReaderChunks> (self, chunkSize, overlap, startSample, numSamples, thread, prefetchChunks);
+        }, "chunkSize"_a, "overlap"_a = 0, "startSample"_a = 0, "numSamples"_a = -1, "thread"_a = nullptr, "prefetchChunks"_a = 2,
+            py::keep_alive<0, 1>(), py::keep_alive<0, 6>())
+    ;
+
+    // ============================================================================================ juce::AudioFormatReaderChunks
+
+    py::class_<AudioFormatReaderChunks> classAudioFormatReaderChunks (m, "AudioFormatReaderChunks");
+
+    classAudioFormatReaderChunks
+        .def ("__iter__", [](AudioFormatReaderChunks& self) -> AudioFormatReaderChunks& { return self; }, py::return_value_policy::reference_internal)
+        .def ("__next__", [](AudioFormatReaderChunks& self) -> py::array_t<float>
+        {
+            bool hasChunk;
+
+            {
+                py::gil_scoped_release release;
+                hasChunk = self.readNextChunk();
+            }
+
+            if (! hasChunk)
+                throw py::stop_iteration();
+
+            return self.getChunk();
+        })
+        .def ("__len__", &AudioFormatReaderChunks::getNumChunks)
+        .def ("getNumChunks", &AudioFormatReaderChunks::getNumChunks)
+        .def ("getChunkSize", &AudioFormatReaderChunks::getChunkSize)
+        .def ("getHopSize", &AudioFormatReaderChunks::getHopSize)
+        .def ("getChunkPosition", &AudioFormatReaderChunks::getChunkPosition)
+        .def ("getNumValidSamples", &AudioFormatReaderChunks::getNumValidSamples)
     ;
 
     // ============================================================================================ juce::AudioSubsectionReader
@@ -87,6 +1487,45 @@ void registerJuceAudioFormatsBindings (py::module_& m)
         .def ("touchSample", &MemoryMappedAudioFormatReader::touchSample)
     //.def ("getSample", &MemoryMappedAudioFormatReader::getSample)
         .def ("getNumBytesUsed", &MemoryMappedAudioFormatReader::getNumBytesUsed)
+        .def ("getSampleView", [](const MemoryMappedAudioFormatReader& self, int64 startSample, int64 numSamples)
+        {
+            if (numSamples < 0)
+                numSamples = self.lengthInSamples - startSample;
+
+            if (startSample < 0 || numSamples < 0 || startSample + numSamples > self.lengthInSamples)
+                throw py::value_error ("The requested samples are outside the reader");
+
+            const auto dataChunkStart = self.*(&MemoryMappedAudioFormatReaderPublicist::dataChunkStart);
+            const auto bytesPerFrame = self.*(&MemoryMappedAudioFormatReaderPublicist::bytesPerFrame);
+
+            auto sampleType = getMappedSampleType (self);
+            const auto shape = std::vector<py::ssize_t> { static_cast<py::ssize_t> (numSamples), static_cast<py::ssize_t> (self.numChannels) };
+            const auto strides = std::vector<py::ssize_t> { bytesPerFrame, sampleType.itemsize() };
+
+            py::array result;
+
+            if (numSamples == 0)
+            {
+                result = py::array (sampleType, shape);
+            }
+            else
+            {
+                // The view maps the file on its own, so it outlives the reader and any later mapping change in it
+                const auto fileRange = Range<int64> (dataChunkStart + startSample * bytesPerFrame, dataChunkStart + (startSample + numSamples) * bytesPerFrame);
+                auto map = std::make_unique<MemoryMappedFile> (self.getFile(), fileRange, MemoryMappedFile::readOnly, false);
+
+                if (map->getData() == nullptr)
+                    throw py::value_error ("Unable to map the samples of the file in memory");
+
+                const auto* data = addBytesToPointer (static_cast<const char*> (map->getData()), fileRange.getStart() - map->getRange().getStart());
+                py::capsule owner (map.release(), [](void* p) { delete static_cast<MemoryMappedFile*> (p); });
+
+                result = py::array (sampleType, shape, strides, data, owner);
+            }
+
+            result.attr ("setflags") ("write"_a = false);
+            return result;
+        }, "startSample"_a = 0, "numSamples"_a = -1)
     ;
 
     // ============================================================================================ juce::AudioFormatReaderSource
@@ -97,6 +1536,19 @@ void registerJuceAudioFormatsBindings (py::module_& m)
         .def (py::init<AudioFormatReader*, bool>(),
             "sourceReader"_a, "deleteReaderWhenThisIsDeleted"_a = false)
         .def ("getAudioFormatReader", &AudioFormatReaderSource::getAudioFormatReader, py::return_value_policy::reference)
+        .def ("chunks", [](AudioFormatReaderSource& self, int chunkSize, int overlap, int64 numSamples, TimeSliceThread* thread, int prefetchChunks)
+        {
+            auto* reader = self.getAudioFormatReader();
+            if (reader == nullptr)
+                throw py::value_error ("The source has no reader to iterate");
+
+            const auto startSample = self.getNextReadPosition();
+            if (numSamples < 0)
+                numSamples = jmax (static_cast<int64> (0), reader->lengthInSamples - startSample);
+
+            return std::make_unique<AudioFormatReaderChunks> (*reader, chunkSize, overlap, startSample, numSamples, thread, prefetchChunks);
+        }, "chunkSize"_a, "overlap"_a = 0, "numSamples"_a = -1, "thread"_a = nullptr, "prefetchChunks"_a = 2,
+            py::keep_alive<0, 1>(), py::keep_alive<0, 5>())
     ;
 
     // ============================================================================================ juce::AudioFormatWriter
@@ -115,6 +1567,24 @@ void registerJuceAudioFormatsBindings (py::module_& m)
         .def ("writeFromAudioSource", &AudioFormatWriter::writeFromAudioSource, "source"_a, "numSamplesToRead"_a, "samplesPerBlock"_a = 2048)
         .def ("writeFromAudioSampleBuffer", &AudioFormatWriter::writeFromAudioSampleBuffer, "source"_a, "startSample"_a, "numSamples"_a)
     //.def ("writeFromFloatArrays", &AudioFormatWriter::writeFromFloatArrays)
+        .def ("writeArray", [](AudioFormatWriter& self, py::object data, int numSamples)
+        {
+            return withAudioSampleType (data, [&](auto sampleType)
+            {
+                PyChannelPointers<const decltype (sampleType)> channels (data);
+
+                if (channels.getNumChannels() != self.getNumChannels())
+                    throw py::value_error ("The data must have as many channels as the writer");
+
+                if (numSamples < 0)
+                    numSamples = channels.getNumSamples();
+                else if (numSamples > channels.getNumSamples())
+                    throw py::value_error ("The data is too small for the requested samples");
+
+                py::gil_scoped_release release;
+                return writeSamplesFrom (self, channels.data(), channels.getNumChannels(), numSamples);
+            });
+        }, "data"_a, "numSamples"_a = -1)
         .def ("getSampleRate", &AudioFormatWriter::getSampleRate)
         .def ("getNumChannels", &AudioFormatWriter::getNumChannels)
         .def ("getBitsPerSample", &AudioFormatWriter::getBitsPerSample)
@@ -122,6 +1592,38 @@ void registerJuceAudioFormatsBindings (py::module_& m)
         .def ("writeFromAudioSampleBuffer", &AudioFormatWriter::writeFromAudioSampleBuffer)
     ;
 
+    py::class_<ThreadedAudioFormatWriter> classAudioFormatWriterThreadedWriter (classAudioFormatWriter, "ThreadedWriter");
+
+    classAudioFormatWriterThreadedWriter
+        .def (py::init ([](py::object writer, TimeSliceThread& backgroundThread, int numSamplesToBuffer)
+        {
+            if (! py::isinstance<AudioFormatWriter> (writer))
+                throw py::type_error ("The writer must be an instance of AudioFormatWriter");
+
+            if (numSamplesToBuffer <= 0)
+                throw py::value_error ("The number of samples to buffer must be positive");
+
+            return new ThreadedAudioFormatWriter (writer.release().cast<AudioFormatWriter*>(), backgroundThread, numSamplesToBuffer);
+        }), "writer"_a, "backgroundThread"_a, "numSamplesToBuffer"_a, py::keep_alive<1, 3>())
+        .def ("write", [](ThreadedAudioFormatWriter& self, py::object data, int numSamples)
+        {
+            PyChannelPointers<const float> channels (data);
+
+            if (channels.getNumChannels() != self.getNumChannels())
+                throw py::value_error ("The data must have as many channels as the writer");
+
+            if (numSamples < 0)
+                numSamples = channels.getNumSamples();
+            else if (numSamples > channels.getNumSamples())
+                throw py::value_error ("The data is too small for the requested samples");
+
+            py::gil_scoped_release release;
+            return self.write (channels.data(), numSamples);
+        }, "data"_a, "numSamples"_a = -1)
+        .def ("getNumChannels", &ThreadedAudioFormatWriter::getNumChannels)
+        .def ("setFlushInterval", &ThreadedAudioFormatWriter::setFlushInterval, "numSamplesPerFlush"_a)
+    ;
+
     // ============================================================================================ juce::AudioFormat
 
     py::class_<AudioFormat, PyAudioFormat<>> classAudioFormat (m, "AudioFormat");
@@ -142,8 +1644,22 @@ void registerJuceAudioFormatsBindings (py::module_& m)
         .def ("createReaderFor", &AudioFormat::createReaderFor)
         .def ("createMemoryMappedReader", py::overload_cast<const File&> (&AudioFormat::createMemoryMappedReader))
         .def ("createMemoryMappedReader", py::overload_cast<FileInputStream*> (&AudioFormat::createMemoryMappedReader))
-        .def ("createWriterFor", py::overload_cast<OutputStream*, double, unsigned int, int, const StringPairArray&, int> (&AudioFormat::createWriterFor))
-        .def ("createWriterFor", py::overload_cast<OutputStream*, double, const AudioChannelSet&, int, const StringPairArray&, int> (&AudioFormat::createWriterFor))
+        .def ("createWriterFor", [](AudioFormat& self, py::object streamToWriteTo, double sampleRateToUse, unsigned int numberOfChannels,
+                                    int bitsPerSample, const StringPairArray& metadataValues, int qualityOptionIndex)
+        {
+            return createWriterTakingStream (streamToWriteTo, [&](OutputStream* stream)
+            {
+                return self.createWriterFor (stream, sampleRateToUse, numberOfChannels, bitsPerSample, metadataValues, qualityOptionIndex);
+            });
+        }, "streamToWriteTo"_a, "sampleRateToUse"_a, "numberOfChannels"_a, "bitsPerSample"_a, "metadataValues"_a = StringPairArray(), "qualityOptionIndex"_a = 0)
+        .def ("createWriterFor", [](AudioFormat& self, py::object streamToWriteTo, double sampleRateToUse, const AudioChannelSet& channelLayout,
+                                    int bitsPerSample, const StringPairArray& metadataValues, int qualityOptionIndex)
+        {
+            return createWriterTakingStream (streamToWriteTo, [&](OutputStream* stream)
+            {
+                return self.createWriterFor (stream, sampleRateToUse, channelLayout, bitsPerSample, metadataValues, qualityOptionIndex);
+            });
+        }, "streamToWriteTo"_a, "sampleRateToUse"_a, "channelLayout"_a, "bitsPerSample"_a, "metadataValues"_a = StringPairArray(), "qualityOptionIndex"_a = 0)
     ;
 
     // ============================================================================================ juce::WavAudioFormat
@@ -297,8 +1813,262 @@ void registerJuceAudioFormatsBindings (py::module_& m)
         .def ("findFormatForFileExtension", &AudioFormatManager::findFormatForFileExtension, py::return_value_policy::reference)
         .def ("getDefaultFormat", &AudioFormatManager::getDefaultFormat, py::return_value_policy::reference)
         .def ("getWildcardForAllFormats", &AudioFormatManager::getWildcardForAllFormats)
-        .def ("createReaderFor", py::overload_cast<const File&> (&AudioFormatManager::createReaderFor))
-    //.def ("createReaderFor", py::overload_cast<std::unique_ptr<InputStream>> (&AudioFormatManager::createReaderFor))
+        .def ("createReaderFor", py::overload_cast<const File&> (&AudioFormatManager::createReaderFor), py::call_guard<py::gil_scoped_release>())
+        .def ("createReaderFor", [](AudioFormatManager& self, py::object audioFileStream) -> AudioFormatReader*
+        {
+            if (! py::isinstance<InputStream> (audioFileStream))
+                throw py::type_error ("The stream to read from must be an instance of InputStream");
+
+            auto* stream = audioFileStream.cast<InputStream*>();
+            AudioFormatReader* reader;
+
+            {
+                py::gil_scoped_release release;
+                reader = createReaderForStream (self, stream);
+            }
+
+            if (reader != nullptr)
+                audioFileStream.release();
+
+            return reader;
+        }, "audioFileStream"_a)
+        .def ("createReaderForBuffer", [](AudioFormatManager& self, py::buffer data) -> AudioFormatReader*
+        {
+            auto info = std::make_unique<py::buffer_info> (data.request());
+            if (! isContiguousBuffer (*info))
+                throw py::value_error ("The buffer must be contiguous");
+
+            // The stream holds the buffer export, so the exporter can't be resized while the reader is alive
+            auto stream = std::make_unique<BufferInputStream> (std::move (info));
+
+            py::gil_scoped_release release;
+
+            auto* reader = createReaderForStream (self, stream.get());
+            if (reader != nullptr)
+                stream.release();
+
+            return reader;
+        }, "data"_a)
+        .def ("createReaderForZipEntry", [](AudioFormatManager& self, ZipFile& zipFile, int index) -> AudioFormatReader*
+        {
+            if (! isPositiveAndBelow (index, zipFile.getNumEntries()))
+                throw py::index_error ("Invalid zip entry index");
+
+            py::gil_scoped_release release;
+            return createReaderForZipEntry (self, zipFile, index);
+        }, "zipFile"_a, "index"_a, py::keep_alive<0, 2>())
+        .def ("createReaderForZipEntry", [](AudioFormatManager& self, ZipFile& zipFile, const String& fileName, bool ignoreCase) -> AudioFormatReader*
+        {
+            const auto index = zipFile.getIndexOfFileName (fileName, ignoreCase);
+            if (index < 0)
+                throw py::key_error ((fileName + " is not in the zip file").toStdString());
+
+            py::gil_scoped_release release;
+            return createReaderForZipEntry (self, zipFile, index);
+        }, "zipFile"_a, "fileName"_a, "ignoreCase"_a = false, py::keep_alive<0, 2>())
+        .def ("decodeFiles", [](AudioFormatManager& self, py::iterable files, int numChannels, py::object dtype, double maxSeconds, double sampleRate, ResamplingInterpolator interpolator, int numThreads)
+        {
+            Array<File> filesToDecode;
+            for (auto file : files)
+                filesToDecode.add (toFile (file));
+
+            AudioFileDecodeOptions options;
+            options.numChannels = numChannels;
+            options.sampleType = toAudioSampleType (dtype);
+            options.maxSeconds = maxSeconds;
+            options.sampleRate = sampleRate;
+            options.interpolator = interpolator;
+
+            if (numThreads <= 0)
+                numThreads = SystemStats::getNumCpus();
+
+            return std::make_unique<AudioFileBatchDecoder> (self, std::move (filesToDecode), options, numThreads);
+        }, "files"_a, "numChannels"_a = -1, "dtype"_a = "float32", "maxSeconds"_a = 0.0, "sampleRate"_a = 0.0,
+            "interpolator"_a = ResamplingInterpolator::lagrange, "numThreads"_a = 0, py::keep_alive<0, 1>())
+    ;
+
+    // ============================================================================================ juce::AudioFileBatchDecoder
+
+    py::class_<AudioFileBatchDecoder> classAudioFileBatchDecoder (m, "AudioFileBatchDecoder");
+
+    classAudioFileBatchDecoder
+        .def ("__iter__", [](AudioFileBatchDecoder& self) -> AudioFileBatchDecoder& { return self; }, py::return_value_policy::reference_internal)
+        .def ("__next__", [](AudioFileBatchDecoder& self)
+        {
+            DecodedAudioFile result;
+            bool hasResult;
+
+            {
+                py::gil_scoped_release release;
+                hasResult = self.getNextResult (result);
+            }
+
+            if (! hasResult)
+                throw py::stop_iteration();
+
+            if (result.error.isNotEmpty())
+                return py::make_tuple (result.index, py::none(), 0.0, result.error);
+
+            const auto sampleType = self.getOptions().sampleType;
+            const auto sampleSize = static_cast<py::ssize_t> (getSampleSize (sampleType));
+            const auto shape = std::vector<py::ssize_t> { result.numChannels, result.numSamples };
+            const auto strides = std::vector<py::ssize_t> { result.numSamples * sampleSize, sampleSize };
+
+            auto* data = new HeapBlock<char> (std::move (result.data));
+            py::capsule owner (data, [](void* p) { delete static_cast<HeapBlock<char>*> (p); });
+
+            return py::make_tuple (result.index, py::array (toDtype (sampleType), shape, strides, data->get(), owner), result.sampleRate, py::none());
+        })
+        .def ("__len__", &AudioFileBatchDecoder::getNumFiles)
+        .def ("getNumFiles", &AudioFileBatchDecoder::getNumFiles)
+    ;
+
+    // ============================================================================================ juce::AudioPeakPyramid
+
+    py::class_<AudioPeakPyramid> classAudioPeakPyramid (m, "AudioPeakPyramid");
+
+    const auto checkPyramidSettings = [](int binSize, int factor)
+    {
+        if (binSize <= 0 || factor < 2)
+            throw py::value_error ("The bin size must be positive and the factor at least 2");
+    };
+
+    const auto getPixels = [](const AudioPeakPyramid& self, int64 startSample, int64 endSample, int numPixels)
+    {
+        if (numPixels <= 0 || endSample <= startSample)
+            throw py::value_error ("The range must not be empty and the number of pixels must be positive");
+
+        py::array_t<float> result (std::vector<py::ssize_t> { self.getNumChannels(), numPixels, AudioPeakPyramid::numValues });
+        self.getPixels (startSample, endSample, numPixels, result.mutable_data());
+        return result;
+    };
+
+    classAudioPeakPyramid
+        .def_static ("build", [checkPyramidSettings](AudioFormatReader& reader, int binSize, int factor)
+        {
+            checkPyramidSettings (binSize, factor);
+
+            py::gil_scoped_release release;
+            return AudioPeakPyramid::build (reader, binSize, factor);
+        }, "reader"_a, "binSize"_a = 256, "factor"_a = 4)
+        .def_static ("createFor", [checkPyramidSettings](AudioFormatManager& formatManager, py::object file, py::object cacheDirectory, int binSize, int factor)
+        {
+            checkPyramidSettings (binSize, factor);
+
+            const auto sourceFile = toFile (file);
+            const auto directory = cacheDirectory.is_none() ? File() : toFile (cacheDirectory);
+
+            py::gil_scoped_release release;
+            return AudioPeakPyramid::createFor (formatManager, sourceFile, directory, binSize, factor);
+        }, "formatManager"_a, "file"_a, "cacheDirectory"_a = py::none(), "binSize"_a = 256, "factor"_a = 4)
+        .def_static ("getCacheFileFor", [](py::object file, py::object cacheDirectory)
+        {
+            return AudioPeakPyramid::getCacheFileFor (toFile (file), cacheDirectory.is_none() ? File() : toFile (cacheDirectory));
+        }, "file"_a, "cacheDirectory"_a = py::none())
+        .def_static ("load", [](py::object file)
+        {
+            const auto fileToLoad = toFile (file);
+
+            py::gil_scoped_release release;
+            return AudioPeakPyramid::load (fileToLoad);
+        }, "file"_a)
+        .def ("save", [](const AudioPeakPyramid& self, py::object file)
+        {
+            const auto fileToSave = toFile (file);
+
+            py::gil_scoped_release release;
+            return self.save (fileToSave);
+        }, "file"_a)
+        .def ("getSampleRate", &AudioPeakPyramid::getSampleRate)
+        .def ("getNumChannels", &AudioPeakPyramid::getNumChannels)
+        .def ("getLengthInSamples", &AudioPeakPyramid::getLengthInSamples)
+        .def ("getFactor", &AudioPeakPyramid::getFactor)
+        .def ("getNumLevels", &AudioPeakPyramid::getNumLevels)
+        .def ("getBinSize", [](const AudioPeakPyramid& self, int level)
+        {
+            if (! isPositiveAndBelow (level, self.getNumLevels()))
+                throw py::index_error ("Invalid level index");
+
+            return self.getBinSize (level);
+        }, "level"_a)
+        .def ("getLevel", [](const AudioPeakPyramid& self, int level)
+        {
+            if (! isPositiveAndBelow (level, self.getNumLevels()))
+                throw py::index_error ("Invalid level index");
+
+            const auto& levelData = self.getLevel (level);
+
+            py::array_t<float> result (std::vector<py::ssize_t> { self.getNumChannels(), levelData.numBins, AudioPeakPyramid::numValues });
+            std::copy (levelData.values.begin(), levelData.values.end(), result.mutable_data());
+            return result;
+        }, "level"_a)
+        .def ("getLevels", getPixels, "startSample"_a, "endSample"_a, "numPixels"_a)
+        .def ("getMinMax", [getPixels](const AudioPeakPyramid& self, int64 startSample, int64 endSample, int numPixels)
+        {
+            auto levels = getPixels (self, startSample, endSample, numPixels);
+
+            py::array_t<float> result (std::vector<py::ssize_t> { self.getNumChannels(), numPixels, 2 });
+            auto source = levels.unchecked<3>();
+            auto destination = result.mutable_unchecked<3>();
+
+            for (py::ssize_t channel = 0; channel < destination.shape (0); ++channel)
+            {
+                for (py::ssize_t pixel = 0; pixel < numPixels; ++pixel)
+                {
+                    destination (channel, pixel, 0) = source (channel, pixel, AudioPeakPyramid::minimum);
+                    destination (channel, pixel, 1) = source (channel, pixel, AudioPeakPyramid::maximum);
+                }
+            }
+
+            return result;
+        }, "startSample"_a, "endSample"_a, "numPixels"_a)
+        .def ("getRMS", [getPixels](const AudioPeakPyramid& self, int64 startSample, int64 endSample, int numPixels)
+        {
+            auto levels = getPixels (self, startSample, endSample, numPixels);
+
+            py::array_t<float> result (std::vector<py::ssize_t> { self.getNumChannels(), numPixels });
+            auto source = levels.unchecked<3>();
+            auto destination = result.mutable_unchecked<2>();
+
+            for (py::ssize_t channel = 0; channel < destination.shape (0); ++channel)
+                for (py::ssize_t pixel = 0; pixel < numPixels; ++pixel)
+                    destination (channel, pixel) = source (channel, pixel, AudioPeakPyramid::rms);
+
+            return result;
+        }, "startSample"_a, "endSample"_a, "numPixels"_a)
+    ;
+
+    // ============================================================================================ juce::SamplerSound
+
+    py::class_<SamplerSound, SynthesiserSound, ReferenceCountedObjectPtr<SamplerSound>> classSamplerSound (m, "SamplerSound");
+
+    classSamplerSound
+        .def (py::init<const String&, AudioFormatReader&, const BigInteger&, int, double, double, double>(),
+            "name"_a, "source"_a, "midiNotes"_a, "midiNoteForNormalPitch"_a, "attackTimeSecs"_a, "releaseTimeSecs"_a, "maxSampleLengthSeconds"_a,
+            py::call_guard<py::gil_scoped_release>())
+        .def (py::init ([](const String& name, const AudioBuffer<float>& buffer, double sampleRate, const BigInteger& midiNotes,
+                           int midiNoteForNormalPitch, double attackTimeSecs, double releaseTimeSecs, double maxSampleLengthSeconds)
+        {
+            if (sampleRate <= 0.0)
+                throw py::value_error ("The sample rate of the buffer must be positive");
+
+            py::gil_scoped_release release;
+
+            AudioBufferFormatReader reader (buffer, sampleRate);
+            return new SamplerSound (name, reader, midiNotes, midiNoteForNormalPitch, attackTimeSecs, releaseTimeSecs, maxSampleLengthSeconds);
+        }), "name"_a, "buffer"_a, "sampleRate"_a, "midiNotes"_a, "midiNoteForNormalPitch"_a, "attackTimeSecs"_a = 0.0, "releaseTimeSecs"_a = 0.0,
+            "maxSampleLengthSeconds"_a = 3600.0)
+        .def ("getName", &SamplerSound::getName)
+        .def ("getAudioData", &SamplerSound::getAudioData, py::return_value_policy::reference_internal)
+        .def ("setEnvelopeParameters", &SamplerSound::setEnvelopeParameters, "parametersToUse"_a)
+    ;
+
+    // ============================================================================================ juce::SamplerVoice
+
+    py::class_<SamplerVoice, SynthesiserVoice> classSamplerVoice (m, "SamplerVoice");
+
+    classSamplerVoice
+        .def (py::init<>())
     ;
 }
 
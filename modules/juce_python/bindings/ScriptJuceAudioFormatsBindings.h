@@ -53,7 +53,7 @@ struct PyAudioFormatReader : Base
     void readMaxLevels (juce::int64 startOffset, juce::int64 numSamples,
                         juce::Range<float>* results, int numChannelsToRead) override
     {
-        PYBIND11_OVERRIDE (void, Base, readMaxLevels, startOffset, numSamples, results, numChannelsToRead);
+        POPSICLE_OVERRIDE (void, Base, readMaxLevels, startOffset, numSamples, results, numChannelsToRead);
     }
 
     void readMaxLevels (juce::int64 startOffset, juce::int64 numSamples,
@@ -62,7 +62,7 @@ struct PyAudioFormatReader : Base
     {
         pybind11::gil_scoped_acquire gil;
 
-        if (pybind11::function override_ = pybind11::get_override (static_cast<Base*> (this), "readMaxLevels"); override_)
+        if (auto override_ = Helpers::getCachedOverride (static_cast<Base*> (this), "readMaxLevels"); override_)
         {
             auto results = override_ (startOffset, numSamples).cast<pybind11::tuple>();
 
@@ -82,7 +82,7 @@ struct PyAudioFormatReader : Base
 
     juce::AudioChannelSet getChannelLayout() override
     {
-        PYBIND11_OVERRIDE (juce::AudioChannelSet, Base, getChannelLayout);
+        POPSICLE_OVERRIDE (juce::AudioChannelSet, Base, getChannelLayout);
     }
 
     bool readSamples (int* const* destChannels,
@@ -93,7 +93,7 @@ struct PyAudioFormatReader : Base
     {
         juce::ignoreUnused (destChannels, numDestChannels, startOffsetInDestBuffer, startSampleInFile, numSamples);
 
-        //PYBIND11_OVERRIDE_PURE (bool, Base, readSamples, destChannels, numDestChannels, startOffsetInDestBuffer, startSampleInFile, numSamples);
+        //POPSICLE_OVERRIDE_PURE (bool, Base, readSamples, destChannels, numDestChannels, startOffsetInDestBuffer, startSampleInFile, numSamples);
 
         return false;
     }
@@ -114,14 +114,14 @@ struct PyMemoryMappedAudioFormatReader : PyAudioFormatReader<Base>
 
     bool mapSectionOfFile (juce::Range<juce::int64> samplesToMap) override
     {
-        PYBIND11_OVERRIDE (bool, Base, mapSectionOfFile, samplesToMap);
+        POPSICLE_OVERRIDE (bool, Base, mapSectionOfFile, samplesToMap);
     }
 
     void getSample (juce::int64 sampleIndex, float* result) const noexcept override
     {
         pybind11::gil_scoped_acquire gil;
 
-        if (pybind11::function override_ = pybind11::get_override (static_cast<const PyAudioFormatReader<Base>*> (this), "compareElements"); override_)
+        if (auto override_ = Helpers::getCachedOverride (static_cast<const PyAudioFormatReader<Base>*> (this), "compareElements"); override_)
         {
             auto sample = override_ (sampleIndex);
 
@@ -161,7 +161,7 @@ struct PyAudioFormatWriter : Base
     {
         pybind11::gil_scoped_acquire gil;
 
-        if (pybind11::function override_ = pybind11::get_override (static_cast<const Base*> (this), "write"); override_)
+        if (auto override_ = Helpers::getCachedOverride (static_cast<const Base*> (this), "write"); override_)
         {
             pybind11::list channelSamples;
 
@@ -185,12 +185,12 @@ struct PyAudioFormatWriterIncomingDataReceiver : juce::AudioFormatWriter::Thread
 
     void reset (int numChannels, double sampleRate, juce::int64 totalSamplesInSource) override
     {
-        PYBIND11_OVERRIDE_PURE (void, juce::AudioFormatWriter::ThreadedWriter::IncomingDataReceiver, reset, numChannels, sampleRate, totalSamplesInSource);
+        POPSICLE_OVERRIDE_PURE (void, juce::AudioFormatWriter::ThreadedWriter::IncomingDataReceiver, reset, numChannels, sampleRate, totalSamplesInSource);
     }
 
     void addBlock (juce::int64 sampleNumberInSource, const juce::AudioBuffer<float>& newData, int startOffsetInBuffer, int numSamples) override
     {
-        PYBIND11_OVERRIDE_PURE (void, juce::AudioFormatWriter::ThreadedWriter::IncomingDataReceiver, addBlock, sampleNumberInSource, newData, startOffsetInBuffer, numSamples);
+        POPSICLE_OVERRIDE_PURE (void, juce::AudioFormatWriter::ThreadedWriter::IncomingDataReceiver, addBlock, sampleNumberInSource, newData, startOffsetInBuffer, numSamples);
     }
 };
 
@@ -213,62 +213,62 @@ struct PyAudioFormat : Base
 
     juce::StringArray getFileExtensions() const override
     {
-        PYBIND11_OVERRIDE (juce::StringArray, Base, getFileExtensions);
+        POPSICLE_OVERRIDE (juce::StringArray, Base, getFileExtensions);
     }
 
     bool canHandleFile (const juce::File& fileToTest) override
     {
-        PYBIND11_OVERRIDE_PURE (bool, Base, canHandleFile, fileToTest);
+        POPSICLE_OVERRIDE_PURE (bool, Base, canHandleFile, fileToTest);
     }
 
     juce::Array<int> getPossibleSampleRates() override
     {
-        PYBIND11_OVERRIDE_PURE (juce::Array<int>, Base, getPossibleSampleRates);
+        POPSICLE_OVERRIDE_PURE (juce::Array<int>, Base, getPossibleSampleRates);
     }
 
     juce::Array<int> getPossibleBitDepths() override
     {
-        PYBIND11_OVERRIDE_PURE (juce::Array<int>, Base, getPossibleBitDepths);
+        POPSICLE_OVERRIDE_PURE (juce::Array<int>, Base, getPossibleBitDepths);
     }
 
     bool canDoStereo() override
     {
-        PYBIND11_OVERRIDE_PURE (bool, Base, canDoStereo);
+        POPSICLE_OVERRIDE_PURE (bool, Base, canDoStereo);
     }
 
     bool canDoMono() override
     {
-        PYBIND11_OVERRIDE_PURE (bool, Base, canDoMono);
+        POPSICLE_OVERRIDE_PURE (bool, Base, canDoMono);
     }
 
     bool isCompressed() override
     {
-        PYBIND11_OVERRIDE (bool, Base, isCompressed);
+        POPSICLE_OVERRIDE (bool, Base, isCompressed);
     }
 
     bool isChannelLayoutSupported (const juce::AudioChannelSet& channelSet) override
     {
-        PYBIND11_OVERRIDE (bool, Base, isChannelLayoutSupported, channelSet);
+        POPSICLE_OVERRIDE (bool, Base, isChannelLayoutSupported, channelSet);
     }
 
     juce::StringArray getQualityOptions() override
     {
-        PYBIND11_OVERRIDE (juce::StringArray, Base, getQualityOptions);
+        POPSICLE_OVERRIDE (juce::StringArray, Base, getQualityOptions);
     }
 
     juce::AudioFormatReader* createReaderFor (juce::InputStream* sourceStream, bool deleteStreamIfOpeningFails) override
     {
-        PYBIND11_OVERRIDE_PURE (juce::AudioFormatReader*, Base, createReaderFor, sourceStream, deleteStreamIfOpeningFails);
+        POPSICLE_OVERRIDE_PURE (juce::AudioFormatReader*, Base, createReaderFor, sourceStream, deleteStreamIfOpeningFails);
     }
 
     juce::MemoryMappedAudioFormatReader* createMemoryMappedReader (const juce::File& file) override
     {
-        PYBIND11_OVERRIDE (juce::MemoryMappedAudioFormatReader*, Base, createMemoryMappedReader, file);
+        POPSICLE_OVERRIDE (juce::MemoryMappedAudioFormatReader*, Base, createMemoryMappedReader, file);
     }
 
     juce::MemoryMappedAudioFormatReader* createMemoryMappedReader (juce::FileInputStream* fin) override
     {
-        PYBIND11_OVERRIDE (juce::MemoryMappedAudioFormatReader*, Base, createMemoryMappedReader, fin);
+        POPSICLE_OVERRIDE (juce::MemoryMappedAudioFormatReader*, Base, createMemoryMappedReader, fin);
     }
 
     juce::AudioFormatWriter* createWriterFor (juce::OutputStream* streamToWriteTo,
@@ -278,7 +278,7 @@ struct PyAudioFormat : Base
                                               const juce::StringPairArray& metadataValues,
                                               int qualityOptionIndex) override
     {
-        PYBIND11_OVERRIDE_PURE (juce::AudioFormatWriter*, Base, createWriterFor, streamToWriteTo, sampleRateToUse, numberOfChannels, bitsPerSample, metadataValues, qualityOptionIndex);
+        POPSICLE_OVERRIDE_PURE (juce::AudioFormatWriter*, Base, createWriterFor, streamToWriteTo, sampleRateToUse, numberOfChannels, bitsPerSample, metadataValues, qualityOptionIndex);
     }
 
     juce::AudioFormatWriter* createWriterFor (juce::OutputStream* streamToWriteTo,
@@ -288,7 +288,7 @@ struct PyAudioFormat : Base
                                               const juce::StringPairArray& metadataValues,
                                               int qualityOptionIndex) override
     {
-        PYBIND11_OVERRIDE_PURE (juce::AudioFormatWriter*, Base, createWriterFor, streamToWriteTo, sampleRateToUse, channelLayout, bitsPerSample, metadataValues, qualityOptionIndex);
+        POPSICLE_OVERRIDE_PURE (juce::AudioFormatWriter*, Base, createWriterFor, streamToWriteTo, sampleRateToUse, channelLayout, bitsPerSample, metadataValues, qualityOptionIndex);
     }
 };
 
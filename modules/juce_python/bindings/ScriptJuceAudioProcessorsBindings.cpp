@@ -17,6 +17,10 @@
  */
 
 #include "ScriptJuceAudioProcessorsBindings.h"
+#include "../utilities/ClassDemangling.h"
+
+#include <cstdint>
+#include <optional>
 
 namespace popsicle::Bindings {
 
@@ -27,8 +31,241 @@ using namespace py::literals;
 
 // ============================================================================================
 
-void registerJuceAudioProcessorsBindings ([[maybe_unused]] py::module_& m)
+void registerJuceAudioProcessorsBindings (py::module_& m)
 {
+    // ============================================================================================ juce::AudioProcessor
+
+    py::class_<AudioProcessor, PyAudioProcessor<>> classAudioProcessor (m, "AudioProcessor");
+
+    py::enum_<AudioProcessor::ProcessingPrecision> (classAudioProcessor, "ProcessingPrecision")
+        .value ("singlePrecision", AudioProcessor::ProcessingPrecision::singlePrecision)
+        .value ("doublePrecision", AudioProcessor::ProcessingPrecision::doublePrecision)
+        .export_values();
+
+    py::class_<AudioProcessor::BusesProperties> classAudioProcessorBusesProperties (classAudioProcessor, "BusesProperties");
+
+    classAudioProcessorBusesProperties
+        .def (py::init<>())
+        .def ("addBus", &AudioProcessor::BusesProperties::addBus, "isInput"_a, "name"_a, "defaultLayout"_a, "isActivatedByDefault"_a = true)
+        .def ("withInput", &AudioProcessor::BusesProperties::withInput, "name"_a, "defaultLayout"_a, "isActivatedByDefault"_a = true)
+        .def ("withOutput", &AudioProcessor::BusesProperties::withOutput, "name"_a, "defaultLayout"_a, "isActivatedByDefault"_a = true)
+    ;
+
+    classAudioProcessor
+        .def (py::init<>())
+        .def (py::init<const AudioProcessor::BusesProperties&>(), "ioLayouts"_a)
+        .def ("getName", &AudioProcessor::getName)
+        .def ("prepareToPlay", &AudioProcessor::prepareToPlay, "sampleRate"_a, "maximumExpectedSamplesPerBlock"_a, py::call_guard<py::gil_scoped_release>())
+        .def ("releaseResources", &AudioProcessor::releaseResources, py::call_guard<py::gil_scoped_release>())
+        .def ("processBlock", py::overload_cast<AudioBuffer<float>&, MidiBuffer&> (&AudioProcessor::processBlock),
+            "buffer"_a, "midiMessages"_a, py::call_guard<py::gil_scoped_release>())
+        .def ("processBlock", py::overload_cast<AudioBuffer<double>&, MidiBuffer&> (&AudioProcessor::processBlock),
+            "buffer"_a, "midiMessages"_a, py::call_guard<py::gil_scoped_release>())
+        .def ("processBlockBypassed", py::overload_cast<AudioBuffer<float>&, MidiBuffer&> (&AudioProcessor::processBlockBypassed),
+            "buffer"_a, "midiMessages"_a, py::call_guard<py::gil_scoped_release>())
+        .def ("processBlockBypassed", py::overload_cast<AudioBuffer<double>&, MidiBuffer&> (&AudioProcessor::processBlockBypassed),
+            "buffer"_a, "midiMessages"_a, py::call_guard<py::gil_scoped_release>())
+        .def ("reset", &AudioProcessor::reset)
+        .def ("numChannelsChanged", &AudioProcessor::numChannelsChanged)
+        .def ("getTailLengthSeconds", &AudioProcessor::getTailLengthSeconds)
+        .def ("acceptsMidi", &AudioProcessor::acceptsMidi)
+        .def ("producesMidi", &AudioProcessor::producesMidi)
+        .def ("supportsMPE", &AudioProcessor::supportsMPE)
+        .def ("isMidiEffect", &AudioProcessor::isMidiEffect)
+        .def ("supportsDoublePrecisionProcessing", &AudioProcessor::supportsDoublePrecisionProcessing)
+        .def ("getProcessingPrecision", &AudioProcessor::getProcessingPrecision)
+        .def ("isUsingDoublePrecision", &AudioProcessor::isUsingDoublePrecision)
+        .def ("setProcessingPrecision", &AudioProcessor::setProcessingPrecision, "newPrecision"_a)
+        .def ("getBusCount", &AudioProcessor::getBusCount, "isInput"_a)
+        .def ("getChannelCountOfBus", &AudioProcessor::getChannelCountOfBus, "isInput"_a, "busIndex"_a)
+        .def ("enableAllBuses", &AudioProcessor::enableAllBuses)
+        .def ("getTotalNumInputChannels", &AudioProcessor::getTotalNumInputChannels)
+        .def ("getTotalNumOutputChannels", &AudioProcessor::getTotalNumOutputChannels)
+        .def ("getMainBusNumInputChannels", &AudioProcessor::getMainBusNumInputChannels)
+        .def ("getMainBusNumOutputChannels", &AudioProcessor::getMainBusNumOutputChannels)
+        .def ("getSampleRate", &AudioProcessor::getSampleRate)
+        .def ("getBlockSize", &AudioProcessor::getBlockSize)
+        .def ("getLatencySamples", &AudioProcessor::getLatencySamples)
+        .def ("setLatencySamples", &AudioProcessor::setLatencySamples, "newLatency"_a)
+        .def ("setPlayConfigDetails", &AudioProcessor::setPlayConfigDetails,
+            "numIns"_a, "numOuts"_a, "sampleRate"_a, "blockSize"_a, py::call_guard<py::gil_scoped_release>())
+        .def ("setRateAndBufferSizeDetails", &AudioProcessor::setRateAndBufferSizeDetails, "sampleRate"_a, "blockSize"_a)
+        .def ("isSuspended", &AudioProcessor::isSuspended)
+        .def ("suspendProcessing", &AudioProcessor::suspendProcessing, "shouldBeSuspended"_a, py::call_guard<py::gil_scoped_release>())
+        .def ("isNonRealtime", &AudioProcessor::isNonRealtime)
+        .def ("setNonRealtime", &AudioProcessor::setNonRealtime, "isNonRealtime"_a, py::call_guard<py::gil_scoped_release>())
+        .def ("getPlayHead", &AudioProcessor::getPlayHead, py::return_value_policy::reference)
+        .def ("setPlayHead", &AudioProcessor::setPlayHead, "newPlayHead"_a, py::keep_alive<1, 2>())
+        .def ("hasEditor", &AudioProcessor::hasEditor)
+        .def ("getNumPrograms", &AudioProcessor::getNumPrograms)
+        .def ("getCurrentProgram", &AudioProcessor::getCurrentProgram)
+        .def ("setCurrentProgram", &AudioProcessor::setCurrentProgram, "index"_a)
+        .def ("getProgramName", &AudioProcessor::getProgramName, "index"_a)
+        .def ("changeProgramName", &AudioProcessor::changeProgramName, "index"_a, "newName"_a)
+        .def ("getStateInformation", &AudioProcessor::getStateInformation, "destData"_a)
+        .def ("setStateInformation", [](AudioProcessor& self, py::buffer data)
+        {
+            const auto info = data.request();
+            self.setStateInformation (info.ptr, static_cast<int> (info.size * info.itemsize));
+        }, "data"_a)
+    //.def ("createEditor", &AudioProcessor::createEditor)
+    //.def ("getParameters", &AudioProcessor::getParameters)
+    ;
+
+    bindCallbackTimingStats (classAudioProcessor);
+
+    py::class_<PyNativeAudioProcessor, AudioProcessor> classNativeAudioProcessor (m, "NativeAudioProcessor");
+
+    classNativeAudioProcessor
+        .def (py::init ([](py::object process, py::object userData, py::object prepare, py::object release, int numInputChannels, int numOutputChannels, const String& name)
+        {
+            return new PyNativeAudioProcessor (
+                Helpers::getNativeFunction<PyNativeAudioProcessor::ProcessFunction> (process),
+                Helpers::getNativeAddress (userData),
+                Helpers::getNativeFunction<PyNativeAudioProcessor::PrepareFunction> (prepare),
+                Helpers::getNativeFunction<PyNativeAudioProcessor::ReleaseFunction> (release),
+                numInputChannels,
+                numOutputChannels,
+                name);
+        }), "process"_a, "userData"_a = py::none(), "prepare"_a = py::none(), "release"_a = py::none(),
+            "numInputChannels"_a = 2, "numOutputChannels"_a = 2, "name"_a = "NativeAudioProcessor",
+            py::keep_alive<1, 2>(), py::keep_alive<1, 3>(), py::keep_alive<1, 4>(), py::keep_alive<1, 5>())
+        .def ("getUserData", [](const PyNativeAudioProcessor& self) { return reinterpret_cast<std::uintptr_t> (self.getUserData()); })
+    ;
+
+    // ============================================================================================ juce::AudioProcessorGraph
+
+    py::class_<AudioProcessorGraph, AudioProcessor> classAudioProcessorGraph (m, "AudioProcessorGraph");
+
+    py::enum_<AudioProcessorGraph::UpdateKind> (classAudioProcessorGraph, "UpdateKind")
+        .value ("sync", AudioProcessorGraph::UpdateKind::sync)
+        .value ("async", AudioProcessorGraph::UpdateKind::async)
+        .value ("none", AudioProcessorGraph::UpdateKind::none)
+        .export_values();
+
+    py::class_<AudioProcessorGraph::NodeID> classAudioProcessorGraphNodeID (classAudioProcessorGraph, "NodeID");
+
+    classAudioProcessorGraphNodeID
+        .def (py::init<>())
+        .def (py::init<uint32>(), "uid"_a)
+        .def_readwrite ("uid", &AudioProcessorGraph::NodeID::uid)
+        .def (py::self == py::self)
+        .def (py::self != py::self)
+        .def (py::self < py::self)
+        .def ("__hash__", [](const AudioProcessorGraph::NodeID& self) { return self.uid; })
+        .def ("__repr__", [](const AudioProcessorGraph::NodeID& self)
+        {
+            String result;
+            result << Helpers::pythonizeModuleClassName (PythonModuleName, typeid (self).name()) << "(" << static_cast<int64> (self.uid) << ")";
+            return result;
+        })
+    ;
+
+    py::class_<AudioProcessorGraph::NodeAndChannel> classAudioProcessorGraphNodeAndChannel (classAudioProcessorGraph, "NodeAndChannel");
+
+    classAudioProcessorGraphNodeAndChannel
+        .def (py::init ([](AudioProcessorGraph::NodeID nodeID, int channelIndex)
+        {
+            return AudioProcessorGraph::NodeAndChannel { nodeID, channelIndex };
+        }), "nodeID"_a, "channelIndex"_a)
+        .def_readwrite ("nodeID", &AudioProcessorGraph::NodeAndChannel::nodeID)
+        .def_readwrite ("channelIndex", &AudioProcessorGraph::NodeAndChannel::channelIndex)
+        .def ("isMIDI", &AudioProcessorGraph::NodeAndChannel::isMIDI)
+        .def (py::self == py::self)
+        .def (py::self != py::self)
+        .def (py::self < py::self)
+    ;
+
+    py::class_<AudioProcessorGraph::Connection> classAudioProcessorGraphConnection (classAudioProcessorGraph, "Connection");
+
+    classAudioProcessorGraphConnection
+        .def (py::init<>())
+        .def (py::init<AudioProcessorGraph::NodeAndChannel, AudioProcessorGraph::NodeAndChannel>(), "source"_a, "destination"_a)
+        .def_readwrite ("source", &AudioProcessorGraph::Connection::source)
+        .def_readwrite ("destination", &AudioProcessorGraph::Connection::destination)
+        .def (py::self == py::self)
+        .def (py::self != py::self)
+        .def (py::self < py::self)
+    ;
+
+    py::class_<AudioProcessorGraph::Node, AudioProcessorGraph::Node::Ptr> classAudioProcessorGraphNode (classAudioProcessorGraph, "Node");
+
+    classAudioProcessorGraphNode
+        .def_readonly ("nodeID", &AudioProcessorGraph::Node::nodeID)
+        .def_readwrite ("properties", &AudioProcessorGraph::Node::properties)
+        .def ("getProcessor", &AudioProcessorGraph::Node::getProcessor, py::return_value_policy::reference_internal)
+        .def ("isBypassed", &AudioProcessorGraph::Node::isBypassed)
+        .def ("setBypassed", &AudioProcessorGraph::Node::setBypassed, "shouldBeBypassed"_a)
+    ;
+
+    py::class_<AudioProcessorGraph::AudioGraphIOProcessor, AudioProcessor> classAudioGraphIOProcessor (classAudioProcessorGraph, "AudioGraphIOProcessor");
+
+    py::enum_<AudioProcessorGraph::AudioGraphIOProcessor::IODeviceType> (classAudioGraphIOProcessor, "IODeviceType")
+        .value ("audioInputNode", AudioProcessorGraph::AudioGraphIOProcessor::IODeviceType::audioInputNode)
+        .value ("audioOutputNode", AudioProcessorGraph::AudioGraphIOProcessor::IODeviceType::audioOutputNode)
+        .value ("midiInputNode", AudioProcessorGraph::AudioGraphIOProcessor::IODeviceType::midiInputNode)
+        .value ("midiOutputNode", AudioProcessorGraph::AudioGraphIOProcessor::IODeviceType::midiOutputNode)
+        .export_values();
+
+    classAudioGraphIOProcessor
+        .def (py::init<AudioProcessorGraph::AudioGraphIOProcessor::IODeviceType>(), "type"_a)
+        .def ("getType", &AudioProcessorGraph::AudioGraphIOProcessor::getType)
+        .def ("getParentGraph", &AudioProcessorGraph::AudioGraphIOProcessor::getParentGraph, py::return_value_policy::reference)
+        .def ("isInput", &AudioProcessorGraph::AudioGraphIOProcessor::isInput)
+        .def ("isOutput", &AudioProcessorGraph::AudioGraphIOProcessor::isOutput)
+    ;
+
+    classAudioProcessorGraph.attr ("midiChannelIndex") = static_cast<int> (AudioProcessorGraph::midiChannelIndex);
+
+    classAudioProcessorGraph
+        .def (py::init<>())
+        .def ("clear", &AudioProcessorGraph::clear, "updateKind"_a = AudioProcessorGraph::UpdateKind::sync, py::call_guard<py::gil_scoped_release>())
+        .def ("getNodes", [](const AudioProcessorGraph& self)
+        {
+            py::list result;
+
+            for (auto* node : self.getNodes())
+                result.append (AudioProcessorGraph::Node::Ptr (node));
+
+            return result;
+        })
+        .def ("getNumNodes", &AudioProcessorGraph::getNumNodes)
+        .def ("getNode", &AudioProcessorGraph::getNode, "index"_a)
+        .def ("getNodeForId", [](const AudioProcessorGraph& self, AudioProcessorGraph::NodeID nodeID)
+        {
+            return AudioProcessorGraph::Node::Ptr (self.getNodeForId (nodeID));
+        }, "nodeID"_a)
+        .def ("addNode", [](AudioProcessorGraph& self, py::object newProcessor, std::optional<AudioProcessorGraph::NodeID> nodeID, AudioProcessorGraph::UpdateKind updateKind)
+        {
+            if (! py::isinstance<AudioProcessor> (newProcessor))
+                throw py::type_error ("The processor to add must be an instance of AudioProcessor");
+
+            auto processor = std::unique_ptr<AudioProcessor> (newProcessor.release().cast<AudioProcessor*>());
+
+            py::gil_scoped_release release;
+            return self.addNode (std::move (processor), nodeID, updateKind);
+        }, "newProcessor"_a, "nodeID"_a = py::none(), "updateKind"_a = AudioProcessorGraph::UpdateKind::sync)
+        .def ("removeNode", py::overload_cast<AudioProcessorGraph::NodeID, AudioProcessorGraph::UpdateKind> (&AudioProcessorGraph::removeNode),
+            "nodeID"_a, "updateKind"_a = AudioProcessorGraph::UpdateKind::sync, py::call_guard<py::gil_scoped_release>())
+        .def ("removeNode", py::overload_cast<AudioProcessorGraph::Node*, AudioProcessorGraph::UpdateKind> (&AudioProcessorGraph::removeNode),
+            "node"_a, "updateKind"_a = AudioProcessorGraph::UpdateKind::sync, py::call_guard<py::gil_scoped_release>())
+        .def ("getConnections", &AudioProcessorGraph::getConnections)
+        .def ("isConnected", py::overload_cast<const AudioProcessorGraph::Connection&> (&AudioProcessorGraph::isConnected, py::const_), "connection"_a)
+        .def ("isConnected", py::overload_cast<AudioProcessorGraph::NodeID, AudioProcessorGraph::NodeID> (&AudioProcessorGraph::isConnected, py::const_),
+            "possibleSourceNodeID"_a, "possibleDestNodeID"_a)
+        .def ("isAnInputTo", py::overload_cast<AudioProcessorGraph::NodeID, AudioProcessorGraph::NodeID> (&AudioProcessorGraph::isAnInputTo, py::const_),
+            "source"_a, "destination"_a)
+        .def ("canConnect", &AudioProcessorGraph::canConnect, "connection"_a)
+        .def ("addConnection", &AudioProcessorGraph::addConnection,
+            "connection"_a, "updateKind"_a = AudioProcessorGraph::UpdateKind::sync, py::call_guard<py::gil_scoped_release>())
+        .def ("removeConnection", &AudioProcessorGraph::removeConnection,
+            "connection"_a, "updateKind"_a = AudioProcessorGraph::UpdateKind::sync, py::call_guard<py::gil_scoped_release>())
+        .def ("disconnectNode", &AudioProcessorGraph::disconnectNode,
+            "nodeID"_a, "updateKind"_a = AudioProcessorGraph::UpdateKind::sync, py::call_guard<py::gil_scoped_release>())
+        .def ("removeIllegalConnections", &AudioProcessorGraph::removeIllegalConnections,
+            "updateKind"_a = AudioProcessorGraph::UpdateKind::sync, py::call_guard<py::gil_scoped_release>())
+        .def ("rebuild", &AudioProcessorGraph::rebuild, py::call_guard<py::gil_scoped_release>())
+    ;
 }
 
 } // namespace popsicle::Bindings
@@ -24,16 +24,280 @@
  #include <juce_audio_processors/juce_audio_processors.h>
 #endif
 
+#include "ScriptJuceAudioBasicsBindings.h"
+
 #define JUCE_PYTHON_INCLUDE_PYBIND11_OPERATORS
 #define JUCE_PYTHON_INCLUDE_PYBIND11_STL
 #include "../utilities/PyBind11Includes.h"
 
 #include "../utilities/PythonInterop.h"
 
+#include <memory>
+#include <type_traits>
+
 namespace popsicle::Bindings {
 
 // =================================================================================================
 
 void registerJuceAudioProcessorsBindings (pybind11::module_& m);
 
+// =================================================================================================
+
+/**
+ * @brief Trampoline for audio processors subclassed in python.
+ *
+ * Only the python subclasses take the GIL: native processors, and graphs made of them, render without it. The audio
+ * and MIDI buffers are passed by reference to processBlock, so python writes straight into the buffers being rendered.
+ * Editors can't be created from python, so createEditor always returns nullptr.
+ */
+template <class Base = juce::AudioProcessor>
+struct PyAudioProcessor : Base, PyCallbackTimingStatsHolder
+{
+    PyAudioProcessor() = default;
+
+    explicit PyAudioProcessor (const juce::AudioProcessor::BusesProperties& ioLayouts)
+        : Base (ioLayouts)
+    {
+    }
+
+    const juce::String getName() const override
+    {
+        POPSICLE_OVERRIDE_PURE (const juce::String, Base, getName);
+    }
+
+    void prepareToPlay (double sampleRate, int maximumExpectedSamplesPerBlock) override
+    {
+        timingStats.prepare (sampleRate, maximumExpectedSamplesPerBlock);
+
+        POPSICLE_OVERRIDE_PURE (void, Base, prepareToPlay, sampleRate, maximumExpectedSamplesPerBlock);
+    }
+
+    void releaseResources() override
+    {
+        POPSICLE_OVERRIDE_PURE (void, Base, releaseResources);
+    }
+
+    void processBlock (juce::AudioBuffer<float>& buffer, juce::MidiBuffer& midiMessages) override
+    {
+        if (processBlockInPython (buffer, midiMessages))
+            return;
+
+        // A python subclass must override processBlock, but throwing here would escape on the audio thread
+        jassertfalse;
+        buffer.clear();
+    }
+
+    void processBlock (juce::AudioBuffer<double>& buffer, juce::MidiBuffer& midiMessages) override
+    {
+        if (! processBlockInPython (buffer, midiMessages))
+            Base::processBlock (buffer, midiMessages);
+    }
+
+    bool supportsDoublePrecisionProcessing() const override
+    {
+        POPSICLE_OVERRIDE (bool, Base, supportsDoublePrecisionProcessing);
+    }
+
+    void reset() override
+    {
+        POPSICLE_OVERRIDE (void, Base, reset);
+    }
+
+    void numChannelsChanged() override
+    {
+        POPSICLE_OVERRIDE (void, Base, numChannelsChanged);
+    }
+
+    double getTailLengthSeconds() const override
+    {
+        POPSICLE_OVERRIDE_PURE (double, Base, getTailLengthSeconds);
+    }
+
+    bool acceptsMidi() const override
+    {
+        POPSICLE_OVERRIDE_PURE (bool, Base, acceptsMidi);
+    }
+
+    bool producesMidi() const override
+    {
+        POPSICLE_OVERRIDE_PURE (bool, Base, producesMidi);
+    }
+
+    bool isMidiEffect() const override
+    {
+        POPSICLE_OVERRIDE (bool, Base, isMidiEffect);
+    }
+
+    juce::AudioProcessorEditor* createEditor() override
+    {
+        return nullptr;
+    }
+
+    bool hasEditor() const override
+    {
+        POPSICLE_OVERRIDE_IMPL (bool, Base, "hasEditor");
+        return false;
+    }
+
+    int getNumPrograms() override
+    {
+        POPSICLE_OVERRIDE_IMPL (int, Base, "getNumPrograms");
+        return 1;
+    }
+
+    int getCurrentProgram() override
+    {
+        POPSICLE_OVERRIDE_IMPL (int, Base, "getCurrentProgram");
+        return 0;
+    }
+
+    void setCurrentProgram (int index) override
+    {
+        POPSICLE_OVERRIDE_IMPL (void, Base, "setCurrentProgram", index);
+    }
+
+    const juce::String getProgramName (int index) override
+    {
+        POPSICLE_OVERRIDE_IMPL (const juce::String, Base, "getProgramName", index);
+        return {};
+    }
+
+    void changeProgramName (int index, const juce::String& newName) override
+    {
+        POPSICLE_OVERRIDE_IMPL (void, Base, "changeProgramName", index, newName);
+    }
+
+    void getStateInformation (juce::MemoryBlock& destData) override
+    {
+        pybind11::gil_scoped_acquire gil;
+
+        if (auto override_ = Helpers::getCachedOverride (static_cast<const Base*> (this), "getStateInformation"))
+            override_ (std::addressof (destData));
+    }
+
+    void setStateInformation (const void* data, int sizeInBytes) override
+    {
+        pybind11::gil_scoped_acquire gil;
+
+        if (auto override_ = Helpers::getCachedOverride (static_cast<const Base*> (this), "setStateInformation"))
+            override_ (pybind11::memoryview::from_memory (data, static_cast<pybind11::ssize_t> (sizeInBytes)));
+    }
+
+private:
+    template <class FloatType>
+    bool processBlockInPython (juce::AudioBuffer<FloatType>& buffer, juce::MidiBuffer& midiMessages)
+    {
+        PyCallbackTimingStats::ScopedBlock timedBlock (timingStats, buffer.getNumSamples());
+
+        pybind11::gil_scoped_acquire gil;
+        timedBlock.gilAcquired();
+
+        if (auto override_ = Helpers::getCachedOverride (static_cast<const Base*> (this), "processBlock"))
+        {
+            override_ (std::addressof (buffer), std::addressof (midiMessages));
+            timedBlock.pythonFinished();
+            return true;
+        }
+
+        return false;
+    }
+};
+
+// =================================================================================================
+
+/**
+ * @brief An audio processor forwarding to native C function pointers, that never takes the GIL.
+ *
+ * The process function renders the channels of the buffer in place, MIDI is passed through untouched.
+ */
+class PyNativeAudioProcessor : public juce::AudioProcessor
+{
+public:
+    using ProcessFunction = void (*) (void* userData, float* const* channels, int numChannels, int numSamples);
+    using PrepareFunction = void (*) (void* userData, double sampleRate, int maximumExpectedSamplesPerBlock);
+    using ReleaseFunction = void (*) (void* userData);
+
+    PyNativeAudioProcessor (ProcessFunction process,
+                            void* userData,
+                            PrepareFunction prepare,
+                            ReleaseFunction release,
+                            int numInputChannels,
+                            int numOutputChannels,
+                            const juce::String& name)
+        : juce::AudioProcessor (makeBusesProperties (numInputChannels, numOutputChannels))
+        , process (process)
+        , prepare (prepare)
+        , release (release)
+        , userData (userData)
+        , name (name)
+    {
+    }
+
+    const juce::String getName() const override
+    {
+        return name;
+    }
+
+    void prepareToPlay (double sampleRate, int maximumExpectedSamplesPerBlock) override
+    {
+        if (prepare != nullptr)
+            prepare (userData, sampleRate, maximumExpectedSamplesPerBlock);
+    }
+
+    void releaseResources() override
+    {
+        if (release != nullptr)
+            release (userData);
+    }
+
+    void processBlock (juce::AudioBuffer<float>& buffer, juce::MidiBuffer&) override
+    {
+        if (process != nullptr)
+            process (userData, buffer.getArrayOfWritePointers(), buffer.getNumChannels(), buffer.getNumSamples());
+    }
+
+    double getTailLengthSeconds() const override { return 0.0; }
+    bool acceptsMidi() const override { return false; }
+    bool producesMidi() const override { return false; }
+
+    juce::AudioProcessorEditor* createEditor() override { return nullptr; }
+    bool hasEditor() const override { return false; }
+
+    int getNumPrograms() override { return 1; }
+    int getCurrentProgram() override { return 0; }
+    void setCurrentProgram (int) override {}
+    const juce::String getProgramName (int) override { return {}; }
+    void changeProgramName (int, const juce::String&) override {}
+
+    void getStateInformation (juce::MemoryBlock&) override {}
+    void setStateInformation (const void*, int) override {}
+
+    void* getUserData() const noexcept
+    {
+        return userData;
+    }
+
+private:
+    static BusesProperties makeBusesProperties (int numInputChannels, int numOutputChannels)
+    {
+        BusesProperties properties;
+
+        if (numInputChannels > 0)
+            properties = properties.withInput ("Input", juce::AudioChannelSet::canonicalChannelSet (numInputChannels), true);
+
+        if (numOutputChannels > 0)
+            properties = properties.withOutput ("Output", juce::AudioChannelSet::canonicalChannelSet (numOutputChannels), true);
+
+        return properties;
+    }
+
+    ProcessFunction process = nullptr;
+    PrepareFunction prepare = nullptr;
+    ReleaseFunction release = nullptr;
+    void* userData = nullptr;
+    juce::String name;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (PyNativeAudioProcessor)
+};
+
 } // namespace popsicle::Bindings
@@ -19,6 +19,7 @@
 #include "ScriptJuceAudioUtilsBindings.h"
 
 #include "ScriptJuceAudioDevicesBindings.h"
+#include "ScriptJuceAudioProcessorsBindings.h"
 
 namespace popsicle::Bindings {
 
@@ -101,6 +102,19 @@ void registerJuceAudioUtilsBindings (py::module_& m)
         .def ("setSource", py::overload_cast<const AudioBuffer<float>*, double, int64> (&AudioThumbnail::setSource), "newSource"_a, "sampleRate"_a, "hashCode"_a)
         .def ("setSource", py::overload_cast<const AudioBuffer<int>*, double, int64> (&AudioThumbnail::setSource), "newSource"_a, "sampleRate"_a, "hashCode"_a)
     ;
+
+    // ============================================================================================ juce::AudioProcessorPlayer
+
+    py::class_<AudioProcessorPlayer, AudioIODeviceCallback, MidiInputCallback> classAudioProcessorPlayer (m, "AudioProcessorPlayer");
+
+    classAudioProcessorPlayer
+        .def (py::init<bool>(), "doDoublePrecisionProcessing"_a = false)
+        .def ("setProcessor", &AudioProcessorPlayer::setProcessor, "processorToPlay"_a, py::keep_alive<1, 2>(), py::call_guard<py::gil_scoped_release>())
+        .def ("getCurrentProcessor", &AudioProcessorPlayer::getCurrentProcessor, py::return_value_policy::reference)
+        .def ("setDoublePrecisionProcessing", &AudioProcessorPlayer::setDoublePrecisionProcessing, "doublePrecision"_a, py::call_guard<py::gil_scoped_release>())
+        .def ("getDoublePrecisionProcessing", &AudioProcessorPlayer::getDoublePrecisionProcessing)
+        .def ("getMidiMessageCollector", &AudioProcessorPlayer::getMidiMessageCollector, py::return_value_policy::reference_internal)
+    ;
 }
 
 } // namespace popsicle::Bindings
@@ -48,17 +48,17 @@ struct PyAudioAppComponent : PyComponent<Base>
 
     void prepareToPlay (int samplesPerBlockExpected, double sampleRate) override
     {
-        PYBIND11_OVERRIDE_PURE (void, Base, prepareToPlay, samplesPerBlockExpected, sampleRate);
+        POPSICLE_OVERRIDE_PURE (void, Base, prepareToPlay, samplesPerBlockExpected, sampleRate);
     }
 
     void releaseResources() override
     {
-        PYBIND11_OVERRIDE_PURE (void, Base, releaseResources);
+        POPSICLE_OVERRIDE_PURE (void, Base, releaseResources);
     }
 
     void getNextAudioBlock (const juce::AudioSourceChannelInfo& bufferToFill) override
     {
-        PYBIND11_OVERRIDE_PURE (void, Base, getNextAudioBlock, bufferToFill);
+        POPSICLE_OVERRIDE_PURE (void, Base, getNextAudioBlock, bufferToFill);
     }
 };
 
@@ -71,37 +71,37 @@ struct PyAudioThumbnailBase : Base
 
     void clear() override
     {
-        PYBIND11_OVERRIDE_PURE (void, Base, clear);
+        POPSICLE_OVERRIDE_PURE (void, Base, clear);
     }
 
     bool setSource (juce::InputSource* newSource) override
     {
-        PYBIND11_OVERRIDE_PURE (bool, Base, setSource, newSource);
+        POPSICLE_OVERRIDE_PURE (bool, Base, setSource, newSource);
     }
 
     void setReader (juce::AudioFormatReader* newReader, juce::int64 hashCode) override
     {
-        PYBIND11_OVERRIDE_PURE (void, Base, setReader, newReader, hashCode);
+        POPSICLE_OVERRIDE_PURE (void, Base, setReader, newReader, hashCode);
     }
 
     bool loadFrom (juce::InputStream& input) override
     {
-        PYBIND11_OVERRIDE_PURE (bool, Base, loadFrom, input);
+        POPSICLE_OVERRIDE_PURE (bool, Base, loadFrom, input);
     }
 
     void saveTo (juce::OutputStream& output) const override
     {
-        PYBIND11_OVERRIDE_PURE (void, Base, saveTo, output);
+        POPSICLE_OVERRIDE_PURE (void, Base, saveTo, output);
     }
 
     int getNumChannels() const noexcept override
     {
-        PYBIND11_OVERRIDE_PURE (int, Base, getNumChannels);
+        POPSICLE_OVERRIDE_PURE (int, Base, getNumChannels);
     }
 
     double getTotalLength() const noexcept override
     {
-        PYBIND11_OVERRIDE_PURE (double, Base, getTotalLength);
+        POPSICLE_OVERRIDE_PURE (double, Base, getTotalLength);
     }
 
     void drawChannel (juce::Graphics& g,
@@ -113,7 +113,7 @@ struct PyAudioThumbnailBase : Base
     {
         pybind11::gil_scoped_acquire gil;
 
-        if (pybind11::function override_ = pybind11::get_override (static_cast<Base*> (this), "drawChannel"); override_)
+        if (auto override_ = Helpers::getCachedOverride (static_cast<Base*> (this), "drawChannel"); override_)
         {
             override_ (std::addressof (g), area, startTimeSeconds, endTimeSeconds, channelNum, verticalZoomFactor);
 
@@ -131,7 +131,7 @@ struct PyAudioThumbnailBase : Base
     {
         pybind11::gil_scoped_acquire gil;
 
-        if (pybind11::function override_ = pybind11::get_override (static_cast<Base*> (this), "drawChannels"); override_)
+        if (auto override_ = Helpers::getCachedOverride (static_cast<Base*> (this), "drawChannels"); override_)
         {
             override_ (std::addressof (g), area, startTimeSeconds, endTimeSeconds, verticalZoomFactor);
 
@@ -143,17 +143,17 @@ struct PyAudioThumbnailBase : Base
 
     bool isFullyLoaded() const noexcept override
     {
-        PYBIND11_OVERRIDE_PURE (bool, Base, isFullyLoaded);
+        POPSICLE_OVERRIDE_PURE (bool, Base, isFullyLoaded);
     }
 
     juce::int64 getNumSamplesFinished() const noexcept override
     {
-        PYBIND11_OVERRIDE_PURE (juce::int64, Base, getNumSamplesFinished);
+        POPSICLE_OVERRIDE_PURE (juce::int64, Base, getNumSamplesFinished);
     }
 
     float getApproximatePeak() const override
     {
-        PYBIND11_OVERRIDE_PURE (float, Base, getApproximatePeak);
+        POPSICLE_OVERRIDE_PURE (float, Base, getApproximatePeak);
     }
 
     void getApproximateMinMax (double startTime, double endTime, int channelIndex,
@@ -161,7 +161,7 @@ struct PyAudioThumbnailBase : Base
     {
         pybind11::gil_scoped_acquire gil;
 
-        if (pybind11::function override_ = pybind11::get_override (static_cast<const Base*> (this), "getApproximateMinMax"); override_)
+        if (auto override_ = Helpers::getCachedOverride (static_cast<const Base*> (this), "getApproximateMinMax"); override_)
         {
             auto results = override_ (startTime, endTime, channelIndex).cast<pybind11::tuple>();
 
@@ -179,17 +179,17 @@ struct PyAudioThumbnailBase : Base
 
     juce::int64 getHashCode() const override
     {
-        PYBIND11_OVERRIDE_PURE (juce::int64, Base, getHashCode);
+        POPSICLE_OVERRIDE_PURE (juce::int64, Base, getHashCode);
     }
 
     void reset (int numChannels, double sampleRate, juce::int64 totalSamplesInSource) override
     {
-        PYBIND11_OVERRIDE_PURE (void, Base, reset, numChannels, sampleRate, totalSamplesInSource);
+        POPSICLE_OVERRIDE_PURE (void, Base, reset, numChannels, sampleRate, totalSamplesInSource);
     }
 
     void addBlock (juce::int64 sampleNumberInSource, const juce::AudioBuffer<float>& newData, int startOffsetInBuffer, int numSamples) override
     {
-        PYBIND11_OVERRIDE_PURE (void, Base, addBlock, sampleNumberInSource, newData, startOffsetInBuffer, numSamples);
+        POPSICLE_OVERRIDE_PURE (void, Base, addBlock, sampleNumberInSource, newData, startOffsetInBuffer, numSamples);
     }
 };
 
@@ -528,6 +528,11 @@ void registerJuceCoreBindings (py::module_& m)
     juce::SystemStats::setApplicationCrashHandler (Helpers::applicationCrashHandler);
 #endif
 
+    // ============================================================================================ popsicle::Helpers
+
+    m.def ("setOverrideCacheEnabled", &Helpers::setOverrideCacheEnabled);
+    m.def ("isOverrideCacheEnabled", &Helpers::isOverrideCacheEnabled);
+
     // ============================================================================================ juce::Math
 
     m.def ("juce_hypot", &juce_hypot<float>);
@@ -1938,6 +1943,33 @@ void registerJuceCoreBindings (py::module_& m)
         .def ("exitWrite", &ReadWriteLock::exitWrite)
     ;
 
+    // ============================================================================================ juce::AbstractFifo
+
+    py::class_<AbstractFifo> classAbstractFifo (m, "AbstractFifo");
+
+    classAbstractFifo
+        .def (py::init<int>(), "capacity"_a)
+        .def ("getTotalSize", &AbstractFifo::getTotalSize)
+        .def ("getFreeSpace", &AbstractFifo::getFreeSpace)
+        .def ("getNumReady", &AbstractFifo::getNumReady)
+        .def ("reset", &AbstractFifo::reset)
+        .def ("setTotalSize", &AbstractFifo::setTotalSize, "newSize"_a)
+        .def ("prepareToWrite", [](const AbstractFifo& self, int numToWrite)
+        {
+            int startIndex1 = 0, blockSize1 = 0, startIndex2 = 0, blockSize2 = 0;
+            self.prepareToWrite (numToWrite, startIndex1, blockSize1, startIndex2, blockSize2);
+            return py::make_tuple (startIndex1, blockSize1, startIndex2, blockSize2);
+        }, "numToWrite"_a)
+        .def ("finishedWrite", &AbstractFifo::finishedWrite, "numWritten"_a)
+        .def ("prepareToRead", [](const AbstractFifo& self, int numWanted)
+        {
+            int startIndex1 = 0, blockSize1 = 0, startIndex2 = 0, blockSize2 = 0;
+            self.prepareToRead (numWanted, startIndex1, blockSize1, startIndex2, blockSize2);
+            return py::make_tuple (startIndex1, blockSize1, startIndex2, blockSize2);
+        }, "numWanted"_a)
+        .def ("finishedRead", &AbstractFifo::finishedRead, "numRead"_a)
+    ;
+
     // ============================================================================================ juce::InterProcessLock
 
     py::class_<InterProcessLock> classInterProcessLock (m, "InterProcessLock");
@@ -2136,7 +2168,7 @@ void registerJuceCoreBindings (py::module_& m)
 
     // ============================================================================================ juce::TimeSliceThread
 
-    py::class_<TimeSliceThread, PyThread<TimeSliceThread>> classTimeSliceThread (m, "TimeSliceThread");
+    py::class_<TimeSliceThread, Thread, PyThread<TimeSliceThread>> classTimeSliceThread (m, "TimeSliceThread");
     py::class_<TimeSliceClient, PyTimeSliceClient> classTimeSliceClient (m, "TimeSliceClient");
 
     classTimeSliceClient
@@ -287,112 +287,112 @@ public:
 
     juce::int64 getTotalLength() override
     {
-        PYBIND11_OVERRIDE_PURE (juce::int64, juce::InputStream, getTotalLength);
+        POPSICLE_OVERRIDE_PURE (juce::int64, juce::InputStream, getTotalLength);
     }
 
     bool isExhausted() override
     {
-        PYBIND11_OVERRIDE_PURE (bool, juce::InputStream, isExhausted);
+        POPSICLE_OVERRIDE_PURE (bool, juce::InputStream, isExhausted);
     }
 
     int read (void* destBuffer, int maxBytesToRead) override
     {
-        PYBIND11_OVERRIDE_PURE (int, juce::InputStream, read, destBuffer, maxBytesToRead);
+        POPSICLE_OVERRIDE_PURE (int, juce::InputStream, read, destBuffer, maxBytesToRead);
     }
 
     char readByte() override
     {
-        PYBIND11_OVERRIDE (char, juce::InputStream, readByte);
+        POPSICLE_OVERRIDE (char, juce::InputStream, readByte);
     }
 
     short readShort() override
     {
-        PYBIND11_OVERRIDE (short, juce::InputStream, readShort);
+        POPSICLE_OVERRIDE (short, juce::InputStream, readShort);
     }
 
     short readShortBigEndian() override
     {
-        PYBIND11_OVERRIDE (short, juce::InputStream, readShortBigEndian);
+        POPSICLE_OVERRIDE (short, juce::InputStream, readShortBigEndian);
     }
 
     int readInt() override
     {
-        PYBIND11_OVERRIDE (int, juce::InputStream, readInt);
+        POPSICLE_OVERRIDE (int, juce::InputStream, readInt);
     }
 
     int readIntBigEndian() override
     {
-        PYBIND11_OVERRIDE (int, juce::InputStream, readIntBigEndian);
+        POPSICLE_OVERRIDE (int, juce::InputStream, readIntBigEndian);
     }
 
     juce::int64 readInt64() override
     {
-        PYBIND11_OVERRIDE (juce::int64, juce::InputStream, readInt64);
+        POPSICLE_OVERRIDE (juce::int64, juce::InputStream, readInt64);
     }
 
     juce::int64 readInt64BigEndian() override
     {
-        PYBIND11_OVERRIDE (juce::int64, juce::InputStream, readInt64BigEndian);
+        POPSICLE_OVERRIDE (juce::int64, juce::InputStream, readInt64BigEndian);
     }
 
     float readFloat() override
     {
-        PYBIND11_OVERRIDE (float, juce::InputStream, readFloat);
+        POPSICLE_OVERRIDE (float, juce::InputStream, readFloat);
     }
 
     float readFloatBigEndian() override
     {
-        PYBIND11_OVERRIDE (float, juce::InputStream, readFloatBigEndian);
+        POPSICLE_OVERRIDE (float, juce::InputStream, readFloatBigEndian);
     }
 
     double readDouble() override
     {
-        PYBIND11_OVERRIDE (double, juce::InputStream, readDouble);
+        POPSICLE_OVERRIDE (double, juce::InputStream, readDouble);
     }
 
     double readDoubleBigEndian() override
     {
-        PYBIND11_OVERRIDE (double, juce::InputStream, readDoubleBigEndian);
+        POPSICLE_OVERRIDE (double, juce::InputStream, readDoubleBigEndian);
     }
 
     int readCompressedInt() override
     {
-        PYBIND11_OVERRIDE (int, juce::InputStream, readCompressedInt);
+        POPSICLE_OVERRIDE (int, juce::InputStream, readCompressedInt);
     }
 
     juce::String readNextLine() override
     {
-        PYBIND11_OVERRIDE (juce::String, juce::InputStream, readNextLine);
+        POPSICLE_OVERRIDE (juce::String, juce::InputStream, readNextLine);
     }
 
     juce::String readString() override
     {
-        PYBIND11_OVERRIDE (juce::String, juce::InputStream, readString);
+        POPSICLE_OVERRIDE (juce::String, juce::InputStream, readString);
     }
 
     juce::String readEntireStreamAsString() override
     {
-        PYBIND11_OVERRIDE (juce::String, juce::InputStream, readEntireStreamAsString);
+        POPSICLE_OVERRIDE (juce::String, juce::InputStream, readEntireStreamAsString);
     }
 
     size_t readIntoMemoryBlock (juce::MemoryBlock& destBlock, ssize_t maxNumBytesToRead) override
     {
-        PYBIND11_OVERRIDE (size_t, juce::InputStream, readIntoMemoryBlock, destBlock, maxNumBytesToRead);
+        POPSICLE_OVERRIDE (size_t, juce::InputStream, readIntoMemoryBlock, destBlock, maxNumBytesToRead);
     }
 
     juce::int64 getPosition() override
     {
-        PYBIND11_OVERRIDE_PURE (juce::int64, juce::InputStream, getPosition);
+        POPSICLE_OVERRIDE_PURE (juce::int64, juce::InputStream, getPosition);
     }
 
     bool setPosition (juce::int64 newPosition) override
     {
-        PYBIND11_OVERRIDE_PURE (bool, juce::InputStream, setPosition, newPosition);
+        POPSICLE_OVERRIDE_PURE (bool, juce::InputStream, setPosition, newPosition);
     }
 
     void skipNextBytes (juce::int64 newPosition) override
     {
-        PYBIND11_OVERRIDE (void, juce::InputStream, skipNextBytes, newPosition);
+        POPSICLE_OVERRIDE (void, juce::InputStream, skipNextBytes, newPosition);
     }
 };
 
@@ -404,17 +404,17 @@ struct PyInputSource : juce::InputSource
 
     juce::InputStream* createInputStream() override
     {
-        PYBIND11_OVERRIDE_PURE (juce::InputStream*, juce::InputSource, createInputStream);
+        POPSICLE_OVERRIDE_PURE (juce::InputStream*, juce::InputSource, createInputStream);
     }
 
     juce::InputStream* createInputStreamFor (const juce::String& relatedItemPath) override
     {
-        PYBIND11_OVERRIDE_PURE (juce::InputStream*, juce::InputSource, createInputStreamFor, relatedItemPath);
+        POPSICLE_OVERRIDE_PURE (juce::InputStream*, juce::InputSource, createInputStreamFor, relatedItemPath);
     }
 
     juce::int64 hashCode() const override
     {
-        PYBIND11_OVERRIDE_PURE (juce::int64, juce::InputSource, hashCode);
+        POPSICLE_OVERRIDE_PURE (juce::int64, juce::InputSource, hashCode);
     }
 };
 
@@ -427,108 +427,108 @@ struct PyOutputStream : Base
 
     void flush() override
     {
-        PYBIND11_OVERRIDE_PURE (void, juce::OutputStream, flush);
+        POPSICLE_OVERRIDE_PURE (void, juce::OutputStream, flush);
     }
 
     bool setPosition (juce::int64 newPosition) override
     {
-        PYBIND11_OVERRIDE_PURE (bool, juce::OutputStream, setPosition, newPosition);
+        POPSICLE_OVERRIDE_PURE (bool, juce::OutputStream, setPosition, newPosition);
     }
 
     juce::int64 getPosition() override
     {
-        PYBIND11_OVERRIDE_PURE (juce::int64, juce::OutputStream, getPosition);
+        POPSICLE_OVERRIDE_PURE (juce::int64, juce::OutputStream, getPosition);
     }
 
     bool write (const void* dataToWrite, size_t numberOfBytes) override
     {
-        PYBIND11_OVERRIDE_PURE (bool, juce::OutputStream, write, dataToWrite, numberOfBytes);
+        POPSICLE_OVERRIDE_PURE (bool, juce::OutputStream, write, dataToWrite, numberOfBytes);
     }
 
     bool writeByte (char value) override
     {
-        PYBIND11_OVERRIDE (bool, juce::OutputStream, writeByte, value);
+        POPSICLE_OVERRIDE (bool, juce::OutputStream, writeByte, value);
     }
 
     bool writeBool (bool value) override
     {
-        PYBIND11_OVERRIDE (bool, juce::OutputStream, writeBool, value);
+        POPSICLE_OVERRIDE (bool, juce::OutputStream, writeBool, value);
     }
 
     bool writeShort (short value) override
     {
-        PYBIND11_OVERRIDE (bool, juce::OutputStream, writeShort, value);
+        POPSICLE_OVERRIDE (bool, juce::OutputStream, writeShort, value);
     }
 
     bool writeShortBigEndian (short value) override
     {
-        PYBIND11_OVERRIDE (bool, juce::OutputStream, writeShortBigEndian, value);
+        POPSICLE_OVERRIDE (bool, juce::OutputStream, writeShortBigEndian, value);
     }
 
 
     bool writeInt (int value) override
     {
-        PYBIND11_OVERRIDE (bool, juce::OutputStream, writeInt, value);
+        POPSICLE_OVERRIDE (bool, juce::OutputStream, writeInt, value);
     }
 
     bool writeIntBigEndian (int value) override
     {
-        PYBIND11_OVERRIDE (bool, juce::OutputStream, writeIntBigEndian, value);
+        POPSICLE_OVERRIDE (bool, juce::OutputStream, writeIntBigEndian, value);
     }
 
     bool writeInt64 (juce::int64 value) override
     {
-        PYBIND11_OVERRIDE (bool, juce::OutputStream, writeInt64, value);
+        POPSICLE_OVERRIDE (bool, juce::OutputStream, writeInt64, value);
     }
 
     bool writeInt64BigEndian (juce::int64 value) override
     {
-        PYBIND11_OVERRIDE (bool, juce::OutputStream, writeInt64BigEndian, value);
+        POPSICLE_OVERRIDE (bool, juce::OutputStream, writeInt64BigEndian, value);
     }
 
     bool writeFloat (float value) override
     {
-        PYBIND11_OVERRIDE (bool, juce::OutputStream, writeFloat, value);
+        POPSICLE_OVERRIDE (bool, juce::OutputStream, writeFloat, value);
     }
 
     bool writeFloatBigEndian (float value) override
     {
-        PYBIND11_OVERRIDE (bool, juce::OutputStream, writeFloatBigEndian, value);
+        POPSICLE_OVERRIDE (bool, juce::OutputStream, writeFloatBigEndian, value);
     }
 
     bool writeDouble (double value) override
     {
-        PYBIND11_OVERRIDE (bool, juce::OutputStream, writeDouble, value);
+        POPSICLE_OVERRIDE (bool, juce::OutputStream, writeDouble, value);
     }
 
     bool writeDoubleBigEndian (double value) override
     {
-        PYBIND11_OVERRIDE (bool, juce::OutputStream, writeDoubleBigEndian, value);
+        POPSICLE_OVERRIDE (bool, juce::OutputStream, writeDoubleBigEndian, value);
     }
 
     bool writeRepeatedByte (juce::uint8 byte, size_t numTimesToRepeat) override
     {
-        PYBIND11_OVERRIDE (bool, juce::OutputStream, writeRepeatedByte, byte, numTimesToRepeat);
+        POPSICLE_OVERRIDE (bool, juce::OutputStream, writeRepeatedByte, byte, numTimesToRepeat);
     }
 
     bool writeCompressedInt (int value) override
     {
-        PYBIND11_OVERRIDE (bool, juce::OutputStream, writeCompressedInt, value);
+        POPSICLE_OVERRIDE (bool, juce::OutputStream, writeCompressedInt, value);
     }
 
     bool writeString (const juce::String& text) override
     {
-        PYBIND11_OVERRIDE (bool, juce::OutputStream, writeString, text);
+        POPSICLE_OVERRIDE (bool, juce::OutputStream, writeString, text);
     }
 
     bool writeText (const juce::String& text, bool asUTF16, bool writeUTF16ByteOrderMark, const char* lineEndings) override
     {
-        PYBIND11_OVERRIDE (bool, juce::OutputStream, writeText, text, asUTF16, writeUTF16ByteOrderMark, lineEndings);
+        POPSICLE_OVERRIDE (bool, juce::OutputStream, writeText, text, asUTF16, writeUTF16ByteOrderMark, lineEndings);
     }
 
     juce::int64 writeFromInputStream (juce::InputStream& source, juce::int64 maxNumBytesToWrite) override
     {
-        PYBIND11_OVERRIDE (juce::int64, juce::OutputStream, writeFromInputStream, source, maxNumBytesToWrite);
+        POPSICLE_OVERRIDE (juce::int64, juce::OutputStream, writeFromInputStream, source, maxNumBytesToWrite);
     }
 };
 
@@ -540,12 +540,12 @@ struct PyFileFilter : juce::FileFilter
 
     bool isFileSuitable (const juce::File& file) const override
     {
-        PYBIND11_OVERRIDE_PURE (bool, juce::FileFilter, isFileSuitable, file);
+        POPSICLE_OVERRIDE_PURE (bool, juce::FileFilter, isFileSuitable, file);
     }
 
     bool isDirectorySuitable (const juce::File& file) const override
     {
-        PYBIND11_OVERRIDE_PURE (bool, juce::FileFilter, isDirectorySuitable, file);
+        POPSICLE_OVERRIDE_PURE (bool, juce::FileFilter, isDirectorySuitable, file);
     }
 };
 
@@ -555,12 +555,12 @@ struct PyURLDownloadTaskListener : public juce::URL::DownloadTaskListener
 {
     void finished (juce::URL::DownloadTask* task, bool success) override
     {
-        PYBIND11_OVERRIDE_PURE(void, juce::URL::DownloadTaskListener, finished, task, success);
+        POPSICLE_OVERRIDE_PURE(void, juce::URL::DownloadTaskListener, finished, task, success);
     }
 
     void progress (juce::URL::DownloadTask* task, juce::int64 bytesDownloaded, juce::int64 totalLength) override
     {
-        PYBIND11_OVERRIDE_PURE(void, juce::URL::DownloadTaskListener, progress, task, bytesDownloaded, totalLength);
+        POPSICLE_OVERRIDE_PURE(void, juce::URL::DownloadTaskListener, progress, task, bytesDownloaded, totalLength);
     }
 };
 
@@ -574,7 +574,7 @@ struct PyXmlElementComparator
     {
         pybind11::gil_scoped_acquire gil;
 
-        if (pybind11::function override_ = pybind11::get_override (static_cast<PyXmlElementComparator*> (this), "compareElements"); override_)
+        if (auto override_ = Helpers::getCachedOverride (static_cast<PyXmlElementComparator*> (this), "compareElements"); override_)
         {
             auto result = override_ (first, second);
 
@@ -616,7 +616,7 @@ struct PyHighResolutionTimer : public juce::HighResolutionTimer
 {
     void hiResTimerCallback() override
     {
-        PYBIND11_OVERRIDE_PURE(void, juce::HighResolutionTimer, hiResTimerCallback);
+        POPSICLE_OVERRIDE_PURE(void, juce::HighResolutionTimer, hiResTimerCallback);
     }
 };
 
@@ -633,7 +633,7 @@ struct PyThread : Base
         try
         {
 #endif
-            PYBIND11_OVERRIDE_PURE (void, Base, run);
+            POPSICLE_OVERRIDE_PURE (void, Base, run);
 
 #if JUCE_PYTHON_THREAD_CATCH_EXCEPTION
         }
@@ -667,7 +667,7 @@ struct PyThreadListener : juce::Thread::Listener
 
     void exitSignalSent() override
     {
-        PYBIND11_OVERRIDE_PURE (void, juce::Thread::Listener, exitSignalSent);
+        POPSICLE_OVERRIDE_PURE (void, juce::Thread::Listener, exitSignalSent);
     }
 };
 
@@ -679,7 +679,7 @@ struct PyThreadPoolJob : juce::ThreadPoolJob
 
     JobStatus runJob() override
     {
-        PYBIND11_OVERRIDE_PURE (JobStatus, juce::ThreadPoolJob, runJob);
+        POPSICLE_OVERRIDE_PURE (JobStatus, juce::ThreadPoolJob, runJob);
     }
 };
 
@@ -691,7 +691,7 @@ struct PyThreadPoolJobSelector : juce::ThreadPool::JobSelector
 
     bool isJobSuitable (juce::ThreadPoolJob* job) override
     {
-        PYBIND11_OVERRIDE_PURE (bool, juce::ThreadPool::JobSelector, isJobSuitable, job);
+        POPSICLE_OVERRIDE_PURE (bool, juce::ThreadPool::JobSelector, isJobSuitable, job);
     }
 };
 
@@ -703,7 +703,7 @@ struct PyTimeSliceClient : juce::TimeSliceClient
 
     int useTimeSlice() override
     {
-        PYBIND11_OVERRIDE_PURE (int, juce::TimeSliceClient, useTimeSlice);
+        POPSICLE_OVERRIDE_PURE (int, juce::TimeSliceClient, useTimeSlice);
     }
 };
 
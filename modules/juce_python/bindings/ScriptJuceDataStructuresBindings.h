@@ -42,22 +42,22 @@ struct PyUndoableAction : public juce::UndoableAction
 
     bool perform() override
     {
-        PYBIND11_OVERRIDE_PURE (bool, juce::UndoableAction, perform);
+        POPSICLE_OVERRIDE_PURE (bool, juce::UndoableAction, perform);
     }
 
     bool undo() override
     {
-        PYBIND11_OVERRIDE_PURE (bool, juce::UndoableAction, undo);
+        POPSICLE_OVERRIDE_PURE (bool, juce::UndoableAction, undo);
     }
 
     int getSizeInUnits() override
     {
-        PYBIND11_OVERRIDE (int, juce::UndoableAction, getSizeInUnits);
+        POPSICLE_OVERRIDE (int, juce::UndoableAction, getSizeInUnits);
     }
 
     juce::UndoableAction* createCoalescedAction (juce::UndoableAction* nextAction) override
     {
-        PYBIND11_OVERRIDE (juce::UndoableAction*, juce::UndoableAction, createCoalescedAction, nextAction);
+        POPSICLE_OVERRIDE (juce::UndoableAction*, juce::UndoableAction, createCoalescedAction, nextAction);
     }
 
     bool isOwnershipTaken() const noexcept
@@ -82,12 +82,12 @@ struct PyValueValueSource : public juce::Value::ValueSource
 
     juce::var getValue () const override
     {
-        PYBIND11_OVERRIDE_PURE (juce::var, juce::Value::ValueSource, getValue);
+        POPSICLE_OVERRIDE_PURE (juce::var, juce::Value::ValueSource, getValue);
     }
 
     void setValue (const juce::var& newValue) override
     {
-        PYBIND11_OVERRIDE_PURE (void, juce::Value::ValueSource, setValue, newValue);
+        POPSICLE_OVERRIDE_PURE (void, juce::Value::ValueSource, setValue, newValue);
     }
 };
 
@@ -99,7 +99,7 @@ struct PyValueListener : public juce::Value::Listener
 
     void valueChanged (juce::Value& value) override
     {
-        PYBIND11_OVERRIDE_PURE (void, juce::Value::Listener, valueChanged, value);
+        POPSICLE_OVERRIDE_PURE (void, juce::Value::Listener, valueChanged, value);
     }
 };
 
@@ -111,32 +111,32 @@ struct PyValueTreeListener : public juce::ValueTree::Listener
 
     void valueTreePropertyChanged (juce::ValueTree& treeWhosePropertyHasChanged, const juce::Identifier& property) override
     {
-        PYBIND11_OVERRIDE (void, juce::ValueTree::Listener, valueTreePropertyChanged, treeWhosePropertyHasChanged, property);
+        POPSICLE_OVERRIDE (void, juce::ValueTree::Listener, valueTreePropertyChanged, treeWhosePropertyHasChanged, property);
     }
 
     void valueTreeChildAdded (juce::ValueTree& parentTree, juce::ValueTree& childWhichHasBeenAdded) override
     {
-        PYBIND11_OVERRIDE (void, juce::ValueTree::Listener, valueTreeChildAdded, parentTree, childWhichHasBeenAdded);
+        POPSICLE_OVERRIDE (void, juce::ValueTree::Listener, valueTreeChildAdded, parentTree, childWhichHasBeenAdded);
     }
 
     void valueTreeChildRemoved (juce::ValueTree& parentTree, juce::ValueTree& childWhichHasBeenRemoved, int indexFromWhichChildWasRemoved) override
     {
-        PYBIND11_OVERRIDE (void, juce::ValueTree::Listener, valueTreeChildRemoved, parentTree, childWhichHasBeenRemoved, indexFromWhichChildWasRemoved);
+        POPSICLE_OVERRIDE (void, juce::ValueTree::Listener, valueTreeChildRemoved, parentTree, childWhichHasBeenRemoved, indexFromWhichChildWasRemoved);
     }
 
     void valueTreeChildOrderChanged (juce::ValueTree& parentTreeWhoseChildrenHaveMoved, int oldIndex, int newIndex) override
     {
-        PYBIND11_OVERRIDE (void, juce::ValueTree::Listener, valueTreeChildOrderChanged, parentTreeWhoseChildrenHaveMoved, oldIndex, newIndex);
+        POPSICLE_OVERRIDE (void, juce::ValueTree::Listener, valueTreeChildOrderChanged, parentTreeWhoseChildrenHaveMoved, oldIndex, newIndex);
     }
 
     void valueTreeParentChanged (juce::ValueTree& treeWhoseParentHasChanged) override
     {
-        PYBIND11_OVERRIDE (void, juce::ValueTree::Listener, valueTreeParentChanged, treeWhoseParentHasChanged);
+        POPSICLE_OVERRIDE (void, juce::ValueTree::Listener, valueTreeParentChanged, treeWhoseParentHasChanged);
     }
 
     void valueTreeRedirected (juce::ValueTree& treeWhichHasBeenChanged) override
     {
-        PYBIND11_OVERRIDE (void, juce::ValueTree::Listener, valueTreeRedirected, treeWhichHasBeenChanged);
+        POPSICLE_OVERRIDE (void, juce::ValueTree::Listener, valueTreeRedirected, treeWhichHasBeenChanged);
     }
 };
 
@@ -150,7 +150,7 @@ struct PyValueTreeComparator
     {
         pybind11::gil_scoped_acquire gil;
 
-        if (pybind11::function override_ = pybind11::get_override (static_cast<PyValueTreeComparator*> (this), "compareElements"); override_)
+        if (auto override_ = Helpers::getCachedOverride (static_cast<PyValueTreeComparator*> (this), "compareElements"); override_)
         {
             auto result = override_ (first, second);
 
@@ -171,7 +171,7 @@ struct PyValueTreeSynchroniser : public juce::ValueTreeSynchroniser
     {
         pybind11::gil_scoped_acquire gil;
 
-        if (pybind11::function override_ = pybind11::get_override (static_cast<juce::ValueTreeSynchroniser*> (this), "stateChanged"); override_)
+        if (auto override_ = Helpers::getCachedOverride (static_cast<juce::ValueTreeSynchroniser*> (this), "stateChanged"); override_)
         {
             auto change = pybind11::memoryview::from_memory (encodedChange, static_cast<Py_ssize_t> (encodedChangeSize));
 
@@ -40,7 +40,7 @@ struct PyActionListener : public juce::ActionListener
 {
     void actionListenerCallback (const juce::String& message) override
     {
-        PYBIND11_OVERRIDE_PURE (void, juce::ActionListener, actionListenerCallback, message);
+        POPSICLE_OVERRIDE_PURE (void, juce::ActionListener, actionListenerCallback, message);
     }
 };
 
@@ -50,7 +50,7 @@ struct PyAsyncUpdater : public juce::AsyncUpdater
 {
     void handleAsyncUpdate() override
     {
-        PYBIND11_OVERRIDE_PURE (void, juce::AsyncUpdater, handleAsyncUpdate);
+        POPSICLE_OVERRIDE_PURE (void, juce::AsyncUpdater, handleAsyncUpdate);
     }
 };
 
@@ -60,7 +60,7 @@ struct PyChangeListener : public juce::ChangeListener
 {
     void changeListenerCallback (juce::ChangeBroadcaster* source) override
     {
-        PYBIND11_OVERRIDE_PURE (void, juce::ChangeListener, changeListenerCallback, source);
+        POPSICLE_OVERRIDE_PURE (void, juce::ChangeListener, changeListenerCallback, source);
     }
 };
 
@@ -73,7 +73,7 @@ struct PyMessageBase : public Base
 
     void messageCallback() override
     {
-        PYBIND11_OVERRIDE_PURE (void, Base, messageCallback);
+        POPSICLE_OVERRIDE_PURE (void, Base, messageCallback);
     }
 };
 
@@ -86,7 +86,7 @@ struct PyCallbackMessage : public PyMessageBase<Base>
 
     void messageCallback() override
     {
-        PYBIND11_OVERRIDE_PURE (void, Base, messageCallback);
+        POPSICLE_OVERRIDE_PURE (void, Base, messageCallback);
     }
 };
 
@@ -96,7 +96,7 @@ struct PyMessageListener : public juce::MessageListener
 {
     void handleMessage (const juce::Message& message) override
     {
-        PYBIND11_OVERRIDE_PURE (void, juce::MessageListener, handleMessage, message);
+        POPSICLE_OVERRIDE_PURE (void, juce::MessageListener, handleMessage, message);
     }
 };
 
@@ -127,7 +127,7 @@ struct PyTimer : public juce::Timer
 
     void timerCallback() override
     {
-        PYBIND11_OVERRIDE_PURE (void, juce::Timer, timerCallback);
+        POPSICLE_OVERRIDE_PURE (void, juce::Timer, timerCallback);
     }
 };
 
@@ -139,7 +139,7 @@ struct PyMultiTimer : public juce::MultiTimer
 
     void timerCallback (int timerID) override
     {
-        PYBIND11_OVERRIDE_PURE (void, juce::MultiTimer, timerCallback, timerID);
+        POPSICLE_OVERRIDE_PURE (void, juce::MultiTimer, timerCallback, timerID);
     }
 };
 
@@ -42,17 +42,17 @@ struct PyImageType : juce::ImageType
 {
     juce::ImagePixelData::Ptr create (juce::Image::PixelFormat format, int width, int height, bool shouldClearImage) const override
     {
-        PYBIND11_OVERRIDE_PURE (juce::ImagePixelData::Ptr, juce::ImageType, create, format, width, height, shouldClearImage);
+        POPSICLE_OVERRIDE_PURE (juce::ImagePixelData::Ptr, juce::ImageType, create, format, width, height, shouldClearImage);
     }
 
     int getTypeID() const override
     {
-        PYBIND11_OVERRIDE_PURE (int, juce::ImageType, getTypeID);
+        POPSICLE_OVERRIDE_PURE (int, juce::ImageType, getTypeID);
     }
 
     juce::Image convert (const juce::Image& source) const override
     {
-        PYBIND11_OVERRIDE (juce::Image, juce::ImageType, convert, source);
+        POPSICLE_OVERRIDE (juce::Image, juce::ImageType, convert, source);
     }
 };
 
@@ -64,27 +64,27 @@ struct PyImageFileFormat : juce::ImageFileFormat
 
     juce::String getFormatName() override
     {
-        PYBIND11_OVERRIDE_PURE (juce::String, juce::ImageFileFormat, getFormatName);
+        POPSICLE_OVERRIDE_PURE (juce::String, juce::ImageFileFormat, getFormatName);
     }
 
     bool canUnderstand (juce::InputStream& input) override
     {
-        PYBIND11_OVERRIDE_PURE (bool, juce::ImageFileFormat, canUnderstand, input);
+        POPSICLE_OVERRIDE_PURE (bool, juce::ImageFileFormat, canUnderstand, input);
     }
 
     bool usesFileExtension (const juce::File& possibleFile) override
     {
-        PYBIND11_OVERRIDE_PURE (bool, juce::ImageFileFormat, usesFileExtension, possibleFile);
+        POPSICLE_OVERRIDE_PURE (bool, juce::ImageFileFormat, usesFileExtension, possibleFile);
     }
 
     juce::Image decodeImage (juce::InputStream& input) override
     {
-        PYBIND11_OVERRIDE_PURE (juce::Image, juce::ImageFileFormat, decodeImage, input);
+        POPSICLE_OVERRIDE_PURE (juce::Image, juce::ImageFileFormat, decodeImage, input);
     }
 
     bool writeImageToStream (const juce::Image& sourceImage, juce::OutputStream& destStream) override
     {
-        PYBIND11_OVERRIDE_PURE (bool, juce::ImageFileFormat, writeImageToStream, sourceImage, destStream);
+        POPSICLE_OVERRIDE_PURE (bool, juce::ImageFileFormat, writeImageToStream, sourceImage, destStream);
     }
 };
 
@@ -97,152 +97,152 @@ struct PyLowLevelGraphicsContext : Base
 
     bool isVectorDevice() const override
     {
-        PYBIND11_OVERRIDE_PURE (bool, Base, isVectorDevice);
+        POPSICLE_OVERRIDE_PURE (bool, Base, isVectorDevice);
     }
 
     void setOrigin (juce::Point<int> origin) override
     {
-        PYBIND11_OVERRIDE_PURE (void, Base, setOrigin, origin);
+        POPSICLE_OVERRIDE_PURE (void, Base, setOrigin, origin);
     }
 
     void addTransform (const juce::AffineTransform& transform) override
     {
-        PYBIND11_OVERRIDE_PURE (void, Base, addTransform, transform);
+        POPSICLE_OVERRIDE_PURE (void, Base, addTransform, transform);
     }
 
     float getPhysicalPixelScaleFactor() override
     {
-        PYBIND11_OVERRIDE_PURE (float, Base, getPhysicalPixelScaleFactor);
+        POPSICLE_OVERRIDE_PURE (float, Base, getPhysicalPixelScaleFactor);
     }
 
     bool clipToRectangle (const juce::Rectangle<int>& rect) override
     {
-        PYBIND11_OVERRIDE_PURE (bool, Base, clipToRectangle, rect);
+        POPSICLE_OVERRIDE_PURE (bool, Base, clipToRectangle, rect);
     }
 
     bool clipToRectangleList (const juce::RectangleList<int>& rects) override
     {
-        PYBIND11_OVERRIDE_PURE (bool, Base, clipToRectangleList, rects);
+        POPSICLE_OVERRIDE_PURE (bool, Base, clipToRectangleList, rects);
     }
 
     void excludeClipRectangle (const juce::Rectangle<int>& rect) override
     {
-        PYBIND11_OVERRIDE_PURE (void, Base, excludeClipRectangle, rect);
+        POPSICLE_OVERRIDE_PURE (void, Base, excludeClipRectangle, rect);
     }
 
     void clipToPath (const juce::Path& path, const juce::AffineTransform& transform) override
     {
-        PYBIND11_OVERRIDE_PURE (void, Base, clipToPath, path, transform);
+        POPSICLE_OVERRIDE_PURE (void, Base, clipToPath, path, transform);
     }
 
     void clipToImageAlpha (const juce::Image& image, const juce::AffineTransform& transform) override
     {
-        PYBIND11_OVERRIDE_PURE (void, Base, clipToImageAlpha, image, transform);
+        POPSICLE_OVERRIDE_PURE (void, Base, clipToImageAlpha, image, transform);
     }
 
     bool clipRegionIntersects (const juce::Rectangle<int>& rect) override
     {
-        PYBIND11_OVERRIDE_PURE (bool, Base, clipRegionIntersects, rect);
+        POPSICLE_OVERRIDE_PURE (bool, Base, clipRegionIntersects, rect);
     }
 
     juce::Rectangle<int> getClipBounds() const override
     {
-        PYBIND11_OVERRIDE_PURE (juce::Rectangle<int>, Base, getClipBounds);
+        POPSICLE_OVERRIDE_PURE (juce::Rectangle<int>, Base, getClipBounds);
     }
 
     bool isClipEmpty() const override
     {
-        PYBIND11_OVERRIDE_PURE (bool, Base, isClipEmpty);
+        POPSICLE_OVERRIDE_PURE (bool, Base, isClipEmpty);
     }
 
     void saveState() override
     {
-        PYBIND11_OVERRIDE_PURE (void, Base, saveState);
+        POPSICLE_OVERRIDE_PURE (void, Base, saveState);
     }
 
     void restoreState() override
     {
-        PYBIND11_OVERRIDE_PURE (void, Base, restoreState);
+        POPSICLE_OVERRIDE_PURE (void, Base, restoreState);
     }
 
     void beginTransparencyLayer (float opacity) override
     {
-        PYBIND11_OVERRIDE_PURE (void, Base, beginTransparencyLayer, opacity);
+        POPSICLE_OVERRIDE_PURE (void, Base, beginTransparencyLayer, opacity);
     }
 
     void endTransparencyLayer() override
     {
-        PYBIND11_OVERRIDE_PURE (void, Base, endTransparencyLayer);
+        POPSICLE_OVERRIDE_PURE (void, Base, endTransparencyLayer);
     }
 
     void setFill (const juce::FillType& fill) override
     {
-        PYBIND11_OVERRIDE_PURE (void, Base, setFill, fill);
+        POPSICLE_OVERRIDE_PURE (void, Base, setFill, fill);
     }
 
     void setOpacity (float opacity) override
     {
-        PYBIND11_OVERRIDE_PURE (void, Base, setOpacity, opacity);
+        POPSICLE_OVERRIDE_PURE (void, Base, setOpacity, opacity);
     }
 
     void setInterpolationQuality (juce::Graphics::ResamplingQuality quality) override
     {
-        PYBIND11_OVERRIDE_PURE (void, Base, setInterpolationQuality, quality);
+        POPSICLE_OVERRIDE_PURE (void, Base, setInterpolationQuality, quality);
     }
 
     void fillAll() override
     {
-        PYBIND11_OVERRIDE (void, Base, fillAll);
+        POPSICLE_OVERRIDE (void, Base, fillAll);
     }
 
     void fillRect (const juce::Rectangle<int>& rect, bool replaceExistingContents) override
     {
-        PYBIND11_OVERRIDE_PURE (void, Base, fillRect, rect, replaceExistingContents);
+        POPSICLE_OVERRIDE_PURE (void, Base, fillRect, rect, replaceExistingContents);
     }
 
     void fillRect (const juce::Rectangle<float>& rect) override
     {
-        PYBIND11_OVERRIDE_PURE (void, Base, fillRect, rect);
+        POPSICLE_OVERRIDE_PURE (void, Base, fillRect, rect);
     }
 
     void fillRectList (const juce::RectangleList<float>& rects) override
     {
-        PYBIND11_OVERRIDE_PURE (void, Base, fillRectList, rects);
+        POPSICLE_OVERRIDE_PURE (void, Base, fillRectList, rects);
     }
 
     void fillPath (const juce::Path& path, const juce::AffineTransform& transform) override
     {
-        PYBIND11_OVERRIDE_PURE (void, Base, fillPath, path, transform);
+        POPSICLE_OVERRIDE_PURE (void, Base, fillPath, path, transform);
     }
 
     void drawImage (const juce::Image& image, const juce::AffineTransform& transform) override
     {
-        PYBIND11_OVERRIDE_PURE (void, Base, drawImage, image, transform);
+        POPSICLE_OVERRIDE_PURE (void, Base, drawImage, image, transform);
     }
 
     void drawLine (const juce::Line<float>& line) override
     {
-        PYBIND11_OVERRIDE_PURE (void, Base, drawLine, line);
+        POPSICLE_OVERRIDE_PURE (void, Base, drawLine, line);
     }
 
     void setFont (const juce::Font& font) override
     {
-        PYBIND11_OVERRIDE_PURE (void, Base, setFont, font);
+        POPSICLE_OVERRIDE_PURE (void, Base, setFont, font);
     }
 
     const juce::Font& getFont() override
     {
-        PYBIND11_OVERRIDE_PURE (const juce::Font&, Base, getFont);
+        POPSICLE_OVERRIDE_PURE (const juce::Font&, Base, getFont);
     }
 
     void drawGlyph (int glyphNumber, const juce::AffineTransform& transform) override
     {
-        PYBIND11_OVERRIDE_PURE (void, Base, drawGlyph, glyphNumber, transform);
+        POPSICLE_OVERRIDE_PURE (void, Base, drawGlyph, glyphNumber, transform);
     }
 
     bool drawTextLayout (const juce::AttributedString& string, const juce::Rectangle<float>& rect) override
     {
-        PYBIND11_OVERRIDE (bool, Base, drawTextLayout, string, rect);
+        POPSICLE_OVERRIDE (bool, Base, drawTextLayout, string, rect);
     }
 };
 
@@ -78,47 +78,47 @@ struct PyJUCEApplication : juce::JUCEApplication
 {
     const juce::String getApplicationName() override
     {
-        PYBIND11_OVERRIDE_PURE (const juce::String, juce::JUCEApplication, getApplicationName);
+        POPSICLE_OVERRIDE_PURE (const juce::String, juce::JUCEApplication, getApplicationName);
     }
 
     const juce::String getApplicationVersion() override
     {
-        PYBIND11_OVERRIDE_PURE (const juce::String, juce::JUCEApplication, getApplicationVersion);
+        POPSICLE_OVERRIDE_PURE (const juce::String, juce::JUCEApplication, getApplicationVersion);
     }
 
     bool moreThanOneInstanceAllowed() override
     {
-        PYBIND11_OVERRIDE (bool, juce::JUCEApplication, moreThanOneInstanceAllowed);
+        POPSICLE_OVERRIDE (bool, juce::JUCEApplication, moreThanOneInstanceAllowed);
     }
 
     void initialise (const juce::String& commandLineParameters) override
     {
-        PYBIND11_OVERRIDE_PURE (void, juce::JUCEApplication, initialise, commandLineParameters);
+        POPSICLE_OVERRIDE_PURE (void, juce::JUCEApplication, initialise, commandLineParameters);
     }
 
     void shutdown() override
     {
-        PYBIND11_OVERRIDE_PURE (void, juce::JUCEApplication, shutdown);
+        POPSICLE_OVERRIDE_PURE (void, juce::JUCEApplication, shutdown);
     }
 
     void anotherInstanceStarted (const juce::String& commandLine) override
     {
-        PYBIND11_OVERRIDE (void, juce::JUCEApplication, anotherInstanceStarted, commandLine);
+        POPSICLE_OVERRIDE (void, juce::JUCEApplication, anotherInstanceStarted, commandLine);
     }
 
     void systemRequestedQuit() override
     {
-        PYBIND11_OVERRIDE (void, juce::JUCEApplication, systemRequestedQuit);
+        POPSICLE_OVERRIDE (void, juce::JUCEApplication, systemRequestedQuit);
     }
 
     void suspended() override
     {
-        PYBIND11_OVERRIDE (void, juce::JUCEApplication, suspended);
+        POPSICLE_OVERRIDE (void, juce::JUCEApplication, suspended);
     }
 
     void resumed() override
     {
-        PYBIND11_OVERRIDE (void, juce::JUCEApplication, resumed);
+        POPSICLE_OVERRIDE (void, juce::JUCEApplication, resumed);
     }
 
     void unhandledException (const std::exception* ex, const juce::String& sourceFilename, int lineNumber) override
@@ -128,7 +128,7 @@ struct PyJUCEApplication : juce::JUCEApplication
         const auto* pyEx = dynamic_cast<const pybind11::error_already_set*> (ex);
         auto traceback = pybind11::module_::import ("traceback");
 
-        if (pybind11::function override_ = pybind11::get_override (static_cast<juce::JUCEApplication*> (this), "unhandledException"); override_)
+        if (auto override_ = Helpers::getCachedOverride (static_cast<juce::JUCEApplication*> (this), "unhandledException"); override_)
         {
             if (pyEx != nullptr)
             {
@@ -176,12 +176,12 @@ struct PyJUCEApplication : juce::JUCEApplication
 
     void memoryWarningReceived() override
     {
-        PYBIND11_OVERRIDE (void, juce::JUCEApplication, memoryWarningReceived);
+        POPSICLE_OVERRIDE (void, juce::JUCEApplication, memoryWarningReceived);
     }
 
     bool backButtonPressed() override
     {
-        PYBIND11_OVERRIDE (bool, juce::JUCEApplication, backButtonPressed);
+        POPSICLE_OVERRIDE (bool, juce::JUCEApplication, backButtonPressed);
     }
 };
 
@@ -193,12 +193,12 @@ struct PyKeyListener : juce::KeyListener
 
     bool keyPressed (const juce::KeyPress& key, juce::Component* originatingComponent) override
     {
-        PYBIND11_OVERRIDE_PURE (bool, juce::KeyListener, keyPressed, key, originatingComponent);
+        POPSICLE_OVERRIDE_PURE (bool, juce::KeyListener, keyPressed, key, originatingComponent);
     }
 
     bool keyStateChanged (bool isKeyDown, juce::Component* originatingComponent) override
     {
-        PYBIND11_OVERRIDE (bool, KeyListener, keyStateChanged, isKeyDown, originatingComponent);
+        POPSICLE_OVERRIDE (bool, KeyListener, keyStateChanged, isKeyDown, originatingComponent);
     }
 };
 
@@ -211,47 +211,47 @@ struct PyMouseListener : Base
 
     void mouseMove (const juce::MouseEvent& event) override
     {
-        PYBIND11_OVERRIDE (void, Base, mouseMove, event);
+        POPSICLE_OVERRIDE (void, Base, mouseMove, event);
     }
 
     void mouseEnter (const juce::MouseEvent& event) override
     {
-        PYBIND11_OVERRIDE (void, Base, mouseEnter, event);
+        POPSICLE_OVERRIDE (void, Base, mouseEnter, event);
     }
 
     void mouseExit (const juce::MouseEvent& event) override
     {
-        PYBIND11_OVERRIDE (void, Base, mouseExit, event);
+        POPSICLE_OVERRIDE (void, Base, mouseExit, event);
     }
 
     void mouseDown (const juce::MouseEvent& event) override
     {
-        PYBIND11_OVERRIDE (void, Base, mouseDown, event);
+        POPSICLE_OVERRIDE (void, Base, mouseDown, event);
     }
 
     void mouseDrag (const juce::MouseEvent& event) override
     {
-        PYBIND11_OVERRIDE (void, Base, mouseDrag, event);
+        POPSICLE_OVERRIDE (void, Base, mouseDrag, event);
     }
 
     void mouseUp (const juce::MouseEvent& event) override
     {
-        PYBIND11_OVERRIDE (void, Base, mouseUp, event);
+        POPSICLE_OVERRIDE (void, Base, mouseUp, event);
     }
 
     void mouseDoubleClick (const juce::MouseEvent& event) override
     {
-        PYBIND11_OVERRIDE (void, Base, mouseDoubleClick, event);
+        POPSICLE_OVERRIDE (void, Base, mouseDoubleClick, event);
     }
 
     void mouseWheelMove (const juce::MouseEvent& event, const juce::MouseWheelDetails& wheel) override
     {
-        PYBIND11_OVERRIDE (void, Base, mouseWheelMove, event, wheel);
+        POPSICLE_OVERRIDE (void, Base, mouseWheelMove, event, wheel);
     }
 
     void mouseMagnify (const juce::MouseEvent& event, float scaleFactor) override
     {
-        PYBIND11_OVERRIDE (void, Base, mouseMagnify, event, scaleFactor);
+        POPSICLE_OVERRIDE (void, Base, mouseMagnify, event, scaleFactor);
     }
 };
 
@@ -264,62 +264,62 @@ struct PyTextInputTarget : Base
 
     bool isTextInputActive() const override
     {
-        PYBIND11_OVERRIDE_PURE (bool, Base, isTextInputActive);
+        POPSICLE_OVERRIDE_PURE (bool, Base, isTextInputActive);
     }
 
     juce::Range<int> getHighlightedRegion() const override
     {
-        PYBIND11_OVERRIDE_PURE (juce::Range<int>, Base, getHighlightedRegion);
+        POPSICLE_OVERRIDE_PURE (juce::Range<int>, Base, getHighlightedRegion);
     }
 
     void setHighlightedRegion (const juce::Range<int>& newRange) override
     {
-        PYBIND11_OVERRIDE_PURE (void, Base, setHighlightedRegion, newRange);
+        POPSICLE_OVERRIDE_PURE (void, Base, setHighlightedRegion, newRange);
     }
 
     void setTemporaryUnderlining (const juce::Array<juce::Range<int>>& underlinedRegions) override
     {
-        PYBIND11_OVERRIDE_PURE (void, Base, setTemporaryUnderlining, underlinedRegions);
+        POPSICLE_OVERRIDE_PURE (void, Base, setTemporaryUnderlining, underlinedRegions);
     }
 
     juce::String getTextInRange (const juce::Range<int>& range) const override
     {
-        PYBIND11_OVERRIDE_PURE (juce::String, Base, getTextInRange, range);
+        POPSICLE_OVERRIDE_PURE (juce::String, Base, getTextInRange, range);
     }
 
     void insertTextAtCaret (const juce::String& textToInsert) override
     {
-        PYBIND11_OVERRIDE_PURE (void, Base, insertTextAtCaret, textToInsert);
+        POPSICLE_OVERRIDE_PURE (void, Base, insertTextAtCaret, textToInsert);
     }
 
     int getCaretPosition() const override
     {
-        PYBIND11_OVERRIDE_PURE (int, Base, getCaretPosition);
+        POPSICLE_OVERRIDE_PURE (int, Base, getCaretPosition);
     }
 
     juce::Rectangle<int> getCaretRectangleForCharIndex (int characterIndex) const override
     {
-        PYBIND11_OVERRIDE_PURE (juce::Rectangle<int>, Base, getCaretRectangleForCharIndex, characterIndex);
+        POPSICLE_OVERRIDE_PURE (juce::Rectangle<int>, Base, getCaretRectangleForCharIndex, characterIndex);
     }
 
     int getTotalNumChars() const override
     {
-        PYBIND11_OVERRIDE_PURE (int, Base, getTotalNumChars);
+        POPSICLE_OVERRIDE_PURE (int, Base, getTotalNumChars);
     }
 
     int getCharIndexForPoint (juce::Point<int> point) const override
     {
-        PYBIND11_OVERRIDE_PURE (int, Base, getCharIndexForPoint, point);
+        POPSICLE_OVERRIDE_PURE (int, Base, getCharIndexForPoint, point);
     }
 
     juce::RectangleList<int> getTextBounds (juce::Range<int> textRange) const override
     {
-        PYBIND11_OVERRIDE_PURE (juce::Rectangle<int>, Base, getTextBounds, textRange);
+        POPSICLE_OVERRIDE_PURE (juce::Rectangle<int>, Base, getTextBounds, textRange);
     }
 
     juce::TextInputTarget::VirtualKeyboardType getKeyboardType() override
     {
-        PYBIND11_OVERRIDE (juce::TextInputTarget::VirtualKeyboardType, Base, getKeyboardType);
+        POPSICLE_OVERRIDE (juce::TextInputTarget::VirtualKeyboardType, Base, getKeyboardType);
     }
 };
 
@@ -335,7 +335,7 @@ struct PyLookAndFeel : Base
         {
             pybind11::gil_scoped_acquire gil;
 
-            if (pybind11::function override_ = pybind11::get_override (static_cast<Base*> (this), "drawSpinningWaitAnimation"))
+            if (auto override_ = Helpers::getCachedOverride (static_cast<Base*> (this), "drawSpinningWaitAnimation"))
             {
                 override_ (std::addressof (g), colour, x, y, w, h);
                 return;
@@ -347,12 +347,12 @@ struct PyLookAndFeel : Base
 
     juce::Path getTickShape (float height) override
     {
-        PYBIND11_OVERRIDE_PURE (juce::Path, Base, getTickShape, height);
+        POPSICLE_OVERRIDE_PURE (juce::Path, Base, getTickShape, height);
     }
 
     juce::Path getCrossShape (float height) override
     {
-        PYBIND11_OVERRIDE_PURE (juce::Path, Base, getCrossShape, height);
+        POPSICLE_OVERRIDE_PURE (juce::Path, Base, getCrossShape, height);
     }
 
     std::unique_ptr<juce::DropShadower> createDropShadowerForComponent (juce::Component&) override
@@ -367,12 +367,12 @@ struct PyLookAndFeel : Base
 
     juce::MouseCursor getMouseCursorFor (juce::Component& c) override
     {
-        PYBIND11_OVERRIDE (juce::MouseCursor, Base, getMouseCursorFor, c);
+        POPSICLE_OVERRIDE (juce::MouseCursor, Base, getMouseCursorFor, c);
     }
 
     void playAlertSound() override
     {
-        PYBIND11_OVERRIDE (void, Base, playAlertSound);
+        POPSICLE_OVERRIDE (void, Base, playAlertSound);
     }
 };
 
@@ -387,7 +387,7 @@ struct PyLookAndFeel_V2 : PyLookAndFeel<Base>
         {
             pybind11::gil_scoped_acquire gil;
 
-            if (pybind11::function override_ = pybind11::get_override (static_cast<Base*> (this), "drawButtonBackground"))
+            if (auto override_ = Helpers::getCachedOverride (static_cast<Base*> (this), "drawButtonBackground"))
             {
                 override_ (std::addressof (g), std::addressof (b), backgroundColour, shouldDrawButtonAsHighlighted, shouldDrawButtonAsDown);
                 return;
@@ -402,7 +402,7 @@ struct PyLookAndFeel_V2 : PyLookAndFeel<Base>
         {
             pybind11::gil_scoped_acquire gil;
 
-            if (pybind11::function override_ = pybind11::get_override (static_cast<Base*> (this), "getTextButtonFont"))
+            if (auto override_ = Helpers::getCachedOverride (static_cast<Base*> (this), "getTextButtonFont"))
             {
                 return override_ (std::addressof (button), buttonHeight).cast<juce::Font>();
             }
@@ -417,7 +417,7 @@ struct PyLookAndFeel_V2 : PyLookAndFeel<Base>
         {
             pybind11::gil_scoped_acquire gil;
 
-            if (pybind11::function override_ = pybind11::get_override (static_cast<Base*> (this), "drawButtonText"))
+            if (auto override_ = Helpers::getCachedOverride (static_cast<Base*> (this), "drawButtonText"))
             {
                 override_ (std::addressof (g), std::addressof (button), shouldDrawButtonAsHighlighted, shouldDrawButtonAsDown);
                 return;
@@ -432,7 +432,7 @@ struct PyLookAndFeel_V2 : PyLookAndFeel<Base>
         {
             pybind11::gil_scoped_acquire gil;
 
-            if (pybind11::function override_ = pybind11::get_override(static_cast<Base*>(this), "getTextButtonWidthToFitText"))
+            if (auto override_ = Helpers::getCachedOverride (static_cast<Base*>(this), "getTextButtonWidthToFitText"))
             {
                 return override_ (std::addressof(button), buttonHeight).cast<int>();
             }
@@ -447,7 +447,7 @@ struct PyLookAndFeel_V2 : PyLookAndFeel<Base>
         {
             pybind11::gil_scoped_acquire gil;
 
-            if (pybind11::function override_ = pybind11::get_override (static_cast<Base*> (this), "drawToggleButton"))
+            if (auto override_ = Helpers::getCachedOverride (static_cast<Base*> (this), "drawToggleButton"))
             {
                 override_ (std::addressof (g), std::addressof (button), shouldDrawButtonAsHighlighted, shouldDrawButtonAsDown);
                 return;
@@ -462,7 +462,7 @@ struct PyLookAndFeel_V2 : PyLookAndFeel<Base>
         {
             pybind11::gil_scoped_acquire gil;
 
-            if (pybind11::function override_ = pybind11::get_override (static_cast<Base*> (this), "changeToggleButtonWidthToFitText"); override_)
+            if (auto override_ = Helpers::getCachedOverride (static_cast<Base*> (this), "changeToggleButtonWidthToFitText"); override_)
             {
                 override_ (std::addressof (button));
                 return;
@@ -480,7 +480,7 @@ struct PyLookAndFeel_V2 : PyLookAndFeel<Base>
         {
             pybind11::gil_scoped_acquire gil;
 
-            if (pybind11::function override_ = pybind11::get_override (static_cast<Base*> (this), "drawTickBox"); override_)
+            if (auto override_ = Helpers::getCachedOverride (static_cast<Base*> (this), "drawTickBox"); override_)
             {
                 override_ (std::addressof (g), std::addressof (component), x, y, w, h, ticked, isEnabled, shouldDrawButtonAsHighlighted, shouldDrawButtonAsDown);
                 return;
@@ -496,7 +496,7 @@ struct PyLookAndFeel_V2 : PyLookAndFeel<Base>
         {
             pybind11::gil_scoped_acquire gil;
 
-            if (pybind11::function override_ = pybind11::get_override (static_cast<Base*> (this), "drawDrawableButton"); override_)
+            if (auto override_ = Helpers::getCachedOverride (static_cast<Base*> (this), "drawDrawableButton"); override_)
             {
                 override_ (std::addressof (g), std::addressof (button), shouldDrawButtonAsHighlighted, shouldDrawButtonAsDown);
                 return;
@@ -511,7 +511,7 @@ struct PyLookAndFeel_V2 : PyLookAndFeel<Base>
                                           const juce::String& button3, juce::MessageBoxIconType iconType,
                                           int numButtons, juce::Component* associatedComponent) override
     {
-        PYBIND11_OVERRIDE (juce::AlertWindow*, Base, createAlertWindow, title, message, button1, button2, button3, iconType, numButtons, associatedComponent);
+        POPSICLE_OVERRIDE (juce::AlertWindow*, Base, createAlertWindow, title, message, button1, button2, button3, iconType, numButtons, associatedComponent);
     }
 
     void drawAlertBox (juce::Graphics& g, juce::AlertWindow& alertWindow, const juce::Rectangle<int>& textArea, juce::TextLayout& textLayout) override
@@ -519,7 +519,7 @@ struct PyLookAndFeel_V2 : PyLookAndFeel<Base>
         {
             pybind11::gil_scoped_acquire gil;
 
-            if (pybind11::function override_ = pybind11::get_override (static_cast<Base*> (this), "drawAlertBox"); override_)
+            if (auto override_ = Helpers::getCachedOverride (static_cast<Base*> (this), "drawAlertBox"); override_)
             {
                 override_ (std::addressof (g), std::addressof (alertWindow), textArea, std::addressof (textLayout));
                 return;
@@ -531,7 +531,7 @@ struct PyLookAndFeel_V2 : PyLookAndFeel<Base>
 
     int getAlertBoxWindowFlags() override
     {
-        PYBIND11_OVERRIDE (int, Base, getAlertBoxWindowFlags);
+        POPSICLE_OVERRIDE (int, Base, getAlertBoxWindowFlags);
     }
 
     juce::Array<int> getWidthsForTextButtons (juce::AlertWindow& alertWindow, const juce::Array<juce::TextButton*>& buttons) override
@@ -539,7 +539,7 @@ struct PyLookAndFeel_V2 : PyLookAndFeel<Base>
         {
             pybind11::gil_scoped_acquire gil;
 
-            if (pybind11::function override_ = pybind11::get_override (static_cast<Base*> (this), "getWidthsForTextButtons"); override_)
+            if (auto override_ = Helpers::getCachedOverride (static_cast<Base*> (this), "getWidthsForTextButtons"); override_)
             {
                 pybind11::list list (buttons.size());
                 for (int i = 0; i < buttons.size(); ++i)
@@ -554,22 +554,22 @@ struct PyLookAndFeel_V2 : PyLookAndFeel<Base>
 
     int getAlertWindowButtonHeight() override
     {
-        PYBIND11_OVERRIDE (int, Base, getAlertWindowButtonHeight);
+        POPSICLE_OVERRIDE (int, Base, getAlertWindowButtonHeight);
     }
 
     juce::Font getAlertWindowTitleFont() override
     {
-        PYBIND11_OVERRIDE (juce::Font, Base, getAlertWindowTitleFont);
+        POPSICLE_OVERRIDE (juce::Font, Base, getAlertWindowTitleFont);
     }
 
     juce::Font getAlertWindowMessageFont() override
     {
-        PYBIND11_OVERRIDE (juce::Font, Base, getAlertWindowMessageFont);
+        POPSICLE_OVERRIDE (juce::Font, Base, getAlertWindowMessageFont);
     }
 
     juce::Font getAlertWindowFont() override
     {
-        PYBIND11_OVERRIDE (juce::Font, Base, getAlertWindowFont);
+        POPSICLE_OVERRIDE (juce::Font, Base, getAlertWindowFont);
     }
 };
 
@@ -582,22 +582,22 @@ struct PyComponentTraverser : Base
 
     juce::Component* getDefaultComponent (juce::Component* parentComponent) override
     {
-        PYBIND11_OVERRIDE_PURE (juce::Component*, Base, getDefaultComponent, parentComponent);
+        POPSICLE_OVERRIDE_PURE (juce::Component*, Base, getDefaultComponent, parentComponent);
     }
 
     juce::Component* getNextComponent (juce::Component* current) override
     {
-        PYBIND11_OVERRIDE_PURE (juce::Component*, Base, getNextComponent, current);
+        POPSICLE_OVERRIDE_PURE (juce::Component*, Base, getNextComponent, current);
     }
 
     juce::Component* getPreviousComponent (juce::Component* current) override
     {
-        PYBIND11_OVERRIDE_PURE (juce::Component*, Base, getPreviousComponent, current);
+        POPSICLE_OVERRIDE_PURE (juce::Component*, Base, getPreviousComponent, current);
     }
 
     std::vector<juce::Component*> getAllComponents (juce::Component* parentComponent) override
     {
-        PYBIND11_OVERRIDE_PURE (std::vector<juce::Component*>, Base, getAllComponents, parentComponent);
+        POPSICLE_OVERRIDE_PURE (std::vector<juce::Component*>, Base, getAllComponents, parentComponent);
     }
 };
 
@@ -615,42 +615,42 @@ struct PyComponentListener : juce::ComponentListener
 
     void componentMovedOrResized (juce::Component& component, bool wasMoved, bool wasResized) override
     {
-        PYBIND11_OVERRIDE (void, juce::ComponentListener, componentMovedOrResized, component, wasMoved, wasResized);
+        POPSICLE_OVERRIDE (void, juce::ComponentListener, componentMovedOrResized, component, wasMoved, wasResized);
     }
 
     void componentBroughtToFront (juce::Component& component) override
     {
-        PYBIND11_OVERRIDE (void, juce::ComponentListener, componentBroughtToFront, component);
+        POPSICLE_OVERRIDE (void, juce::ComponentListener, componentBroughtToFront, component);
     }
 
     void componentVisibilityChanged (juce::Component& component) override
     {
-        PYBIND11_OVERRIDE (void, juce::ComponentListener, componentVisibilityChanged, component);
+        POPSICLE_OVERRIDE (void, juce::ComponentListener, componentVisibilityChanged, component);
     }
 
     void componentChildrenChanged (juce::Component& component) override
     {
-        PYBIND11_OVERRIDE (void, juce::ComponentListener, componentChildrenChanged, component);
+        POPSICLE_OVERRIDE (void, juce::ComponentListener, componentChildrenChanged, component);
     }
 
     void componentParentHierarchyChanged (juce::Component& component) override
     {
-        PYBIND11_OVERRIDE (void, juce::ComponentListener, componentParentHierarchyChanged, component);
+        POPSICLE_OVERRIDE (void, juce::ComponentListener, componentParentHierarchyChanged, component);
     }
 
     void componentNameChanged (juce::Component& component) override
     {
-        PYBIND11_OVERRIDE (void, juce::ComponentListener, componentNameChanged, component);
+        POPSICLE_OVERRIDE (void, juce::ComponentListener, componentNameChanged, component);
     }
 
     void componentBeingDeleted (juce::Component& component) override
     {
-        PYBIND11_OVERRIDE (void, juce::ComponentListener, componentBeingDeleted, component);
+        POPSICLE_OVERRIDE (void, juce::ComponentListener, componentBeingDeleted, component);
     }
 
     void componentEnablementChanged (juce::Component& component) override
     {
-        PYBIND11_OVERRIDE (void, juce::ComponentListener, componentEnablementChanged, component);
+        POPSICLE_OVERRIDE (void, juce::ComponentListener, componentEnablementChanged, component);
     }
 };
 
@@ -662,7 +662,7 @@ struct PyModalComponentManagerCallback : juce::ModalComponentManager::Callback
 
     void modalStateFinished (int returnValue) override
     {
-        PYBIND11_OVERRIDE_PURE (void, juce::ModalComponentManager::Callback, modalStateFinished, returnValue);
+        POPSICLE_OVERRIDE_PURE (void, juce::ModalComponentManager::Callback, modalStateFinished, returnValue);
     }
 };
 
@@ -692,62 +692,62 @@ struct PyComponent : PyMouseListener<Base>
 
     void setName (const juce::String& newName) override
     {
-        PYBIND11_OVERRIDE (void, Base, setName, newName);
+        POPSICLE_OVERRIDE (void, Base, setName, newName);
     }
 
     void setVisible (bool shouldBeVisible) override
     {
-        PYBIND11_OVERRIDE (void, Base, setVisible, shouldBeVisible);
+        POPSICLE_OVERRIDE (void, Base, setVisible, shouldBeVisible);
     }
 
     void visibilityChanged() override
     {
-        PYBIND11_OVERRIDE (void, Base, visibilityChanged);
+        POPSICLE_OVERRIDE (void, Base, visibilityChanged);
     }
 
     void userTriedToCloseWindow() override
     {
-        PYBIND11_OVERRIDE (void, Base, userTriedToCloseWindow);
+        POPSICLE_OVERRIDE (void, Base, userTriedToCloseWindow);
     }
 
     void minimisationStateChanged(bool isNowMinimised) override
     {
-        PYBIND11_OVERRIDE (void, Base, minimisationStateChanged, isNowMinimised);
+        POPSICLE_OVERRIDE (void, Base, minimisationStateChanged, isNowMinimised);
     }
 
     float getDesktopScaleFactor() const override
     {
-        PYBIND11_OVERRIDE (float, Base, getDesktopScaleFactor);
+        POPSICLE_OVERRIDE (float, Base, getDesktopScaleFactor);
     }
 
     void parentHierarchyChanged() override
     {
-        PYBIND11_OVERRIDE (void, Base, parentHierarchyChanged);
+        POPSICLE_OVERRIDE (void, Base, parentHierarchyChanged);
     }
 
     void childrenChanged() override
     {
-        PYBIND11_OVERRIDE (void, Base, childrenChanged);
+        POPSICLE_OVERRIDE (void, Base, childrenChanged);
     }
 
     bool hitTest (int x, int y) override
     {
-        PYBIND11_OVERRIDE (bool, Base, hitTest, x, y);
+        POPSICLE_OVERRIDE (bool, Base, hitTest, x, y);
     }
 
     void lookAndFeelChanged() override
     {
-        PYBIND11_OVERRIDE (void, Base, lookAndFeelChanged);
+        POPSICLE_OVERRIDE (void, Base, lookAndFeelChanged);
     }
 
     void enablementChanged() override
     {
-        PYBIND11_OVERRIDE (void, Base, enablementChanged);
+        POPSICLE_OVERRIDE (void, Base, enablementChanged);
     }
 
     void alphaChanged() override
     {
-        PYBIND11_OVERRIDE (void, Base, alphaChanged);
+        POPSICLE_OVERRIDE (void, Base, alphaChanged);
     }
 
     void paint (juce::Graphics& g) override
@@ -755,7 +755,7 @@ struct PyComponent : PyMouseListener<Base>
         {
             pybind11::gil_scoped_acquire gil;
 
-            if (pybind11::function override_ = pybind11::get_override (static_cast<const Base*> (this), "paint"); override_)
+            if (auto override_ = Helpers::getCachedOverride (static_cast<const Base*> (this), "paint"); override_)
             {
                 override_ (std::addressof (g));
                 return;
@@ -770,7 +770,7 @@ struct PyComponent : PyMouseListener<Base>
         {
             pybind11::gil_scoped_acquire gil;
 
-            if (pybind11::function override_ = pybind11::get_override (static_cast<const Base*> (this), "paintOverChildren"); override_)
+            if (auto override_ = Helpers::getCachedOverride (static_cast<const Base*> (this), "paintOverChildren"); override_)
             {
                 override_ (std::addressof (g));
                 return;
@@ -782,62 +782,62 @@ struct PyComponent : PyMouseListener<Base>
 
     bool keyPressed (const juce::KeyPress& key) override
     {
-        PYBIND11_OVERRIDE (bool, Base, keyPressed, key);
+        POPSICLE_OVERRIDE (bool, Base, keyPressed, key);
     }
 
     bool keyStateChanged (bool isDown) override
     {
-        PYBIND11_OVERRIDE (bool, Base, keyStateChanged, isDown);
+        POPSICLE_OVERRIDE (bool, Base, keyStateChanged, isDown);
     }
 
     void modifierKeysChanged (const juce::ModifierKeys& modifiers) override
     {
-        PYBIND11_OVERRIDE (void, Base, modifierKeysChanged, modifiers);
+        POPSICLE_OVERRIDE (void, Base, modifierKeysChanged, modifiers);
     }
 
     void focusGained (juce::Component::FocusChangeType cause) override
     {
-        PYBIND11_OVERRIDE (void, Base, focusGained, cause);
+        POPSICLE_OVERRIDE (void, Base, focusGained, cause);
     }
 
     void focusGainedWithDirection (juce::Component::FocusChangeType cause, juce::Component::FocusChangeDirection direction) override
     {
-        PYBIND11_OVERRIDE (void, Base, focusGainedWithDirection, cause, direction);
+        POPSICLE_OVERRIDE (void, Base, focusGainedWithDirection, cause, direction);
     }
 
     void focusLost (juce::Component::FocusChangeType cause) override
     {
-        PYBIND11_OVERRIDE (void, Base, focusLost, cause);
+        POPSICLE_OVERRIDE (void, Base, focusLost, cause);
     }
 
     void focusOfChildComponentChanged (juce::Component::FocusChangeType cause) override
     {
-        PYBIND11_OVERRIDE (void, Base, focusOfChildComponentChanged, cause);
+        POPSICLE_OVERRIDE (void, Base, focusOfChildComponentChanged, cause);
     }
 
     void resized () override
     {
-        PYBIND11_OVERRIDE (void, Base, resized);
+        POPSICLE_OVERRIDE (void, Base, resized);
     }
 
     void moved () override
     {
-        PYBIND11_OVERRIDE (void, Base, moved);
+        POPSICLE_OVERRIDE (void, Base, moved);
     }
 
     void childBoundsChanged (juce::Component* child) override
     {
-        PYBIND11_OVERRIDE (void, Base, childBoundsChanged, child);
+        POPSICLE_OVERRIDE (void, Base, childBoundsChanged, child);
     }
 
     void parentSizeChanged () override
     {
-        PYBIND11_OVERRIDE (void, Base, parentSizeChanged);
+        POPSICLE_OVERRIDE (void, Base, parentSizeChanged);
     }
 
     void broughtToFront () override
     {
-        PYBIND11_OVERRIDE (void, Base, broughtToFront);
+        POPSICLE_OVERRIDE (void, Base, broughtToFront);
     }
 
     void handleCommandMessage (int commandId) override
@@ -845,7 +845,7 @@ struct PyComponent : PyMouseListener<Base>
         {
             pybind11::gil_scoped_acquire gil;
 
-            if (pybind11::function override_ = pybind11::get_override (static_cast<Base*> (this), "handleCommandMessage"); override_)
+            if (auto override_ = Helpers::getCachedOverride (static_cast<Base*> (this), "handleCommandMessage"); override_)
             {
                 override_ (commandId);
                 return;
@@ -858,17 +858,17 @@ struct PyComponent : PyMouseListener<Base>
 
     bool canModalEventBeSentToComponent (const juce::Component* targetComponent) override
     {
-        PYBIND11_OVERRIDE (bool, Base, canModalEventBeSentToComponent, targetComponent);
+        POPSICLE_OVERRIDE (bool, Base, canModalEventBeSentToComponent, targetComponent);
     }
 
     void inputAttemptWhenModal () override
     {
-        PYBIND11_OVERRIDE (void, Base, inputAttemptWhenModal);
+        POPSICLE_OVERRIDE (void, Base, inputAttemptWhenModal);
     }
 
     void colourChanged () override
     {
-        PYBIND11_OVERRIDE (void, Base, colourChanged);
+        POPSICLE_OVERRIDE (void, Base, colourChanged);
     }
 };
 
@@ -885,7 +885,7 @@ struct PyDrawable : PyComponent<Base>
         {
             pybind11::gil_scoped_acquire gil;
 
-            if (pybind11::function override_ = pybind11::get_override (static_cast<const Base*> (this), "createCopy"); override_)
+            if (auto override_ = Helpers::getCachedOverride (static_cast<const Base*> (this), "createCopy"); override_)
             {
                 pybind11::object result = override_();
 
@@ -901,17 +901,17 @@ struct PyDrawable : PyComponent<Base>
 
     juce::Path getOutlineAsPath() const override
     {
-        PYBIND11_OVERRIDE_PURE (juce::Path, Base, getOutlineAsPath);
+        POPSICLE_OVERRIDE_PURE (juce::Path, Base, getOutlineAsPath);
     }
 
     juce::Rectangle<float> getDrawableBounds() const override
     {
-        PYBIND11_OVERRIDE_PURE (juce::Rectangle<float>, Base, getDrawableBounds);
+        POPSICLE_OVERRIDE_PURE (juce::Rectangle<float>, Base, getDrawableBounds);
     }
 
     bool replaceColour (juce::Colour originalColour, juce::Colour replacementColour) override
     {
-        PYBIND11_OVERRIDE (bool, Base, replaceColour, originalColour, replacementColour);
+        POPSICLE_OVERRIDE (bool, Base, replaceColour, originalColour, replacementColour);
     }
 };
 
@@ -924,12 +924,12 @@ struct PyDrawableComposite : PyDrawable<Base>
 
     juce::Path getOutlineAsPath() const override
     {
-        PYBIND11_OVERRIDE (juce::Path, Base, getOutlineAsPath);
+        POPSICLE_OVERRIDE (juce::Path, Base, getOutlineAsPath);
     }
 
     juce::Rectangle<float> getDrawableBounds() const override
     {
-        PYBIND11_OVERRIDE (juce::Rectangle<float>, Base, getDrawableBounds);
+        POPSICLE_OVERRIDE (juce::Rectangle<float>, Base, getDrawableBounds);
     }
 };
 
@@ -942,12 +942,12 @@ struct PyDrawableImage : PyDrawable<Base>
 
     juce::Path getOutlineAsPath() const override
     {
-        PYBIND11_OVERRIDE (juce::Path, Base, getOutlineAsPath);
+        POPSICLE_OVERRIDE (juce::Path, Base, getOutlineAsPath);
     }
 
     juce::Rectangle<float> getDrawableBounds() const override
     {
-        PYBIND11_OVERRIDE (juce::Rectangle<float>, Base, getDrawableBounds);
+        POPSICLE_OVERRIDE (juce::Rectangle<float>, Base, getDrawableBounds);
     }
 };
 
@@ -968,17 +968,17 @@ struct PyDrawableShape : PyDrawable<Base>
 
     juce::Path getOutlineAsPath() const override
     {
-        PYBIND11_OVERRIDE (juce::Path, Base, getOutlineAsPath);
+        POPSICLE_OVERRIDE (juce::Path, Base, getOutlineAsPath);
     }
 
     juce::Rectangle<float> getDrawableBounds() const override
     {
-        PYBIND11_OVERRIDE (juce::Rectangle<float>, Base, getDrawableBounds);
+        POPSICLE_OVERRIDE (juce::Rectangle<float>, Base, getDrawableBounds);
     }
 
     bool replaceColour (juce::Colour originalColour, juce::Colour replacementColour) override
     {
-        PYBIND11_OVERRIDE (bool, Base, replaceColour, originalColour, replacementColour);
+        POPSICLE_OVERRIDE (bool, Base, replaceColour, originalColour, replacementColour);
     }
 };
 
@@ -991,17 +991,17 @@ struct PyDrawableText : PyDrawable<Base>
 
     juce::Path getOutlineAsPath() const override
     {
-        PYBIND11_OVERRIDE (juce::Path, Base, getOutlineAsPath);
+        POPSICLE_OVERRIDE (juce::Path, Base, getOutlineAsPath);
     }
 
     juce::Rectangle<float> getDrawableBounds() const override
     {
-        PYBIND11_OVERRIDE (juce::Rectangle<float>, Base, getDrawableBounds);
+        POPSICLE_OVERRIDE (juce::Rectangle<float>, Base, getDrawableBounds);
     }
 
     bool replaceColour (juce::Colour originalColour, juce::Colour replacementColour) override
     {
-        PYBIND11_OVERRIDE (bool, Base, replaceColour, originalColour, replacementColour);
+        POPSICLE_OVERRIDE (bool, Base, replaceColour, originalColour, replacementColour);
     }
 };
 
@@ -1019,12 +1019,12 @@ struct PyButton : PyComponent<Base>
 
     void triggerClick() override
     {
-        PYBIND11_OVERRIDE (void, Base, triggerClick);
+        POPSICLE_OVERRIDE (void, Base, triggerClick);
     }
 
     void clicked() override
     {
-        PYBIND11_OVERRIDE (void, Base, clicked);
+        POPSICLE_OVERRIDE (void, Base, clicked);
     }
 
     void clicked (const juce::ModifierKeys& modifiers) override
@@ -1032,7 +1032,7 @@ struct PyButton : PyComponent<Base>
         {
             pybind11::gil_scoped_acquire gil;
 
-            if (pybind11::function override_ = pybind11::get_override (static_cast<Base*> (this), "clickedWithModifiers"); override_)
+            if (auto override_ = Helpers::getCachedOverride (static_cast<Base*> (this), "clickedWithModifiers"); override_)
             {
                 override_ (modifiers);
                 return;
@@ -1048,7 +1048,7 @@ struct PyButton : PyComponent<Base>
         {
             pybind11::gil_scoped_acquire gil;
 
-            if (pybind11::function override_ = pybind11::get_override (static_cast<Base*> (this), "paintButton"); override_)
+            if (auto override_ = Helpers::getCachedOverride (static_cast<Base*> (this), "paintButton"); override_)
             {
                 override_ (std::addressof (g), shouldDrawButtonAsHighlighted, shouldDrawButtonAsDown);
                 return;
@@ -1060,7 +1060,7 @@ struct PyButton : PyComponent<Base>
 
     void buttonStateChanged() override
     {
-        PYBIND11_OVERRIDE (void, Base, buttonStateChanged);
+        POPSICLE_OVERRIDE (void, Base, buttonStateChanged);
     }
 };
 
@@ -1070,12 +1070,12 @@ struct PyButtonListener : juce::Button::Listener
 
     void buttonClicked (juce::Button* button) override
     {
-        PYBIND11_OVERRIDE_PURE (void, juce::Button::Listener, buttonClicked, button);
+        POPSICLE_OVERRIDE_PURE (void, juce::Button::Listener, buttonClicked, button);
     }
 
     void buttonStateChanged (juce::Button* button) override
     {
-        PYBIND11_OVERRIDE (void, juce::Button::Listener, buttonStateChanged, button);
+        POPSICLE_OVERRIDE (void, juce::Button::Listener, buttonStateChanged, button);
     }
 };
 
@@ -1086,7 +1086,7 @@ struct PyDrawableButton : PyButton<Base>
 
     juce::Rectangle<float> getImageBounds() const override
     {
-        PYBIND11_OVERRIDE (juce::Rectangle<float>, Base, getImageBounds);
+        POPSICLE_OVERRIDE (juce::Rectangle<float>, Base, getImageBounds);
     }
 };
 
@@ -1099,27 +1099,27 @@ struct PyLabel : PyComponent<Base>
 
     juce::TextEditor* createEditorComponent() override
     {
-        PYBIND11_OVERRIDE (juce::TextEditor*, Base, createEditorComponent);
+        POPSICLE_OVERRIDE (juce::TextEditor*, Base, createEditorComponent);
     }
 
     void textWasEdited() override
     {
-        PYBIND11_OVERRIDE (void, Base, textWasEdited);
+        POPSICLE_OVERRIDE (void, Base, textWasEdited);
     }
 
     void textWasChanged() override
     {
-        PYBIND11_OVERRIDE (void, Base, textWasChanged);
+        POPSICLE_OVERRIDE (void, Base, textWasChanged);
     }
 
     void editorShown (juce::TextEditor* e) override
     {
-        PYBIND11_OVERRIDE (void, Base, editorShown, e);
+        POPSICLE_OVERRIDE (void, Base, editorShown, e);
     }
 
     void editorAboutToBeHidden (juce::TextEditor* e) override
     {
-        PYBIND11_OVERRIDE (void, Base, editorAboutToBeHidden, e);
+        POPSICLE_OVERRIDE (void, Base, editorAboutToBeHidden, e);
     }
 };
 
@@ -1129,17 +1129,17 @@ struct PyLabelListener : juce::Label::Listener
 
     void labelTextChanged (juce::Label* labelThatHasChanged) override
     {
-        PYBIND11_OVERRIDE_PURE (void, juce::Label::Listener, labelTextChanged, labelThatHasChanged);
+        POPSICLE_OVERRIDE_PURE (void, juce::Label::Listener, labelTextChanged, labelThatHasChanged);
     }
 
     void editorShown (juce::Label* label, juce::TextEditor& e) override
     {
-        PYBIND11_OVERRIDE (void, juce::Label::Listener, editorShown, label, e);
+        POPSICLE_OVERRIDE (void, juce::Label::Listener, editorShown, label, e);
     }
 
     void editorHidden (juce::Label* label, juce::TextEditor& e) override
     {
-        PYBIND11_OVERRIDE (void, juce::Label::Listener, editorHidden, label, e);
+        POPSICLE_OVERRIDE (void, juce::Label::Listener, editorHidden, label, e);
     }
 };
 
@@ -1153,12 +1153,12 @@ struct PyTextEditor : /*PyTextInputTarget<Base>,*/ PyComponent<Base>
 
     void addPopupMenuItems (juce::PopupMenu& menuToAddTo, const juce::MouseEvent* mouseClickEvent) override
     {
-        PYBIND11_OVERRIDE (void, Base, addPopupMenuItems, menuToAddTo, mouseClickEvent);
+        POPSICLE_OVERRIDE (void, Base, addPopupMenuItems, menuToAddTo, mouseClickEvent);
     }
 
     void performPopupMenuAction (int menuItemID) override
     {
-        PYBIND11_OVERRIDE (void, Base, performPopupMenuAction, menuItemID);
+        POPSICLE_OVERRIDE (void, Base, performPopupMenuAction, menuItemID);
     }
 };
 
@@ -1168,22 +1168,22 @@ struct PyTextEditorListener : juce::TextEditor::Listener
 
     void textEditorTextChanged (juce::TextEditor& e) override
     {
-        PYBIND11_OVERRIDE_PURE (void, juce::TextEditor::Listener, textEditorTextChanged, e);
+        POPSICLE_OVERRIDE_PURE (void, juce::TextEditor::Listener, textEditorTextChanged, e);
     }
 
     void textEditorReturnKeyPressed (juce::TextEditor& e) override
     {
-        PYBIND11_OVERRIDE_PURE (void, juce::TextEditor::Listener, textEditorReturnKeyPressed, e);
+        POPSICLE_OVERRIDE_PURE (void, juce::TextEditor::Listener, textEditorReturnKeyPressed, e);
     }
 
     void textEditorEscapeKeyPressed (juce::TextEditor& e) override
     {
-        PYBIND11_OVERRIDE_PURE (void, juce::TextEditor::Listener, textEditorEscapeKeyPressed, e);
+        POPSICLE_OVERRIDE_PURE (void, juce::TextEditor::Listener, textEditorEscapeKeyPressed, e);
     }
 
     void textEditorFocusLost (juce::TextEditor& e) override
     {
-        PYBIND11_OVERRIDE_PURE (void, juce::TextEditor::Listener, textEditorFocusLost, e);
+        POPSICLE_OVERRIDE_PURE (void, juce::TextEditor::Listener, textEditorFocusLost, e);
     }
 };
 
@@ -1194,7 +1194,7 @@ struct PyTextEditorInputFilter : Base
 
     juce::String filterNewText (juce::TextEditor& e, const juce::String& newInput) override
     {
-        PYBIND11_OVERRIDE_PURE (juce::String, Base, filterNewText, e, newInput);
+        POPSICLE_OVERRIDE_PURE (juce::String, Base, filterNewText, e, newInput);
     }
 };
 
@@ -1206,7 +1206,7 @@ struct PyListBoxModel : juce::ListBoxModel
 
     int getNumRows() override
     {
-        PYBIND11_OVERRIDE_PURE (int, juce::ListBoxModel, getNumRows);
+        POPSICLE_OVERRIDE_PURE (int, juce::ListBoxModel, getNumRows);
     }
 
     void paintListBoxItem (int rowNumber, juce::Graphics& g, int width, int height, bool rowIsSelected) override
@@ -1214,7 +1214,7 @@ struct PyListBoxModel : juce::ListBoxModel
         {
             pybind11::gil_scoped_acquire gil;
 
-            if (pybind11::function override_ = pybind11::get_override (static_cast<juce::ListBoxModel*> (this), "paintListBoxItem"); override_)
+            if (auto override_ = Helpers::getCachedOverride (static_cast<juce::ListBoxModel*> (this), "paintListBoxItem"); override_)
             {
                 override_ (rowNumber, std::addressof (g), width, height, rowIsSelected);
                 return;
@@ -1229,7 +1229,7 @@ struct PyListBoxModel : juce::ListBoxModel
         {
             pybind11::gil_scoped_acquire gil;
 
-            if (pybind11::function override_ = pybind11::get_override (static_cast<juce::ListBoxModel*> (this), "refreshComponentForRow"); override_)
+            if (auto override_ = Helpers::getCachedOverride (static_cast<juce::ListBoxModel*> (this), "refreshComponentForRow"); override_)
             {
                 auto result = override_ (rowNumber, isRowSelected, existingComponentToUpdate);
                 if (result.is_none())
@@ -1247,62 +1247,62 @@ struct PyListBoxModel : juce::ListBoxModel
 
     juce::String getNameForRow (int rowNumber) override
     {
-        PYBIND11_OVERRIDE (juce::String, juce::ListBoxModel, getNameForRow, rowNumber);
+        POPSICLE_OVERRIDE (juce::String, juce::ListBoxModel, getNameForRow, rowNumber);
     }
 
     void listBoxItemClicked (int row, const juce::MouseEvent& event) override
     {
-        PYBIND11_OVERRIDE (void, juce::ListBoxModel, listBoxItemClicked, row, event);
+        POPSICLE_OVERRIDE (void, juce::ListBoxModel, listBoxItemClicked, row, event);
     }
 
     void listBoxItemDoubleClicked (int row, const juce::MouseEvent& event) override
     {
-        PYBIND11_OVERRIDE (void, juce::ListBoxModel, listBoxItemDoubleClicked, row, event);
+        POPSICLE_OVERRIDE (void, juce::ListBoxModel, listBoxItemDoubleClicked, row, event);
     }
 
     void backgroundClicked (const juce::MouseEvent& event) override
     {
-        PYBIND11_OVERRIDE (void, juce::ListBoxModel, backgroundClicked, event);
+        POPSICLE_OVERRIDE (void, juce::ListBoxModel, backgroundClicked, event);
     }
 
     void selectedRowsChanged (int lastRowSelected) override
     {
-        PYBIND11_OVERRIDE (void, juce::ListBoxModel, selectedRowsChanged, lastRowSelected);
+        POPSICLE_OVERRIDE (void, juce::ListBoxModel, selectedRowsChanged, lastRowSelected);
     }
 
     void deleteKeyPressed (int lastRowSelected) override
     {
-        PYBIND11_OVERRIDE (void, juce::ListBoxModel, deleteKeyPressed, lastRowSelected);
+        POPSICLE_OVERRIDE (void, juce::ListBoxModel, deleteKeyPressed, lastRowSelected);
     }
 
     void returnKeyPressed (int lastRowSelected) override
     {
-        PYBIND11_OVERRIDE (void, juce::ListBoxModel, returnKeyPressed, lastRowSelected);
+        POPSICLE_OVERRIDE (void, juce::ListBoxModel, returnKeyPressed, lastRowSelected);
     }
 
     void listWasScrolled() override
     {
-        PYBIND11_OVERRIDE (void, juce::ListBoxModel, listWasScrolled);
+        POPSICLE_OVERRIDE (void, juce::ListBoxModel, listWasScrolled);
     }
 
     juce::var getDragSourceDescription (const juce::SparseSet<int>& rowsToDescribe) override
     {
-        PYBIND11_OVERRIDE (juce::var, juce::ListBoxModel, getDragSourceDescription, rowsToDescribe);
+        POPSICLE_OVERRIDE (juce::var, juce::ListBoxModel, getDragSourceDescription, rowsToDescribe);
     }
 
     bool mayDragToExternalWindows() const override
     {
-        PYBIND11_OVERRIDE (bool, juce::ListBoxModel, mayDragToExternalWindows);
+        POPSICLE_OVERRIDE (bool, juce::ListBoxModel, mayDragToExternalWindows);
     }
 
     juce::String getTooltipForRow (int row) override
     {
-        PYBIND11_OVERRIDE (juce::String, juce::ListBoxModel, getTooltipForRow, row);
+        POPSICLE_OVERRIDE (juce::String, juce::ListBoxModel, getTooltipForRow, row);
     }
 
     juce::MouseCursor getMouseCursorForRow (int row) override
     {
-        PYBIND11_OVERRIDE (juce::MouseCursor, juce::ListBoxModel, getMouseCursorForRow, row);
+        POPSICLE_OVERRIDE (juce::MouseCursor, juce::ListBoxModel, getMouseCursorForRow, row);
     }
 };
 
@@ -1328,22 +1328,22 @@ struct PyTableHeaderComponent : PyComponent<Base>
 
     void columnClicked (int columnId, const juce::ModifierKeys& mods) override
     {
-        PYBIND11_OVERRIDE (void, juce::TableHeaderComponent, columnClicked, columnId, mods);
+        POPSICLE_OVERRIDE (void, juce::TableHeaderComponent, columnClicked, columnId, mods);
     }
 
     void addMenuItems (juce::PopupMenu& menu, int columnIdClicked) override
     {
-        PYBIND11_OVERRIDE (void, juce::TableHeaderComponent, addMenuItems, menu, columnIdClicked);
+        POPSICLE_OVERRIDE (void, juce::TableHeaderComponent, addMenuItems, menu, columnIdClicked);
     }
 
     void reactToMenuItem (int menuReturnId, int columnIdClicked) override
     {
-        PYBIND11_OVERRIDE (void, juce::TableHeaderComponent, reactToMenuItem, menuReturnId, columnIdClicked);
+        POPSICLE_OVERRIDE (void, juce::TableHeaderComponent, reactToMenuItem, menuReturnId, columnIdClicked);
     }
 
     void showColumnChooserMenu (int columnIdClicked) override
     {
-        PYBIND11_OVERRIDE (void, juce::TableHeaderComponent, showColumnChooserMenu, columnIdClicked);
+        POPSICLE_OVERRIDE (void, juce::TableHeaderComponent, showColumnChooserMenu, columnIdClicked);
     }
 };
 
@@ -1353,22 +1353,22 @@ struct PyTableHeaderComponentListener : juce::TableHeaderComponent::Listener
 
     void tableColumnsChanged (juce::TableHeaderComponent* tableHeader) override
     {
-        PYBIND11_OVERRIDE_PURE (void, juce::TableHeaderComponent::Listener, tableColumnsChanged, tableHeader);
+        POPSICLE_OVERRIDE_PURE (void, juce::TableHeaderComponent::Listener, tableColumnsChanged, tableHeader);
     }
 
     void tableColumnsResized (juce::TableHeaderComponent* tableHeader) override
     {
-        PYBIND11_OVERRIDE_PURE (void, juce::TableHeaderComponent::Listener, tableColumnsResized, tableHeader);
+        POPSICLE_OVERRIDE_PURE (void, juce::TableHeaderComponent::Listener, tableColumnsResized, tableHeader);
     }
 
     void tableSortOrderChanged (juce::TableHeaderComponent* tableHeader) override
     {
-        PYBIND11_OVERRIDE_PURE (void, juce::TableHeaderComponent::Listener, tableSortOrderChanged, tableHeader);
+        POPSICLE_OVERRIDE_PURE (void, juce::TableHeaderComponent::Listener, tableSortOrderChanged, tableHeader);
     }
 
     void tableColumnDraggingChanged (juce::TableHeaderComponent* tableHeader, int columnIdNowBeingDragged) override
     {
-        PYBIND11_OVERRIDE (void, juce::TableHeaderComponent::Listener, tableColumnDraggingChanged, tableHeader, columnIdNowBeingDragged);
+        POPSICLE_OVERRIDE (void, juce::TableHeaderComponent::Listener, tableColumnDraggingChanged, tableHeader, columnIdNowBeingDragged);
     }
 };
 
@@ -1380,7 +1380,7 @@ struct PyTableListBoxModel : juce::TableListBoxModel
 
     int getNumRows() override
     {
-        PYBIND11_OVERRIDE_PURE (int, juce::TableListBoxModel, getNumRows);
+        POPSICLE_OVERRIDE_PURE (int, juce::TableListBoxModel, getNumRows);
     }
 
     void paintRowBackground (juce::Graphics& g, int rowNumber, int width, int height, bool rowIsSelected) override
@@ -1388,7 +1388,7 @@ struct PyTableListBoxModel : juce::TableListBoxModel
         {
             pybind11::gil_scoped_acquire gil;
 
-            if (pybind11::function override_ = pybind11::get_override (static_cast<juce::TableListBoxModel*> (this), "paintRowBackground"); override_)
+            if (auto override_ = Helpers::getCachedOverride (static_cast<juce::TableListBoxModel*> (this), "paintRowBackground"); override_)
             {
                 override_ (std::addressof (g), rowNumber, width, height, rowIsSelected);
                 return;
@@ -1403,7 +1403,7 @@ struct PyTableListBoxModel : juce::TableListBoxModel
         {
             pybind11::gil_scoped_acquire gil;
 
-            if (pybind11::function override_ = pybind11::get_override (static_cast<juce::TableListBoxModel*> (this), "paintCell"); override_)
+            if (auto override_ = Helpers::getCachedOverride (static_cast<juce::TableListBoxModel*> (this), "paintCell"); override_)
             {
                 override_ (std::addressof (g), rowNumber, columnId, width, height, rowIsSelected);
                 return;
@@ -1418,7 +1418,7 @@ struct PyTableListBoxModel : juce::TableListBoxModel
         {
             pybind11::gil_scoped_acquire gil;
 
-            if (pybind11::function override_ = pybind11::get_override (static_cast<juce::TableListBoxModel*> (this), "refreshComponentForCell"); override_)
+            if (auto override_ = Helpers::getCachedOverride (static_cast<juce::TableListBoxModel*> (this), "refreshComponentForCell"); override_)
             {
                 auto result = override_ (rowNumber, columnId, isRowSelected, existingComponentToUpdate);
                 if (result.is_none())
@@ -1436,62 +1436,62 @@ struct PyTableListBoxModel : juce::TableListBoxModel
 
     void cellClicked (int rowNumber, int columnId, const juce::MouseEvent& event) override
     {
-        PYBIND11_OVERRIDE (void, juce::TableListBoxModel, cellClicked, rowNumber, columnId, event);
+        POPSICLE_OVERRIDE (void, juce::TableListBoxModel, cellClicked, rowNumber, columnId, event);
     }
 
     void cellDoubleClicked (int rowNumber, int columnId, const juce::MouseEvent& event) override
     {
-        PYBIND11_OVERRIDE (void, juce::TableListBoxModel, cellDoubleClicked, rowNumber, columnId, event);
+        POPSICLE_OVERRIDE (void, juce::TableListBoxModel, cellDoubleClicked, rowNumber, columnId, event);
     }
 
     void backgroundClicked (const juce::MouseEvent& event) override
     {
-        PYBIND11_OVERRIDE (void, juce::TableListBoxModel, backgroundClicked, event);
+        POPSICLE_OVERRIDE (void, juce::TableListBoxModel, backgroundClicked, event);
     }
 
     void sortOrderChanged (int newSortColumnId, bool isForwards) override
     {
-        PYBIND11_OVERRIDE (void, juce::TableListBoxModel, sortOrderChanged, newSortColumnId, isForwards);
+        POPSICLE_OVERRIDE (void, juce::TableListBoxModel, sortOrderChanged, newSortColumnId, isForwards);
     }
 
     int getColumnAutoSizeWidth (int columnId) override
     {
-        PYBIND11_OVERRIDE (int, juce::TableListBoxModel, getColumnAutoSizeWidth, columnId);
+        POPSICLE_OVERRIDE (int, juce::TableListBoxModel, getColumnAutoSizeWidth, columnId);
     }
 
     juce::String getCellTooltip (int rowNumber, int columnId) override
     {
-        PYBIND11_OVERRIDE ( juce::String, juce::TableListBoxModel, getCellTooltip, rowNumber, columnId);
+        POPSICLE_OVERRIDE ( juce::String, juce::TableListBoxModel, getCellTooltip, rowNumber, columnId);
     }
 
     void selectedRowsChanged (int lastRowSelected) override
     {
-        PYBIND11_OVERRIDE (void, juce::TableListBoxModel, selectedRowsChanged, lastRowSelected);
+        POPSICLE_OVERRIDE (void, juce::TableListBoxModel, selectedRowsChanged, lastRowSelected);
     }
 
     void deleteKeyPressed (int lastRowSelected) override
     {
-        PYBIND11_OVERRIDE (void, juce::TableListBoxModel, deleteKeyPressed, lastRowSelected);
+        POPSICLE_OVERRIDE (void, juce::TableListBoxModel, deleteKeyPressed, lastRowSelected);
     }
 
     void returnKeyPressed (int lastRowSelected) override
     {
-        PYBIND11_OVERRIDE (void, juce::TableListBoxModel, returnKeyPressed, lastRowSelected);
+        POPSICLE_OVERRIDE (void, juce::TableListBoxModel, returnKeyPressed, lastRowSelected);
     }
 
     void listWasScrolled() override
     {
-        PYBIND11_OVERRIDE (void, juce::TableListBoxModel, listWasScrolled);
+        POPSICLE_OVERRIDE (void, juce::TableListBoxModel, listWasScrolled);
     }
 
     juce::var getDragSourceDescription (const juce::SparseSet<int>& currentlySelectedRows) override
     {
-        PYBIND11_OVERRIDE (juce::var, juce::TableListBoxModel, getDragSourceDescription, currentlySelectedRows);
+        POPSICLE_OVERRIDE (juce::var, juce::TableListBoxModel, getDragSourceDescription, currentlySelectedRows);
     }
 
     bool mayDragToExternalWindows() const override
     {
-        PYBIND11_OVERRIDE (bool, juce::TableListBoxModel, mayDragToExternalWindows);
+        POPSICLE_OVERRIDE (bool, juce::TableListBoxModel, mayDragToExternalWindows);
     }
 };
 
@@ -1506,7 +1506,7 @@ struct PyToolbarItemFactory : juce::ToolbarItemFactory
         {
             pybind11::gil_scoped_acquire gil;
 
-            if (pybind11::function override_ = pybind11::get_override (static_cast<juce::ToolbarItemFactory*> (this), "getAllToolbarItemIds"); override_)
+            if (auto override_ = Helpers::getCachedOverride (static_cast<juce::ToolbarItemFactory*> (this), "getAllToolbarItemIds"); override_)
             {
                 auto result = override_ ();
 
@@ -1522,7 +1522,7 @@ struct PyToolbarItemFactory : juce::ToolbarItemFactory
         {
             pybind11::gil_scoped_acquire gil;
 
-            if (pybind11::function override_ = pybind11::get_override (static_cast<juce::ToolbarItemFactory*> (this), "getDefaultItemSet"); override_)
+            if (auto override_ = Helpers::getCachedOverride (static_cast<juce::ToolbarItemFactory*> (this), "getDefaultItemSet"); override_)
             {
                 auto result = override_ ();
 
@@ -1535,7 +1535,7 @@ struct PyToolbarItemFactory : juce::ToolbarItemFactory
 
     juce::ToolbarItemComponent* createItem (int itemId) override
     {
-        PYBIND11_OVERRIDE_PURE (juce::ToolbarItemComponent*, juce::ToolbarItemFactory, createItem, itemId);
+        POPSICLE_OVERRIDE_PURE (juce::ToolbarItemComponent*, juce::ToolbarItemFactory, createItem, itemId);
     }
 };
 
@@ -1546,7 +1546,7 @@ struct PyToolbarItemComponent : PyButton<Base>
 
     void setStyle (const juce::Toolbar::ToolbarItemStyle& newStyle) override
     {
-        PYBIND11_OVERRIDE (void, Base, setStyle, newStyle);
+        POPSICLE_OVERRIDE (void, Base, setStyle, newStyle);
     }
 
     bool getToolbarItemSizes (int toolbarThickness, bool isToolbarVertical, int& preferredSize, int& minSize, int& maxSize) override
@@ -1554,7 +1554,7 @@ struct PyToolbarItemComponent : PyButton<Base>
         {
             pybind11::gil_scoped_acquire gil;
 
-            if (pybind11::function override_ = pybind11::get_override (static_cast<Base*> (this), "getToolbarItemSizes"); override_)
+            if (auto override_ = Helpers::getCachedOverride (static_cast<Base*> (this), "getToolbarItemSizes"); override_)
             {
                 auto result = override_ (toolbarThickness, isToolbarVertical, std::ref (preferredSize), std::ref (minSize), std::ref (maxSize));
 
@@ -1570,7 +1570,7 @@ struct PyToolbarItemComponent : PyButton<Base>
         {
             pybind11::gil_scoped_acquire gil;
 
-            if (pybind11::function override_ = pybind11::get_override (static_cast<Base*> (this), "paintButtonArea"); override_)
+            if (auto override_ = Helpers::getCachedOverride (static_cast<Base*> (this), "paintButtonArea"); override_)
             {
                 override_ (std::addressof (g), width, height, isMouseOver, isMouseDown);
 
@@ -1583,7 +1583,7 @@ struct PyToolbarItemComponent : PyButton<Base>
 
     void contentAreaChanged (const juce::Rectangle<int>& newBounds) override
     {
-        PYBIND11_OVERRIDE_PURE (void, Base, contentAreaChanged, newBounds);
+        POPSICLE_OVERRIDE_PURE (void, Base, contentAreaChanged, newBounds);
     }
 };
 
@@ -1593,22 +1593,22 @@ struct PyMenuBarModel : juce::MenuBarModel
 {
     juce::StringArray getMenuBarNames() override
     {
-        PYBIND11_OVERRIDE_PURE (juce::StringArray, juce::MenuBarModel, getMenuBarNames);
+        POPSICLE_OVERRIDE_PURE (juce::StringArray, juce::MenuBarModel, getMenuBarNames);
     }
 
     juce::PopupMenu getMenuForIndex (int topLevelMenuIndex, const juce::String& menuName) override
     {
-        PYBIND11_OVERRIDE_PURE (juce::PopupMenu, juce::MenuBarModel, getMenuForIndex, topLevelMenuIndex, menuName);
+        POPSICLE_OVERRIDE_PURE (juce::PopupMenu, juce::MenuBarModel, getMenuForIndex, topLevelMenuIndex, menuName);
     }
 
     void menuItemSelected (int menuItemID, int topLevelMenuIndex) override
     {
-        PYBIND11_OVERRIDE_PURE (void, juce::MenuBarModel, menuItemSelected, menuItemID, topLevelMenuIndex);
+        POPSICLE_OVERRIDE_PURE (void, juce::MenuBarModel, menuItemSelected, menuItemID, topLevelMenuIndex);
     }
 
     void menuBarActivated (bool isActive) override
     {
-        PYBIND11_OVERRIDE (void, juce::MenuBarModel, menuBarActivated, isActive);
+        POPSICLE_OVERRIDE (void, juce::MenuBarModel, menuBarActivated, isActive);
     }
 };
 
@@ -1616,17 +1616,17 @@ struct PyMenuBarModelListener : juce::MenuBarModel::Listener
 {
     void menuBarItemsChanged (juce::MenuBarModel* menuBarModel) override
     {
-        PYBIND11_OVERRIDE_PURE (void, juce::MenuBarModel::Listener, menuBarItemsChanged, menuBarModel);
+        POPSICLE_OVERRIDE_PURE (void, juce::MenuBarModel::Listener, menuBarItemsChanged, menuBarModel);
     }
 
     void menuCommandInvoked (juce::MenuBarModel* menuBarModel, const juce::ApplicationCommandTarget::InvocationInfo& info) override
     {
-        PYBIND11_OVERRIDE_PURE (void, juce::MenuBarModel::Listener, menuCommandInvoked, menuBarModel, info);
+        POPSICLE_OVERRIDE_PURE (void, juce::MenuBarModel::Listener, menuCommandInvoked, menuBarModel, info);
     }
 
     void menuBarActivated (juce::MenuBarModel* menuBarModel, bool isActive) override
     {
-        PYBIND11_OVERRIDE_PURE (void, juce::MenuBarModel::Listener, menuBarActivated, menuBarModel, isActive);
+        POPSICLE_OVERRIDE_PURE (void, juce::MenuBarModel::Listener, menuBarActivated, menuBarModel, isActive);
     }
 };
 
@@ -1639,42 +1639,42 @@ struct PySlider : PyComponent<Base>
 
     void startedDragging() override
     {
-        PYBIND11_OVERRIDE (void, Base, startedDragging);
+        POPSICLE_OVERRIDE (void, Base, startedDragging);
     }
 
     void stoppedDragging() override
     {
-        PYBIND11_OVERRIDE (void, Base, stoppedDragging);
+        POPSICLE_OVERRIDE (void, Base, stoppedDragging);
     }
 
     void valueChanged() override
     {
-        PYBIND11_OVERRIDE (void, Base, valueChanged);
+        POPSICLE_OVERRIDE (void, Base, valueChanged);
     }
 
     double getValueFromText (const juce::String& text) override
     {
-        PYBIND11_OVERRIDE (double, Base, getValueFromText, text);
+        POPSICLE_OVERRIDE (double, Base, getValueFromText, text);
     }
 
     juce::String getTextFromValue (double value) override
     {
-        PYBIND11_OVERRIDE (juce::String, Base, getTextFromValue, value);
+        POPSICLE_OVERRIDE (juce::String, Base, getTextFromValue, value);
     }
 
     double proportionOfLengthToValue (double proportion) override
     {
-        PYBIND11_OVERRIDE (double, Base, proportionOfLengthToValue, proportion);
+        POPSICLE_OVERRIDE (double, Base, proportionOfLengthToValue, proportion);
     }
 
     double valueToProportionOfLength (double value) override
     {
-        PYBIND11_OVERRIDE (double, Base, valueToProportionOfLength, value);
+        POPSICLE_OVERRIDE (double, Base, valueToProportionOfLength, value);
     }
 
     double snapValue (double attemptedValue, juce::Slider::DragMode dragMode) override
     {
-        PYBIND11_OVERRIDE (double, Base, snapValue, attemptedValue, dragMode);
+        POPSICLE_OVERRIDE (double, Base, snapValue, attemptedValue, dragMode);
     }
 };
 
@@ -1684,17 +1684,17 @@ struct PySliderListener : juce::Slider::Listener
 
     void sliderValueChanged (juce::Slider* slider) override
     {
-        PYBIND11_OVERRIDE_PURE (void, juce::Slider::Listener, sliderValueChanged, slider);
+        POPSICLE_OVERRIDE_PURE (void, juce::Slider::Listener, sliderValueChanged, slider);
     }
 
     void sliderDragStarted (juce::Slider* slider) override
     {
-        PYBIND11_OVERRIDE (void, juce::Slider::Listener, sliderDragStarted, slider);
+        POPSICLE_OVERRIDE (void, juce::Slider::Listener, sliderDragStarted, slider);
     }
 
     void sliderDragEnded (juce::Slider* slider) override
     {
-        PYBIND11_OVERRIDE (void, juce::Slider::Listener, sliderDragEnded, slider);
+        POPSICLE_OVERRIDE (void, juce::Slider::Listener, sliderDragEnded, slider);
     }
 };
 
@@ -1707,17 +1707,17 @@ struct PyDocumentWindow : PyComponent<Base>
 
     void closeButtonPressed() override
     {
-        PYBIND11_OVERRIDE (void, Base, closeButtonPressed);
+        POPSICLE_OVERRIDE (void, Base, closeButtonPressed);
     }
 
     void minimiseButtonPressed() override
     {
-        PYBIND11_OVERRIDE (void, Base, minimiseButtonPressed);
+        POPSICLE_OVERRIDE (void, Base, minimiseButtonPressed);
     }
 
     void maximiseButtonPressed() override
     {
-        PYBIND11_OVERRIDE (void, Base, maximiseButtonPressed);
+        POPSICLE_OVERRIDE (void, Base, maximiseButtonPressed);
     }
 };
 
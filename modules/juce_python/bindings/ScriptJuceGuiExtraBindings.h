@@ -41,7 +41,7 @@ struct PyAnimatedAppComponent : PyComponent<Base>
 
     void update() override
     {
-        PYBIND11_OVERRIDE_PURE(void, Base, update);
+        POPSICLE_OVERRIDE_PURE(void, Base, update);
     }
 };
 
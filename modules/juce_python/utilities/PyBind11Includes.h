@@ -91,3 +91,5 @@ JUCE_BEGIN_IGNORE_WARNINGS_MSVC (4180)
 
 JUCE_END_IGNORE_WARNINGS_GCC_LIKE
 JUCE_END_IGNORE_WARNINGS_MSVC
+
+#include "PythonOverrides.h"
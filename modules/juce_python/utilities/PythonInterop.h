@@ -24,6 +24,7 @@
 #include "ClassDemangling.h"
 
 #include <functional>
+#include <string_view>
 
 // =================================================================================================
 
@@ -98,6 +99,138 @@ pybind11::enum_<E> makeArithmeticEnum (pybind11::object& parent, const char* nam
 
 // =================================================================================================
 
+namespace Detail {
+
+template <class T, auto getExportError>
+int getCheckedBuffer (PyObject* object, Py_buffer* view, int flags)
+{
+    pybind11::detail::make_caster<T> caster;
+    if (caster.load (object, false))
+    {
+        if (const char* error = getExportError (pybind11::detail::cast_op<const T&> (caster)))
+        {
+            PyErr_SetString (PyExc_BufferError, error);
+            return -1;
+        }
+    }
+
+    return pybind11::detail::pybind11_getbuffer (object, view, flags);
+}
+
+} // namespace Detail
+
+/**
+ * @brief Rejects exporting the buffer of some instances of a class with a python BufferError.
+ *
+ * Exceptions thrown from a def_buffer callback can't propagate through the pybind11 buffer protocol implementation,
+ * so getExportError is checked first: it returns nullptr when the instance can be exported, or the error message.
+ * Must be called while registering the class, before any python subclass of it is created.
+ */
+template <auto getExportError, class T, class... Options>
+void setBufferExportCheck (pybind11::class_<T, Options...>& classObject)
+{
+    auto* heapType = reinterpret_cast<PyHeapTypeObject*> (classObject.ptr());
+    heapType->as_buffer.bf_getbuffer = &Detail::getCheckedBuffer<T, getExportError>;
+}
+
+// =================================================================================================
+
+/**
+ * @brief Returns true if the items of a buffer have the type T.
+ *
+ * Integer formats are matched by signedness and size, as the same integer type is spelled differently across
+ * platforms (numpy int32 exports 'l' on Windows, while pybind11 describes int as 'i').
+ */
+template <class T>
+bool isBufferFormatOf (const pybind11::buffer_info& info)
+{
+    if (info.itemsize != static_cast<pybind11::ssize_t> (sizeof (T)))
+        return false;
+
+    if (info.format == pybind11::format_descriptor<T>::format())
+        return true;
+
+    if constexpr (std::is_integral_v<T> && ! std::is_same_v<T, bool>)
+    {
+        std::string_view format (info.format);
+
+       #if JUCE_LITTLE_ENDIAN
+        constexpr char nativeByteOrder = '<';
+       #else
+        constexpr char nativeByteOrder = '>';
+       #endif
+
+        if (format.size() == 2 && (format[0] == '@' || format[0] == '=' || format[0] == nativeByteOrder))
+            format.remove_prefix (1);
+
+        if (format.size() != 1)
+            return false;
+
+        constexpr std::string_view integerFormats = std::is_signed_v<T> ? "bhilq" : "BHILQ";
+        return integerFormats.find (format[0]) != std::string_view::npos;
+    }
+    else
+    {
+        return false;
+    }
+}
+
+// =================================================================================================
+
+/**
+ * @brief Returns the native address held by a python object.
+ *
+ * Understands integers, objects exposing an integer "address" attribute (like numba cfuncs), ctypes function pointers,
+ * ctypes pointers (the address they point to), ctypes instances (their own address), and writable buffers (the address
+ * of their first item). None maps to nullptr.
+ */
+inline void* getNativeAddress (const pybind11::object& object)
+{
+    if (object.is_none())
+        return nullptr;
+
+    if (pybind11::isinstance<pybind11::int_> (object))
+        return reinterpret_cast<void*> (object.cast<std::uintptr_t>());
+
+    if (pybind11::hasattr (object, "address"))
+        return getNativeAddress (object.attr ("address"));
+
+    auto ctypes = pybind11::module_::import ("ctypes");
+
+    if (pybind11::isinstance (object, ctypes.attr ("c_void_p")))
+        return getNativeAddress (object.attr ("value"));
+
+    // Pointers hold the address in their value, while addressof would return where the pointer itself is stored
+    if (pybind11::isinstance (object, ctypes.attr ("_CFuncPtr"))
+        || pybind11::isinstance (object, ctypes.attr ("_Pointer"))
+        || pybind11::isinstance (object, ctypes.attr ("c_char_p"))
+        || pybind11::isinstance (object, ctypes.attr ("c_wchar_p")))
+        return getNativeAddress (ctypes.attr ("cast") (object, ctypes.attr ("c_void_p")).attr ("value"));
+
+    if (pybind11::isinstance (object, ctypes.attr ("_SimpleCData"))
+        || pybind11::isinstance (object, ctypes.attr ("Structure"))
+        || pybind11::isinstance (object, ctypes.attr ("Array")))
+        return getNativeAddress (ctypes.attr ("addressof") (object));
+
+    if (pybind11::isinstance<pybind11::buffer> (object))
+        return pybind11::reinterpret_borrow<pybind11::buffer> (object).request (true).ptr;
+
+    throw pybind11::type_error ("Unable to obtain a native address from an object of type " + std::string (pybind11::str (object.get_type())));
+}
+
+/**
+ * @brief Returns a native function pointer held by a python object, see getNativeAddress.
+ */
+template <class F>
+F getNativeFunction (const pybind11::object& object)
+{
+    static_assert (std::is_pointer_v<F> && std::is_function_v<std::remove_pointer_t<F>>);
+
+    return reinterpret_cast<F> (getNativeAddress (object));
+}
+
+// =================================================================================================
+
 template <class T, class F>
 auto makeVoidPointerAndSizeCallable (F&& func)
 {
@@ -0,0 +1,402 @@
+/**
+ * juce_python - Python bindings for the JUCE framework.
+ *
+ * This file is part of the popsicle project.
+ *
+ * Copyright (c) 2024 - kunitoki <kunitoki@gmail.com>
+ *
+ * popsicle is an open source library subject to commercial or open-source licensing.
+ *
+ * By using popsicle, you agree to the terms of the popsicle License Agreement, which can
+ * be found at https://raw.githubusercontent.com/kunitoki/popsicle/master/LICENSE
+ *
+ * Or: You may also use this code under the terms of the GPL v3 (see www.gnu.org/licenses).
+ *
+ * POPSICLE IS PROVIDED "AS IS" WITHOUT ANY WARRANTY, AND ALL WARRANTIES, WHETHER EXPRESSED
+ * OR IMPLIED, INCLUDING MERCHANTABILITY AND FITNESS FOR PURPOSE, ARE DISCLAIMED.
+ */
+
+#pragma once
+
+#include <cstring>
+#include <functional>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace popsicle::Helpers {
+
+// =================================================================================================
+
+/**
+ * @brief A resolved Python override of a trampoline method.
+ *
+ * Either wraps a bound method coming from pybind11::get_override, or a plain function found in the
+ * class dictionary together with the instance it has to be called on.
+ */
+class PythonOverride
+{
+public:
+    PythonOverride() = default;
+
+    explicit PythonOverride (pybind11::function boundFunction)
+        : function (std::move (boundFunction))
+    {
+    }
+
+    PythonOverride (pybind11::handle self, pybind11::object unboundFunction, const char* name)
+        : self (self)
+        , function (std::move (unboundFunction))
+        , name (name)
+    {
+    }
+
+    explicit operator bool() const noexcept
+    {
+        return static_cast<bool> (function);
+    }
+
+    template <class... Args>
+    pybind11::object operator() (Args&&... args) const
+    {
+        if (! self)
+            return function (std::forward<Args> (args)...);
+
+        ScopedActiveOverride activeOverride (self.ptr(), name);
+        return function (self, std::forward<Args> (args)...);
+    }
+
+    static bool isActive (PyObject* self, const char* name) noexcept
+    {
+        for (const auto& [activeSelf, activeName] : getActiveOverrides())
+        {
+            if (activeSelf == self && std::strcmp (activeName, name) == 0)
+                return true;
+        }
+
+        return false;
+    }
+
+private:
+    struct ScopedActiveOverride
+    {
+        ScopedActiveOverride (PyObject* self, const char* name)
+        {
+            getActiveOverrides().emplace_back (self, name);
+        }
+
+        ~ScopedActiveOverride()
+        {
+            getActiveOverrides().pop_back();
+        }
+    };
+
+    static std::vector<std::pair<PyObject*, const char*>>& getActiveOverrides() noexcept
+    {
+        thread_local std::vector<std::pair<PyObject*, const char*>> activeOverrides;
+        return activeOverrides;
+    }
+
+    pybind11::handle self;
+    pybind11::object function;
+    const char* name = nullptr;
+};
+
+// =================================================================================================
+
+namespace Detail {
+
+struct OverrideCacheKey
+{
+    PyTypeObject* type = nullptr;
+    const char* name = nullptr;
+
+    bool operator== (const OverrideCacheKey& other) const noexcept
+    {
+        return type == other.type && name == other.name;
+    }
+};
+
+struct OverrideCacheKeyHash
+{
+    std::size_t operator() (const OverrideCacheKey& key) const noexcept
+    {
+        return std::hash<const void*>{} (key.type) ^ (std::hash<const void*>{} (key.name) << 1);
+    }
+};
+
+struct OverrideCacheEntry
+{
+    enum class Kind
+    {
+        notOverridden,
+        function,
+        fullLookup
+    };
+
+    Kind kind = Kind::fullLookup;
+    unsigned int versionTag = 0;
+    pybind11::object function;
+    pybind11::object name;
+};
+
+using OverrideCache = std::unordered_map<OverrideCacheKey, OverrideCacheEntry, OverrideCacheKeyHash>;
+
+inline OverrideCache& getOverrideCache()
+{
+    // Intentionally leaked, entries are dropped by the type weak reference callbacks instead
+    static auto* cache = new OverrideCache();
+    return *cache;
+}
+
+inline bool& overrideCacheEnabled() noexcept
+{
+    static bool enabled = true;
+    return enabled;
+}
+
+inline bool hasValidVersionTag (PyTypeObject* type) noexcept
+{
+    // Py_TPFLAGS_VALID_VERSION_TAG is not maintained anymore since 3.13, a zero tag means unassigned
+    return type->tp_version_tag != 0;
+}
+
+inline void assignVersionTag (PyTypeObject* type, PyObject* name)
+{
+#if PY_VERSION_HEX >= 0x030C0000
+    (void) name;
+    (void) PyUnstable_Type_AssignVersionTag (type);
+#else
+    // Looking the attribute up on the type goes through the type attribute cache, which assigns a fresh version tag
+    auto attribute = pybind11::reinterpret_steal<pybind11::object> (PyObject_GetAttr (reinterpret_cast<PyObject*> (type), name));
+    if (! attribute)
+        PyErr_Clear();
+#endif
+}
+
+inline pybind11::object lookupTypeAttribute (PyTypeObject* type, PyObject* name)
+{
+    PyObject* mro = type->tp_mro;
+    if (mro == nullptr || ! PyTuple_Check (mro))
+        return {};
+
+    for (Py_ssize_t i = 0; i < PyTuple_GET_SIZE (mro); ++i)
+    {
+        auto* base = reinterpret_cast<PyTypeObject*> (PyTuple_GET_ITEM (mro, i));
+
+#if PY_VERSION_HEX >= 0x030C0000
+        auto dict = pybind11::reinterpret_steal<pybind11::object> (PyType_GetDict (base));
+#else
+        auto dict = pybind11::reinterpret_borrow<pybind11::object> (base->tp_dict);
+#endif
+        if (! dict)
+            continue;
+
+        PyObject* value = PyDict_GetItemWithError (dict.ptr(), name);
+        if (value != nullptr)
+            return pybind11::reinterpret_borrow<pybind11::object> (value);
+
+        if (PyErr_Occurred())
+            throw pybind11::error_already_set();
+    }
+
+    return {};
+}
+
+inline OverrideCacheEntry resolveOverride (PyTypeObject* type, const char* name)
+{
+    OverrideCacheEntry entry;
+
+    entry.name = pybind11::reinterpret_steal<pybind11::object> (PyUnicode_InternFromString (name));
+    if (! entry.name)
+        throw pybind11::error_already_set();
+
+    assignVersionTag (type, entry.name.ptr());
+    entry.versionTag = hasValidVersionTag (type) ? type->tp_version_tag : 0;
+
+    auto attribute = lookupTypeAttribute (type, entry.name.ptr());
+
+    if (type->tp_getattro != PyObject_GenericGetAttr || ! attribute)
+        entry.kind = OverrideCacheEntry::Kind::fullLookup;
+    else if (PyFunction_Check (attribute.ptr()))
+        entry.kind = OverrideCacheEntry::Kind::function;
+    else if (PyCFunction_Check (pybind11::detail::get_function (attribute).ptr()))
+        entry.kind = OverrideCacheEntry::Kind::notOverridden;
+    else
+        entry.kind = OverrideCacheEntry::Kind::fullLookup;
+
+    if (entry.kind == OverrideCacheEntry::Kind::function)
+        entry.function = std::move (attribute);
+
+    return entry;
+}
+
+inline OverrideCacheEntry lookupOverride (PyTypeObject* type, const char* name)
+{
+    auto& cache = getOverrideCache();
+
+    const OverrideCacheKey key { type, name };
+    if (auto it = cache.find (key); it != cache.end())
+    {
+        if (hasValidVersionTag (type) && it->second.versionTag == type->tp_version_tag)
+            return it->second;
+    }
+
+    auto entry = resolveOverride (type, name);
+    if (entry.versionTag == 0)
+        return entry;
+
+    if (const auto [it, inserted] = cache.insert_or_assign (key, entry); inserted)
+    {
+        pybind11::cpp_function removeEntry ([key] (pybind11::handle weakref)
+        {
+            getOverrideCache().erase (key);
+            weakref.dec_ref();
+        });
+
+        (void) pybind11::weakref (reinterpret_cast<PyObject*> (type), removeEntry).release();
+    }
+
+    return entry;
+}
+
+inline bool hasInstanceAttribute (pybind11::handle self, const OverrideCacheEntry& entry)
+{
+    // Only the instance __dict__ can shadow the class function, as plain functions are non data descriptors
+    auto dict = pybind11::reinterpret_steal<pybind11::object> (PyObject_GenericGetDict (self.ptr(), nullptr));
+    if (! dict)
+    {
+        if (! PyErr_ExceptionMatches (PyExc_AttributeError))
+            throw pybind11::error_already_set();
+
+        PyErr_Clear();
+        return false;
+    }
+
+    PyObject* value = PyDict_GetItemWithError (dict.ptr(), entry.name.ptr());
+    if (value == nullptr && PyErr_Occurred())
+        throw pybind11::error_already_set();
+
+    return value != nullptr;
+}
+
+} // namespace Detail
+
+// =================================================================================================
+
+/**
+ * @brief Resolves the Python override of a trampoline method, caching the lookup per Python type.
+ *
+ * pybind11::get_override does an attribute lookup, allocates a bound method and inspects the calling
+ * frame on every single call. Here the class dictionary lookup is cached per (type, method) and
+ * invalidated through the CPython type version tag, which changes whenever the type or any of its
+ * bases gets an attribute assigned or deleted. Instances defining the method in their own __dict__,
+ * types with a custom __getattribute__ and re-entrant calls (an override calling into the base
+ * class implementation) still go through pybind11::get_override to preserve its semantics.
+ *
+ * The name is expected to be a string literal, as the cache is keyed by its address.
+ *
+ * @see setOverrideCacheEnabled
+ */
+template <class T>
+PythonOverride getCachedOverride (const T* thisPtr, const char* name)
+{
+#if defined (PYPY_VERSION)
+    return PythonOverride (pybind11::get_override (thisPtr, name));
+
+#else
+    auto* typeInfo = pybind11::detail::get_type_info (typeid (T));
+    if (typeInfo == nullptr)
+        return {};
+
+    if (! Detail::overrideCacheEnabled())
+        return PythonOverride (pybind11::detail::get_type_override (thisPtr, typeInfo, name));
+
+    pybind11::handle self = pybind11::detail::get_object_handle (thisPtr, typeInfo);
+    if (! self)
+        return {};
+
+    if (PythonOverride::isActive (self.ptr(), name))
+        return PythonOverride (pybind11::detail::get_type_override (thisPtr, typeInfo, name));
+
+    auto entry = Detail::lookupOverride (Py_TYPE (self.ptr()), name);
+
+    switch (entry.kind)
+    {
+    case Detail::OverrideCacheEntry::Kind::notOverridden:
+        return {};
+
+    case Detail::OverrideCacheEntry::Kind::function:
+        if (! Detail::hasInstanceAttribute (self, entry))
+            return PythonOverride (self, std::move (entry.function), name);
+
+        break;
+
+    case Detail::OverrideCacheEntry::Kind::fullLookup:
+        break;
+    }
+
+    return PythonOverride (pybind11::detail::get_type_override (thisPtr, typeInfo, name));
+
+#endif
+}
+
+// =================================================================================================
+
+/**
+ * @brief Enables or disables the cached override resolution, falling back to pybind11::get_override.
+ *
+ * Mostly useful to compare the dispatch overhead of both strategies. Must be called with the GIL held.
+ */
+inline void setOverrideCacheEnabled (bool shouldBeEnabled) noexcept
+{
+    Detail::overrideCacheEnabled() = shouldBeEnabled;
+}
+
+inline bool isOverrideCacheEnabled() noexcept
+{
+    return Detail::overrideCacheEnabled();
+}
+
+} // namespace popsicle::Helpers
+
+// =================================================================================================
+
+/**
+ * @brief Trampoline macros equivalent to the PYBIND11_OVERRIDE* ones, resolving the override through getCachedOverride.
+ *
+ * The pybind11 macros are left untouched, so trampolines can still opt out of the cache by using them directly.
+ */
+#define POPSICLE_OVERRIDE_IMPL(ret_type, cname, name, ...)                                                        \
+    do {                                                                                                          \
+        pybind11::gil_scoped_acquire gil;                                                                         \
+        if (auto override = ::popsicle::Helpers::getCachedOverride (static_cast<const cname*> (this), name))      \
+        {                                                                                                         \
+            auto o = override (__VA_ARGS__);                                                                      \
+            if (pybind11::detail::cast_is_temporary_value_reference<ret_type>::value)                             \
+            {                                                                                                     \
+                static pybind11::detail::override_caster_t<ret_type> caster;                                      \
+                return pybind11::detail::cast_ref<ret_type> (std::move (o), caster);                              \
+            }                                                                                                     \
+            return pybind11::detail::cast_safe<ret_type> (std::move (o));                                         \
+        }                                                                                                         \
+    } while (false)
+
+#define POPSICLE_OVERRIDE_NAME(ret_type, cname, name, fn, ...)                                                    \
+    do {                                                                                                          \
+        POPSICLE_OVERRIDE_IMPL (PYBIND11_TYPE (ret_type), PYBIND11_TYPE (cname), name, __VA_ARGS__);              \
+        return cname::fn (__VA_ARGS__);                                                                           \
+    } while (false)
+
+#define POPSICLE_OVERRIDE_PURE_NAME(ret_type, cname, name, fn, ...)                                               \
+    do {                                                                                                          \
+        POPSICLE_OVERRIDE_IMPL (PYBIND11_TYPE (ret_type), PYBIND11_TYPE (cname), name, __VA_ARGS__);              \
+        pybind11::pybind11_fail (                                                                                 \
+            "Tried to call pure virtual function \"" PYBIND11_STRINGIFY (cname) "::" name "\"");                  \
+    } while (false)
+
+#define POPSICLE_OVERRIDE(ret_type, cname, fn, ...)                                                               \
+    POPSICLE_OVERRIDE_NAME (PYBIND11_TYPE (ret_type), PYBIND11_TYPE (cname), #fn, fn, __VA_ARGS__)
+
+#define POPSICLE_OVERRIDE_PURE(ret_type, cname, fn, ...)                                                          \
+    POPSICLE_OVERRIDE_PURE_NAME (PYBIND11_TYPE (ret_type), PYBIND11_TYPE (cname), #fn, fn, __VA_ARGS__)
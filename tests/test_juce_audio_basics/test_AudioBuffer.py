@@ -0,0 +1,183 @@
+import weakref
+import pytest
+import numpy as np
+
+import popsicle as juce
+
+#==================================================================================================
+
+@pytest.mark.parametrize("buffer_type,dtype", [
+    (juce.AudioBufferFloat, np.float32),
+    (juce.AudioBufferDouble, np.float64)
+])
+def test_buffer_protocol_shape_and_dtype(buffer_type, dtype):
+    buffer = buffer_type(2, 128)
+    array = np.asarray(buffer)
+
+    assert array.shape == (2, 128)
+    assert array.dtype == dtype
+    assert array.flags.writeable
+
+#==================================================================================================
+
+def test_buffer_protocol_is_zero_copy():
+    buffer = juce.AudioBufferFloat(3, 64)
+    buffer.clear()
+
+    array = np.asarray(buffer)
+    array[1, :] = 0.5
+    array[2, 10] = -1.0
+
+    assert buffer.getSample(0, 0) == 0.0
+    assert buffer.getSample(1, 63) == 0.5
+    assert buffer.getSample(2, 10) == -1.0
+    assert not buffer.hasBeenCleared()
+
+    buffer.setSample(0, 5, 0.25)
+    assert array[0, 5] == 0.25
+
+#==================================================================================================
+
+def test_buffer_protocol_padded_channels():
+    buffer = juce.AudioBufferFloat(2, 5)
+    buffer.clear()
+
+    array = np.asarray(buffer)
+    assert array.shape == (2, 5)
+    assert array.strides[1] == 4
+    assert array.strides[0] >= 5 * 4
+
+    array[:] = [[1, 2, 3, 4, 5], [6, 7, 8, 9, 10]]
+    assert buffer.getSample(1, 0) == 6.0
+    assert buffer.getSample(0, 4) == 5.0
+
+#==================================================================================================
+
+def test_buffer_protocol_vectorised_processing():
+    buffer = juce.AudioBufferFloat(2, 256)
+
+    array = np.asarray(buffer)
+    array[:] = np.sin(np.linspace(0, 2 * np.pi, 256, dtype=np.float32))[np.newaxis, :]
+    array *= 0.5
+
+    assert buffer.getMagnitude(0, 256) == pytest.approx(0.5, abs=1e-3)
+    assert buffer.getMagnitude(1, 0, 256) == pytest.approx(0.5, abs=1e-3)
+
+#==================================================================================================
+
+def test_buffer_protocol_empty():
+    buffer = juce.AudioBufferFloat()
+    array = np.asarray(buffer)
+
+    assert array.shape == (0, 0)
+    assert buffer.hasContiguousChannels()
+
+#==================================================================================================
+
+def test_refer_to_2d_array():
+    data = np.zeros((2, 100), dtype=np.float32)
+    buffer = juce.AudioBufferFloat(data)
+
+    assert buffer.getNumChannels() == 2
+    assert buffer.getNumSamples() == 100
+
+    data[1, 50] = 0.75
+    assert buffer.getSample(1, 50) == 0.75
+
+    buffer.setSample(0, 10, -0.5)
+    assert data[0, 10] == -0.5
+
+    assert np.shares_memory(np.asarray(buffer), data)
+
+#==================================================================================================
+
+def test_refer_to_keeps_data_alive():
+    buffer = juce.AudioBufferDouble(np.full((1, 32), 0.25, dtype=np.float64))
+    assert buffer.getSample(0, 31) == 0.25
+
+#==================================================================================================
+
+def test_refer_to_range():
+    data = np.arange(3 * 10, dtype=np.float32).reshape(3, 10)
+    buffer = juce.AudioBufferFloat(data, numChannelsToUse=2, startSample=4, numSamples=5)
+
+    assert buffer.getNumChannels() == 2
+    assert buffer.getNumSamples() == 5
+    assert buffer.getSample(0, 0) == 4.0
+    assert buffer.getSample(1, 4) == 18.0
+
+    with pytest.raises(ValueError):
+        juce.AudioBufferFloat(data, numChannelsToUse=4)
+
+    with pytest.raises(ValueError):
+        juce.AudioBufferFloat(data, startSample=8, numSamples=5)
+
+#==================================================================================================
+
+def test_refer_to_list_of_channels():
+    storage = np.zeros(256, dtype=np.float32)
+    channels = [storage[128:192], storage[0:64]]
+    buffer = juce.AudioBufferFloat(channels)
+
+    assert buffer.getNumChannels() == 2
+    assert buffer.getNumSamples() == 64
+    assert not buffer.hasContiguousChannels()
+
+    with pytest.raises(BufferError):
+        np.asarray(buffer)
+
+    buffer.setSample(1, 0, 1.0)
+    assert storage[0] == 1.0
+
+#==================================================================================================
+
+def test_refer_to_invalid_data():
+    with pytest.raises(TypeError):
+        juce.AudioBufferFloat(np.zeros((2, 10), dtype=np.float64))
+
+    with pytest.raises(ValueError):
+        juce.AudioBufferFloat(np.zeros((10, 2), dtype=np.float32).T)
+
+    readonly = np.zeros((2, 10), dtype=np.float32)
+    readonly.setflags(write=False)
+    with pytest.raises(BufferError):
+        juce.AudioBufferFloat(readonly)
+
+#==================================================================================================
+
+def test_set_data_to_refer_to():
+    buffer = juce.AudioBufferFloat(1, 16)
+
+    data = np.ones((2, 8), dtype=np.float32)
+    buffer.setDataToReferTo(data)
+
+    assert buffer.getNumChannels() == 2
+    assert buffer.getNumSamples() == 8
+    assert buffer.getSample(1, 7) == 1.0
+
+    buffer.applyGain(0.5)
+    assert np.all(data == 0.5)
+
+#==================================================================================================
+
+def test_set_data_to_refer_to_releases_previous_data():
+    buffer = juce.AudioBufferFloat(1, 16)
+
+    first = np.ones((2, 8), dtype=np.float32)
+    first_ref = weakref.ref(first)
+    buffer.setDataToReferTo(first)
+    del first
+    assert first_ref() is not None
+
+    second = np.zeros((1, 8), dtype=np.float32)
+    second_ref = weakref.ref(second)
+    buffer.setDataToReferTo(second)
+    del second
+    assert first_ref() is None
+    assert second_ref() is not None
+
+    buffer.setSize(2, 4)
+    assert second_ref() is None
+
+    buffer.setSample(1, 3, 1.0)
+    assert buffer.getSample(1, 3) == 1.0
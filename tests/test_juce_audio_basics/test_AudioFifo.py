@@ -0,0 +1,152 @@
+import ctypes
+import pytest
+import numpy as np
+
+import popsicle as juce
+
+#==================================================================================================
+
+AUDIO_PUSH = ctypes.CFUNCTYPE(ctypes.c_int,
+    ctypes.c_void_p, ctypes.POINTER(ctypes.POINTER(ctypes.c_float)), ctypes.c_int, ctypes.c_int)
+
+RECORD_POP = ctypes.CFUNCTYPE(ctypes.c_int, ctypes.c_void_p, ctypes.c_void_p, ctypes.c_int)
+
+#==================================================================================================
+
+def test_audio_fifo_push_and_pop():
+    fifo = juce.AudioFifo(2, 100)
+    assert fifo.getNumChannels() == 2
+    assert fifo.getCapacity() == 100
+    assert fifo.getFreeSpace() == 100
+    assert len(fifo) == 0
+
+    data = np.arange(120, dtype=np.float32).reshape(2, 60)
+    assert fifo.push(data) == 60
+    assert fifo.push(data) == 40
+    assert fifo.getNumReady() == 100
+    assert fifo.getFreeSpace() == 0
+
+    output = np.zeros((2, 50), dtype=np.float32)
+    assert fifo.popInto(output) == 50
+    assert np.all(output[:, :50] == data[:, :50])
+
+    output = fifo.popAll()
+    assert output.shape == (2, 50)
+    assert np.all(output[:, :10] == data[:, 50:])
+    assert np.all(output[:, 10:] == data[:, :40])
+    assert fifo.getNumReady() == 0
+
+#==================================================================================================
+
+def test_audio_fifo_channels():
+    fifo = juce.AudioFifo(2, 16)
+
+    assert fifo.push([np.ones(8, dtype=np.float32)]) == 8
+
+    output = fifo.popAll()
+    assert np.all(output[0] == 1.0)
+    assert np.all(output[1] == 0.0)
+
+    buffer = juce.AudioBufferFloat(2, 8)
+    buffer.clear()
+    buffer.setSample(1, 3, 0.5)
+    assert fifo.push(buffer) == 8
+
+    output = [np.zeros(8, dtype=np.float32)]
+    assert fifo.popInto(output) == 8
+    assert np.all(output[0] == 0.0)
+
+    with pytest.raises(TypeError):
+        fifo.push(np.zeros((2, 8), dtype=np.float64))
+
+#==================================================================================================
+
+def test_audio_fifo_native_push():
+    fifo = juce.AudioFifo(1, 32)
+    push = AUDIO_PUSH(juce.AudioFifo.pushFunction)
+
+    samples = (ctypes.c_float * 8)(*range(8))
+    channels = (ctypes.POINTER(ctypes.c_float) * 1)(ctypes.cast(samples, ctypes.POINTER(ctypes.c_float)))
+
+    assert push(fifo.address, channels, 1, 8) == 8
+    assert np.all(fifo.popAll()[0] == np.arange(8, dtype=np.float32))
+
+#==================================================================================================
+
+def test_record_fifo_push_and_pop():
+    fifo = juce.RecordFifo(4, 3)
+    assert fifo.getCapacity() == 4
+    assert fifo.getRecordSize() == 12
+    assert fifo.getRecordShape() == (3,)
+
+    assert fifo.push(np.array([1.0, 2.0, 3.0], dtype=np.float32)) == 1
+    assert fifo.push(np.arange(12, dtype=np.float32).reshape(4, 3)) == 3
+    assert len(fifo) == 4
+
+    records = fifo.popAll()
+    assert records.dtype == np.float32
+    assert records.shape == (4, 3)
+    assert np.all(records[0] == [1.0, 2.0, 3.0])
+    assert np.all(records[1:] == np.arange(9, dtype=np.float32).reshape(3, 3))
+
+    with pytest.raises(ValueError):
+        fifo.push(np.zeros(4, dtype=np.float32))
+
+    assert fifo.push(np.array([4, 5, 6], dtype=np.int32)) == 1
+    assert fifo.push([[7.5, 8.5, 9.5]]) == 1
+    assert np.all(fifo.popAll() == [[4.0, 5.0, 6.0], [7.5, 8.5, 9.5]])
+
+    fifo.push(np.zeros(3, dtype=np.float32))
+
+    with pytest.raises(TypeError):
+        fifo.popInto(np.zeros((1, 3), dtype=np.int32))
+
+    with pytest.raises(TypeError):
+        fifo.popInto(np.zeros((1, 3), dtype=np.float64))
+
+    assert len(fifo) == 1
+
+#==================================================================================================
+
+def test_record_fifo_invalid_shape():
+    with pytest.raises(ValueError):
+        juce.RecordFifo(4, 0)
+
+    with pytest.raises(ValueError):
+        juce.RecordFifo(4, (-1, -1))
+
+    with pytest.raises(ValueError):
+        juce.RecordFifo(4, (2, 0))
+
+#==================================================================================================
+
+def test_record_fifo_structured():
+    meter = np.dtype([("peak", np.float32), ("rms", np.float32), ("position", np.int64)])
+
+    fifo = juce.RecordFifo(8, (), dtype=meter)
+    assert fifo.getRecordSize() == meter.itemsize
+
+    readings = np.zeros(5, dtype=meter)
+    readings["peak"] = np.linspace(0.1, 0.5, 5)
+    readings["position"] = np.arange(5) * 512
+    assert fifo.push(readings) == 5
+
+    output = np.zeros(3, dtype=meter)
+    assert fifo.popInto(output) == 3
+    assert np.all(output["position"] == [0, 512, 1024])
+
+    output = fifo.popAll()
+    assert output.dtype == meter
+    assert np.all(output["position"] == [1536, 2048])
+
+#==================================================================================================
+
+def test_record_fifo_native_pop():
+    fifo = juce.RecordFifo(8, 2, dtype=np.int32)
+    fifo.push(np.array([[1, 2], [3, 4]], dtype=np.int32))
+
+    pop = RECORD_POP(juce.RecordFifo.popFunction)
+
+    output = np.zeros((4, 2), dtype=np.int32)
+    assert pop(fifo.address, output.ctypes.data, 4) == 2
+    assert np.all(output[:2] == [[1, 2], [3, 4]])
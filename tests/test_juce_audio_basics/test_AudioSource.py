@@ -0,0 +1,191 @@
+import pytest
+import numpy as np
+
+import popsicle as juce
+
+#==================================================================================================
+
+def fill(bufferToFill, value):
+    for channel in range(bufferToFill.buffer.getNumChannels()):
+        output = np.asarray(bufferToFill.buffer.getWritePointer(channel, bufferToFill.startSample))
+        output[:bufferToFill.numSamples] = value
+
+def make_constant_source_class():
+    class ConstantSource(juce.AudioSource):
+        def __init__(self, value):
+            juce.AudioSource.__init__(self)
+            self.value = value
+            self.calls = 0
+
+        def prepareToPlay(self, samplesPerBlockExpected, sampleRate):
+            pass
+
+        def releaseResources(self):
+            pass
+
+        def getNextAudioBlock(self, bufferToFill):
+            self.calls += 1
+            fill(bufferToFill, self.value)
+
+    return ConstantSource
+
+#==================================================================================================
+
+def test_override_dispatch_is_repeatable():
+    source = make_constant_source_class()(0.5)
+
+    output = juce.renderAudioSource(source, 1024, blockSize=64, numChannels=1)
+    assert source.calls == 16
+    assert np.all(output == 0.5)
+
+    output = juce.renderAudioSource(source, 1024, blockSize=64, numChannels=1)
+    assert source.calls == 32
+    assert np.all(output == 0.5)
+
+#==================================================================================================
+
+def test_override_dispatch_without_cache():
+    source = make_constant_source_class()(0.5)
+
+    assert juce.isOverrideCacheEnabled()
+
+    juce.setOverrideCacheEnabled(False)
+    try:
+        output = juce.renderAudioSource(source, 1024, blockSize=64, numChannels=1)
+    finally:
+        juce.setOverrideCacheEnabled(True)
+
+    assert source.calls == 16
+    assert np.all(output == 0.5)
+
+#==================================================================================================
+
+def test_override_follows_class_attribute_changes():
+    ConstantSource = make_constant_source_class()
+    source = ConstantSource(0.5)
+
+    output = juce.renderAudioSource(source, 128, blockSize=64, numChannels=1)
+    assert np.all(output == 0.5)
+
+    ConstantSource.getNextAudioBlock = lambda self, bufferToFill: fill(bufferToFill, -self.value)
+
+    output = juce.renderAudioSource(source, 128, blockSize=64, numChannels=1)
+    assert np.all(output == -0.5)
+
+    del ConstantSource.getNextAudioBlock
+
+    with pytest.raises(RuntimeError):
+        juce.renderAudioSource(source, 128, blockSize=64, numChannels=1)
+
+#==================================================================================================
+
+def test_override_follows_base_class_attribute_changes():
+    ConstantSource = make_constant_source_class()
+
+    class DerivedSource(ConstantSource):
+        pass
+
+    source = DerivedSource(0.25)
+
+    output = juce.renderAudioSource(source, 128, blockSize=64, numChannels=1)
+    assert np.all(output == 0.25)
+
+    ConstantSource.getNextAudioBlock = lambda self, bufferToFill: fill(bufferToFill, 1.0)
+
+    output = juce.renderAudioSource(source, 128, blockSize=64, numChannels=1)
+    assert np.all(output == 1.0)
+
+#==================================================================================================
+
+def test_override_on_instance_attribute():
+    source = make_constant_source_class()(0.5)
+
+    output = juce.renderAudioSource(source, 128, blockSize=64, numChannels=1)
+    assert np.all(output == 0.5)
+
+    source.getNextAudioBlock = lambda bufferToFill: fill(bufferToFill, 0.75)
+
+    output = juce.renderAudioSource(source, 128, blockSize=64, numChannels=1)
+    assert np.all(output == 0.75)
+
+    del source.getNextAudioBlock
+
+    output = juce.renderAudioSource(source, 128, blockSize=64, numChannels=1)
+    assert np.all(output == 0.5)
+
+#==================================================================================================
+
+def test_override_calling_base_implementation():
+    class HalfToneSource(juce.ToneGeneratorAudioSource):
+        def __init__(self):
+            juce.ToneGeneratorAudioSource.__init__(self)
+            self.calls = 0
+
+        def getNextAudioBlock(self, bufferToFill):
+            self.calls += 1
+            super().getNextAudioBlock(bufferToFill)
+            for channel in range(bufferToFill.buffer.getNumChannels()):
+                output = np.asarray(bufferToFill.buffer.getWritePointer(channel, bufferToFill.startSample))
+                output[:bufferToFill.numSamples] *= 0.5
+
+    tone = juce.ToneGeneratorAudioSource()
+    tone.setAmplitude(0.8)
+    tone.setFrequency(440.0)
+
+    half = HalfToneSource()
+    half.setAmplitude(0.8)
+    half.setFrequency(440.0)
+
+    expected = juce.renderAudioSource(tone, 1024, blockSize=128, numChannels=1)
+    output = juce.renderAudioSource(half, 1024, blockSize=128, numChannels=1)
+
+    assert half.calls == 8
+    assert np.allclose(output, expected * 0.5)
+
+#==================================================================================================
+
+def test_timing_stats_disabled_by_default():
+    source = make_constant_source_class()(0.5)
+    assert not source.isTimingEnabled()
+
+    juce.renderAudioSource(source, 256, blockSize=64, numChannels=1)
+
+    stats = source.getTimingStats()
+    assert stats["total"]["count"] == 0
+    assert stats["load"] == 0.0
+
+#==================================================================================================
+
+def test_timing_stats_recorded_per_block():
+    source = make_constant_source_class()(0.5)
+    source.setTimingEnabled(True)
+    assert source.isTimingEnabled()
+
+    juce.renderAudioSource(source, 1024, blockSize=64, sampleRate=48000.0, numChannels=1)
+
+    stats = source.getTimingStats()
+    for key in ("gil", "python", "total"):
+        assert stats[key]["count"] == 16
+        assert 0.0 <= stats[key]["p50"] <= stats[key]["p90"] <= stats[key]["p99"] <= stats[key]["p999"] <= stats[key]["max"]
+
+    assert stats["total"]["max"] >= stats["python"]["max"]
+    assert stats["total"]["mean"] > 0.0
+    assert stats["load"] >= 0.0
+    assert stats["xruns"] >= 0
+
+    source.resetTimingStats()
+
+    stats = source.getTimingStats()
+    for key in ("gil", "python", "total"):
+        assert stats[key]["count"] == 0
+        assert stats[key]["max"] == 0.0
+
+#==================================================================================================
+
+def test_timing_stats_unavailable_on_native_sources():
+    tone = juce.ToneGeneratorAudioSource()
+    assert not tone.isTimingEnabled()
+    assert tone.getTimingStats() is None
+
+    with pytest.raises(TypeError):
+        tone.setTimingEnabled(True)
@@ -0,0 +1,151 @@
+import ctypes
+import pytest
+import numpy as np
+
+import popsicle as juce
+
+fvo = juce.FloatVectorOperations
+
+#==================================================================================================
+
+@pytest.fixture(params=[np.float32, np.float64])
+def dtype(request):
+    return request.param
+
+#==================================================================================================
+
+def test_fill_and_clear(dtype):
+    data = np.ones(100, dtype=dtype)
+    fvo.fill(data, 0.5)
+    assert np.all(data == 0.5)
+
+    fvo.clear(data)
+    assert np.all(data == 0.0)
+
+#==================================================================================================
+
+def test_add_overloads(dtype):
+    dest = np.zeros(16, dtype=dtype)
+    src = np.arange(16, dtype=dtype)
+
+    fvo.add(dest, 1.0)
+    assert np.all(dest == 1.0)
+
+    fvo.add(dest, src)
+    assert np.array_equal(dest, src + 1.0)
+
+    fvo.add(dest, src, 2.0)
+    assert np.array_equal(dest, src + 2.0)
+
+    fvo.add(dest, src, src)
+    assert np.array_equal(dest, src * 2.0)
+
+#==================================================================================================
+
+def test_multiply_and_add_with_multiply(dtype):
+    dest = np.ones(64, dtype=dtype)
+    src = np.full(64, 3.0, dtype=dtype)
+
+    fvo.multiply(dest, 2.0)
+    assert np.all(dest == 2.0)
+
+    fvo.multiply(dest, src)
+    assert np.all(dest == 6.0)
+
+    fvo.addWithMultiply(dest, src, 0.5)
+    assert np.all(dest == 7.5)
+
+    fvo.copyWithMultiply(dest, src, -1.0)
+    assert np.all(dest == -3.0)
+
+#==================================================================================================
+
+def test_abs_negate_clip_min_max(dtype):
+    src = np.linspace(-2.0, 2.0, 41, dtype=dtype)
+    dest = np.empty_like(src)
+
+    fvo.abs(dest, src)
+    assert np.allclose(dest, np.abs(src))
+
+    fvo.negate(dest, src)
+    assert np.allclose(dest, -src)
+
+    fvo.clip(dest, src, -1.0, 1.0)
+    assert np.allclose(dest, np.clip(src, -1.0, 1.0))
+
+    fvo.min(dest, src, 0.0)
+    assert np.allclose(dest, np.minimum(src, 0.0))
+
+    fvo.max(dest, src, 0.0)
+    assert np.allclose(dest, np.maximum(src, 0.0))
+
+#==================================================================================================
+
+def test_reductions(dtype):
+    src = np.array([0.5, -3.0, 2.0, 1.0], dtype=dtype)
+
+    assert fvo.findMinAndMax(src) == (-3.0, 2.0)
+    assert fvo.findMinimum(src) == -3.0
+    assert fvo.findMaximum(src) == 2.0
+
+#==================================================================================================
+
+def test_in_place_on_audio_buffer():
+    buffer = juce.AudioBufferFloat(2, 256)
+    buffer.clear()
+
+    fvo.fill(buffer.getWritePointer(1), 0.25)
+    assert buffer.getSample(1, 255) == 0.25
+    assert buffer.getSample(0, 0) == 0.0
+
+    fvo.fill(np.asarray(buffer)[0], 0.5)
+    assert buffer.getSample(0, 128) == 0.5
+
+#==================================================================================================
+
+def test_large_sizes_release_the_gil():
+    dest = np.zeros(1 << 16, dtype=np.float32)
+    src = np.ones(1 << 16, dtype=np.float32)
+
+    fvo.addWithMultiply(dest, src, 2.0)
+    assert np.all(dest == 2.0)
+
+#==================================================================================================
+
+def test_convert_fixed_to_float():
+    src = np.array([0, 16384, -32768], dtype=np.int32)
+    dest = np.zeros(3, dtype=np.float32)
+
+    fvo.convertFixedToFloat(dest, src, 1.0 / 32768.0)
+    assert np.allclose(dest, [0.0, 0.5, -1.0])
+
+def test_convert_fixed_to_float_from_any_int32_format():
+    src = (ctypes.c_int32 * 3)(0, 16384, -32768)
+    assert memoryview(src).format != "i"
+
+    dest = np.zeros(3, dtype=np.float32)
+    fvo.convertFixedToFloat(dest, src, 1.0 / 32768.0)
+    assert np.allclose(dest, [0.0, 0.5, -1.0])
+
+    with pytest.raises(TypeError):
+        fvo.convertFixedToFloat(dest, np.zeros(3, dtype=np.uint32), 1.0)
+
+#==================================================================================================
+
+def test_invalid_operands():
+    with pytest.raises(TypeError):
+        fvo.fill(np.zeros(4, dtype=np.int32), 1.0)
+
+    with pytest.raises(TypeError):
+        fvo.add(np.zeros(4, dtype=np.float32), np.zeros(4, dtype=np.float64))
+
+    with pytest.raises(ValueError):
+        fvo.add(np.zeros(8, dtype=np.float32), np.zeros(4, dtype=np.float32))
+
+    with pytest.raises(ValueError):
+        fvo.fill(np.zeros(8, dtype=np.float32)[::2], 1.0)
+
+    readonly = np.zeros(4, dtype=np.float32)
+    readonly.setflags(write=False)
+    with pytest.raises(BufferError):
+        fvo.fill(readonly, 1.0)
@@ -0,0 +1,95 @@
+import pytest
+import numpy as np
+
+import popsicle as juce
+
+#==================================================================================================
+
+def make_buffer():
+    buffer = juce.MidiBuffer()
+    buffer.addEvent(juce.MidiMessage.noteOn(1, 60, 100), 0)
+    buffer.addEvent(juce.MidiMessage.controllerEvent(1, 7, 64), 10)
+    buffer.addEvent(juce.MidiMessage.noteOff(1, 60), 20)
+    return buffer
+
+#==================================================================================================
+
+def test_add_events():
+    buffer = make_buffer()
+    assert len(buffer) == 3
+    assert not buffer.isEmpty()
+    assert buffer.getFirstEventTime() == 0
+    assert buffer.getLastEventTime() == 20
+
+    messages = buffer.getMessages()
+    assert [message.getTimeStamp() for message in messages] == [0.0, 10.0, 20.0]
+    assert messages[0].isNoteOn()
+    assert messages[2].isNoteOff()
+
+    assert list(buffer)[1] == (bytes([0xb0, 7, 64]), 10)
+
+    buffer.clear(5, 10)
+    assert len(buffer) == 2
+
+#==================================================================================================
+
+def test_to_array():
+    buffer = make_buffer()
+    buffer.addEvent(juce.MidiMessage.createSysExMessage(bytes([1, 2, 3, 4])), 30)
+
+    records = buffer.toArray()
+    assert records.dtype == juce.getMidiEventDtype()
+    assert len(records) == 3
+    assert list(records["timestamp"]) == [0.0, 10.0, 20.0]
+    assert list(records["status"]) == [0x90, 0xb0, 0x80]
+    assert list(records["data1"]) == [60, 7, 60]
+    assert list(records["data2"]) == [100, 64, 0]
+
+#==================================================================================================
+
+def test_from_array():
+    records = np.zeros(1000, dtype=juce.getMidiEventDtype())
+    records["timestamp"] = np.arange(1000)
+    records["status"] = 0x90
+    records["data1"] = np.arange(1000) % 128
+    records["data2"] = 100
+
+    buffer = juce.MidiBuffer.fromArray(records)
+    assert len(buffer) == 1000
+    assert buffer.getLastEventTime() == 999
+
+    assert np.all(buffer.toArray() == records)
+
+    buffer.addEventsFromArray(records[:10], sampleDeltaToAdd=2000)
+    assert len(buffer) == 1010
+    assert buffer.getLastEventTime() == 2009
+
+#==================================================================================================
+
+def test_from_array_with_short_messages():
+    records = np.zeros(2, dtype=juce.getMidiEventDtype())
+    records[0] = (5.0, 0xc0, 12, 99)
+    records[1] = (6.0, 0xf8, 0, 0)
+
+    buffer = juce.MidiBuffer.fromArray(records)
+    assert list(buffer) == [(bytes([0xc0, 12]), 5), (bytes([0xf8]), 6)]
+
+#==================================================================================================
+
+def test_from_array_skips_invalid_status():
+    records = np.zeros(3, dtype=juce.getMidiEventDtype())
+    records[0] = (0.0, 0x40, 1, 2)
+    records[1] = (1.0, 0xf0, 1, 2)
+    records[2] = (2.0, 0x90, 60, 1)
+
+    buffer = juce.MidiBuffer.fromArray(records)
+    assert list(buffer) == [(bytes([0x90, 60, 1]), 2)]
+
+#==================================================================================================
+
+def test_from_packed_array():
+    packed = np.dtype([("timestamp", "<f8"), ("status", "u1"), ("data1", "u1"), ("data2", "u1")])
+    records = np.array([(3.0, 0x90, 64, 90)], dtype=packed)
+
+    buffer = juce.MidiBuffer.fromArray(records)
+    assert list(buffer) == [(bytes([0x90, 64, 90]), 3)]
@@ -0,0 +1,175 @@
+import pytest
+import numpy as np
+
+import popsicle as juce
+
+#==================================================================================================
+
+NOTE_ON = 0x90
+NOTE_OFF = 0x80
+CONTROLLER = 0xb0
+META = 0xff
+
+def make_tempo_track():
+    return {
+        "ticks": np.array([0, 0], dtype=np.int64),
+        "type": np.array([META, META], dtype=np.uint8),
+        "meta": np.array([0x51, 0x58], dtype=np.uint8),
+        "value": np.array([500000, 4 * 256 + 4], dtype=np.int32),
+    }
+
+def make_note_track():
+    return {
+        "ticks": np.array([0, 0, 960, 960, 1920], dtype=np.int64),
+        "type": np.array([CONTROLLER, NOTE_ON, NOTE_OFF, NOTE_ON, NOTE_OFF], dtype=np.uint8),
+        "channel": np.array([2, 2, 2, 2, 2], dtype=np.uint8),
+        "note": np.array([0, 60, 60, 64, 64], dtype=np.uint8),
+        "velocity": np.array([0, 100, 0, 90, 0], dtype=np.uint8),
+        "controller": np.array([7, 0, 0, 0, 0], dtype=np.uint8),
+        "value": np.array([110, 0, 0, 0, 0], dtype=np.int32),
+    }
+
+def channel_events(track):
+    mask = track["type"] < 0xf0
+    return { key: column[mask] for key, column in track.items() }
+
+#==================================================================================================
+
+def test_write_tables_returns_bytes():
+    data = juce.MidiFile.writeTables([make_tempo_track(), make_note_track()], timeFormat=960)
+    assert isinstance(data, bytes)
+    assert data[:4] == b"MThd"
+
+#==================================================================================================
+
+def test_read_tables_from_bytes():
+    data = juce.MidiFile.writeTables([make_tempo_track(), make_note_track()], timeFormat=960)
+
+    result = juce.MidiFile.readTables(data)
+    assert result["timeFormat"] == 960
+    assert result["midiFileType"] == 1
+    assert len(result["tracks"]) == 2
+
+    track = channel_events(result["tracks"][1])
+    assert track["ticks"].dtype == np.int64
+    assert track["seconds"].dtype == np.float64
+    assert track["type"].dtype == np.uint8
+    assert track["value"].dtype == np.int32
+
+    assert list(track["ticks"]) == [0, 0, 960, 960, 1920]
+    assert list(track["type"]) == [CONTROLLER, NOTE_ON, NOTE_OFF, NOTE_ON, NOTE_OFF]
+    assert list(track["channel"]) == [2, 2, 2, 2, 2]
+    assert list(track["note"]) == [0, 60, 60, 64, 64]
+    assert list(track["velocity"]) == [0, 100, 0, 90, 0]
+    assert track["controller"][0] == 7
+    assert track["value"][0] == 110
+
+#==================================================================================================
+
+def test_read_tables_computes_seconds_from_tempo():
+    data = juce.MidiFile.writeTables([make_tempo_track(), make_note_track()], timeFormat=960)
+
+    result = juce.MidiFile.readTables(data)
+    track = channel_events(result["tracks"][1])
+    assert np.allclose(track["seconds"], [0.0, 0.0, 0.5, 0.5, 1.0])
+
+    tempo = result["tracks"][0]
+    tempo_rows = (tempo["type"] == META) & (tempo["meta"] == 0x51)
+    assert list(tempo["value"][tempo_rows]) == [500000]
+
+    time_signature_rows = (tempo["type"] == META) & (tempo["meta"] == 0x58)
+    assert list(tempo["value"][time_signature_rows]) == [4 * 256 + 4]
+
+#==================================================================================================
+
+def test_round_trip_through_file(tmp_path):
+    path = tmp_path / "test.mid"
+
+    assert juce.MidiFile.writeTables([make_tempo_track(), make_note_track()], path, timeFormat=480) is None
+    assert path.exists()
+
+    for source in (path, str(path), juce.File(str(path))):
+        result = juce.MidiFile.readTables(source)
+        assert result["timeFormat"] == 480
+        assert list(channel_events(result["tracks"][1])["note"]) == [0, 60, 60, 64, 64]
+
+#==================================================================================================
+
+def test_round_trip_smpte_time_format():
+    timeFormat = (-25 << 8) | 40
+
+    data = juce.MidiFile.writeTables([make_note_track()], timeFormat=timeFormat)
+    assert juce.MidiFile.readTables(data)["timeFormat"] == timeFormat
+
+    midiFile = juce.MidiFile()
+    assert midiFile.readFrom(juce.MemoryInputStream(data, False))[0]
+    assert midiFile.getTimeFormat() == timeFormat
+
+#==================================================================================================
+
+def test_write_tables_errors(tmp_path):
+    tracks = [make_tempo_track(), make_note_track()]
+
+    for destination in (None, tmp_path / "test.mid"):
+        with pytest.raises(ValueError):
+            juce.MidiFile.writeTables(tracks, destination, midiFileType=3)
+
+        with pytest.raises(ValueError):
+            juce.MidiFile.writeTables(tracks, destination, timeFormat=0)
+
+    with pytest.raises(ValueError):
+        juce.MidiFile.writeTables(tracks, tmp_path / "missing" / "test.mid")
+
+#==================================================================================================
+
+def test_write_tables_with_missing_columns():
+    with pytest.raises(KeyError):
+        juce.MidiFile.writeTables([{ "ticks": np.array([0]) }])
+
+    data = juce.MidiFile.writeTables([{ "ticks": [0, 10], "type": [NOTE_ON, NOTE_OFF], "note": [72, 72], "velocity": [80, 0] }])
+    track = channel_events(juce.MidiFile.readTables(data)["tracks"][0])
+    assert list(track["channel"]) == [1, 1]
+    assert list(track["note"]) == [72, 72]
+
+#==================================================================================================
+
+def test_write_tables_with_mismatched_columns():
+    with pytest.raises(ValueError):
+        juce.MidiFile.writeTables([{ "ticks": [0, 10], "type": [NOTE_ON] }])
+
+#==================================================================================================
+
+def test_read_tables_invalid_source():
+    with pytest.raises(ValueError):
+        juce.MidiFile.readTables(b"definitely not a midi file")
+
+    with pytest.raises(TypeError):
+        juce.MidiFile.readTables(12345)
+
+#==================================================================================================
+
+def test_midi_file_api():
+    data = juce.MidiFile.writeTables([make_tempo_track(), make_note_track()], timeFormat=960)
+
+    midiFile = juce.MidiFile()
+    success, midiFileType = midiFile.readFrom(juce.MemoryInputStream(data, False))
+    assert success
+    assert midiFileType == 1
+    assert midiFile.getNumTracks() == 2
+    assert midiFile.getTimeFormat() == 960
+    assert midiFile.getLastTimestamp() == 1920.0
+
+    assert midiFile.findAllTempoEvents().getNumEvents() == 1
+    assert midiFile.findAllTimeSigEvents().getNumEvents() == 1
+
+    midiFile.convertTimestampTicksToSeconds()
+    assert midiFile.getLastTimestamp() == pytest.approx(1.0)
+
+    output = juce.MemoryOutputStream()
+    assert midiFile.writeTo(output)
+    assert output.getDataSize() > 0
+
+    copied = juce.MidiFile(midiFile)
+    copied.clear()
+    assert copied.getNumTracks() == 0
+    assert midiFile.getNumTracks() == 2
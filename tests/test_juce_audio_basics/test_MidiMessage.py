@@ -0,0 +1,99 @@
+import pytest
+
+import popsicle as juce
+
+#==================================================================================================
+
+def test_construct_from_bytes():
+    message = juce.MidiMessage(0x90, 60, 100)
+    assert message.getRawData() == bytes([0x90, 60, 100])
+    assert message.getRawDataSize() == 3
+    assert message.getTimeStamp() == 0.0
+
+    message = juce.MidiMessage(bytes([0x80, 64, 0]), 1.5)
+    assert message.isNoteOff()
+    assert message.getTimeStamp() == 1.5
+
+    message = juce.MidiMessage(0xc0, 5)
+    assert message.isProgramChange()
+    assert message.getProgramChangeNumber() == 5
+
+#==================================================================================================
+
+def test_note_messages():
+    message = juce.MidiMessage.noteOn(1, 60, 0.5)
+    assert message.isNoteOn()
+    assert message.isNoteOnOrOff()
+    assert message.getChannel() == 1
+    assert message.getNoteNumber() == 60
+    assert message.getFloatVelocity() == pytest.approx(0.5, abs=0.01)
+
+    message = juce.MidiMessage.noteOn(2, 64, 100)
+    assert message.getVelocity() == 100
+    assert message.isForChannel(2)
+
+    message.setNoteNumber(65)
+    message.setChannel(3)
+    assert message.getNoteNumber() == 65
+    assert message.getChannel() == 3
+
+    message = juce.MidiMessage.noteOff(1, 60)
+    assert message.isNoteOff()
+    assert not message.isNoteOn()
+
+    assert juce.MidiMessage.noteOn(1, 60, 0).isNoteOff()
+    assert not juce.MidiMessage.noteOn(1, 60, 0).isNoteOn()
+
+#==================================================================================================
+
+def test_controller_messages():
+    message = juce.MidiMessage.controllerEvent(1, 7, 99)
+    assert message.isController()
+    assert message.isControllerOfType(7)
+    assert message.getControllerValue() == 99
+
+    assert juce.MidiMessage.pitchWheel(1, 12000).getPitchWheelValue() == 12000
+    assert juce.MidiMessage.allNotesOff(1).isAllNotesOff()
+    assert juce.MidiMessage.channelPressureChange(1, 42).getChannelPressureValue() == 42
+    assert juce.MidiMessage.aftertouchChange(1, 60, 33).getAfterTouchValue() == 33
+
+#==================================================================================================
+
+def test_meta_and_sysex_messages():
+    tempo = juce.MidiMessage.tempoMetaEvent(500000)
+    assert tempo.isMetaEvent()
+    assert tempo.isTempoMetaEvent()
+    assert tempo.getTempoSecondsPerQuarterNote() == pytest.approx(0.5)
+
+    signature = juce.MidiMessage.timeSignatureMetaEvent(3, 4)
+    assert signature.getTimeSignatureInfo() == (3, 4)
+
+    text = juce.MidiMessage.textMetaEvent(3, "Piano")
+    assert text.isTrackNameEvent()
+    assert text.getTextFromTextMetaEvent() == "Piano"
+
+    sysex = juce.MidiMessage.createSysExMessage(bytes([0x7e, 0x00, 0x06, 0x01]))
+    assert sysex.isSysEx()
+    assert sysex.getSysExData() == bytes([0x7e, 0x00, 0x06, 0x01])
+
+#==================================================================================================
+
+def test_timestamps():
+    message = juce.MidiMessage.noteOn(1, 60, 0.5)
+    message.setTimeStamp(10.0)
+    message.addToTimeStamp(2.5)
+    assert message.getTimeStamp() == 12.5
+
+    other = message.withTimeStamp(1.0)
+    assert other.getTimeStamp() == 1.0
+    assert message.getTimeStamp() == 12.5
+
+#==================================================================================================
+
+def test_static_helpers():
+    assert juce.MidiMessage.getMidiNoteInHertz(69) == pytest.approx(440.0)
+    assert juce.MidiMessage.getMidiNoteName(60, True, True, 3) == "C3"
+    assert juce.MidiMessage.isMidiNoteBlack(61)
+    assert juce.MidiMessage.getMessageLengthFromFirstByte(0x90) == 3
+    assert juce.MidiMessage.getMessageLengthFromFirstByte(0xc0) == 2
+    assert juce.MidiMessage.getGMInstrumentName(0) == "Acoustic Grand Piano"
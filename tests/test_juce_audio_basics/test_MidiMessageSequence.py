@@ -0,0 +1,68 @@
+import pytest
+import numpy as np
+
+import popsicle as juce
+
+#==================================================================================================
+
+def test_add_events():
+    sequence = juce.MidiMessageSequence()
+    sequence.addEvent(juce.MidiMessage.noteOn(1, 60, 0.5).withTimeStamp(1.0))
+    sequence.addEvent(juce.MidiMessage.noteOff(1, 60).withTimeStamp(2.0))
+    sequence.addEvent(juce.MidiMessage.noteOn(1, 64, 0.5), 0.5)
+    assert len(sequence) == 3
+    assert sequence.getStartTime() == 0.5
+    assert sequence.getEndTime() == 2.0
+
+    sequence.updateMatchedPairs()
+    assert sequence.getTimeOfMatchingKeyUp(1) == 2.0
+    assert sequence[1].noteOffObject.message.isNoteOff()
+
+    assert [event.message.getTimeStamp() for event in sequence] == [0.5, 1.0, 2.0]
+    assert sequence[-1].message.isNoteOff()
+
+    with pytest.raises(IndexError):
+        sequence[3]
+
+#==================================================================================================
+
+def test_edit_events():
+    sequence = juce.MidiMessageSequence()
+    for index in range(4):
+        sequence.addEvent(juce.MidiMessage.controllerEvent(1, 7, index * 10).withTimeStamp(float(index)))
+
+    sequence.addTimeToMessages(10.0)
+    assert sequence.getStartTime() == 10.0
+
+    sequence.deleteEvent(0, False)
+    assert len(sequence) == 3
+
+    updates = sequence.createControllerUpdatesForTime(1, 20.0)
+    assert len(updates) == 1
+    assert updates[0].getControllerValue() == 30
+
+    other = juce.MidiMessageSequence()
+    other.addSequence(sequence, 5.0)
+    assert other.getStartTime() == 16.0
+
+#==================================================================================================
+
+def test_to_and_from_array():
+    sequence = juce.MidiMessageSequence()
+    sequence.addEvent(juce.MidiMessage.tempoMetaEvent(500000))
+    sequence.addEvent(juce.MidiMessage.noteOn(2, 60, 100).withTimeStamp(0.25))
+    sequence.addEvent(juce.MidiMessage.noteOff(2, 60).withTimeStamp(0.75))
+
+    records = sequence.toArray()
+    assert len(records) == 2
+    assert list(records["timestamp"]) == [0.25, 0.75]
+    assert list(records["status"]) == [0x91, 0x81]
+
+    copy = juce.MidiMessageSequence.fromArray(records)
+    assert len(copy) == 2
+    assert copy.getTimeOfMatchingKeyUp(0) == 0.75
+    assert np.all(copy.toArray() == records)
+
+    sequence.addEventsFromArray(records, timeAdjustment=1.0)
+    assert len(sequence) == 5
+    assert sequence.getEndTime() == 1.75
@@ -0,0 +1,48 @@
+import ctypes
+import pytest
+
+import popsicle as juce
+
+#==================================================================================================
+
+PROCESS = ctypes.CFUNCTYPE(None,
+    ctypes.c_void_p,
+    ctypes.POINTER(ctypes.POINTER(ctypes.c_float)), ctypes.c_int,
+    ctypes.c_int, ctypes.c_int)
+
+PREPARE = ctypes.CFUNCTYPE(None, ctypes.c_void_p, ctypes.c_int, ctypes.c_double)
+
+#==================================================================================================
+
+def test_native_audio_source():
+    prepared = []
+
+    @PREPARE
+    def prepare(userData, samplesPerBlockExpected, sampleRate):
+        prepared.append((samplesPerBlockExpected, sampleRate))
+
+    @PROCESS
+    def process(userData, channels, numChannels, startSample, numSamples):
+        for channel in range(numChannels):
+            for sample in range(startSample, startSample + numSamples):
+                channels[channel][sample] = 0.25
+
+    source = juce.NativeAudioSource(process, prepare=prepare)
+    source.prepareToPlay(32, 44100.0)
+    assert prepared == [(32, 44100.0)]
+
+    buffer = juce.AudioBufferFloat(2, 32)
+    buffer.clear()
+    source.getNextAudioBlock(juce.AudioSourceChannelInfo(buffer, 8, 16))
+
+    for channel in range(2):
+        assert buffer.getSample(channel, 7) == 0.0
+        assert buffer.getSample(channel, 8) == pytest.approx(0.25)
+        assert buffer.getSample(channel, 23) == pytest.approx(0.25)
+        assert buffer.getSample(channel, 24) == 0.0
+
+#==================================================================================================
+
+def test_invalid_function_object():
+    with pytest.raises(TypeError):
+        juce.NativeAudioSource("not a function")
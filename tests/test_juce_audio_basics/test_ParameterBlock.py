@@ -0,0 +1,172 @@
+import ctypes
+import pytest
+import numpy as np
+
+import popsicle as juce
+
+#==================================================================================================
+
+PROCESS = ctypes.CFUNCTYPE(None,
+    ctypes.c_void_p,
+    ctypes.POINTER(ctypes.POINTER(ctypes.c_float)), ctypes.c_int,
+    ctypes.c_int, ctypes.c_int)
+
+GET_VALUE = ctypes.CFUNCTYPE(ctypes.c_float, ctypes.c_void_p, ctypes.c_int)
+
+FILL_SMOOTHED_VALUES = ctypes.CFUNCTYPE(None, ctypes.c_void_p, ctypes.c_int, ctypes.POINTER(ctypes.c_float), ctypes.c_int)
+
+#==================================================================================================
+
+def test_construct():
+    block = juce.ParameterBlock({ "gain": 0.5, "pan": -1.0 })
+    assert len(block) == 2
+    assert block.getNumParameters() == 2
+    assert list(block.getParameterNames()) == ["gain", "pan"]
+    assert block.getParameterIndex("pan") == 1
+    assert block.getParameterIndex("cutoff") == -1
+    assert "gain" in block
+    assert "cutoff" not in block
+    assert block["gain"] == 0.5
+    assert block[1] == -1.0
+
+    block = juce.ParameterBlock(["a", "b", "c"])
+    assert block.getValues() == { "a": 0.0, "b": 0.0, "c": 0.0 }
+
+    with pytest.raises(ValueError):
+        juce.ParameterBlock(["a", "a"])
+
+    with pytest.raises(ValueError):
+        juce.ParameterBlock([""])
+
+#==================================================================================================
+
+def test_set_values():
+    block = juce.ParameterBlock(["gain", "pan"])
+
+    block["gain"] = 0.25
+    assert block.getValue("gain") == 0.25
+
+    block.setValue(1, 0.75)
+    assert block["pan"] == 0.75
+
+    block.setValues({ "gain": 1.0, "pan": 0.0 })
+    assert block.getValues() == { "gain": 1.0, "pan": 0.0 }
+
+    with pytest.raises(KeyError):
+        block["cutoff"] = 1.0
+
+    with pytest.raises(IndexError):
+        block.getValue(2)
+
+#==================================================================================================
+
+def test_many_parameters_are_contiguous():
+    names = [f"p{i}" for i in range(40)]
+    block = juce.ParameterBlock(names)
+
+    for index in range(40):
+        block[index] = float(index)
+
+    assert block.valuesAddress % 64 == 0
+
+    values = (ctypes.c_float * 40).from_address(block.valuesAddress)
+    assert list(values) == [float(i) for i in range(40)]
+
+#==================================================================================================
+
+def test_without_smoothing():
+    block = juce.ParameterBlock({ "gain": 0.0 })
+
+    block["gain"] = 1.0
+    assert not block.isSmoothing("gain")
+    assert block.getNextValue("gain") == 1.0
+
+    output = np.zeros(16, dtype=np.float32)
+    block.fillSmoothedValues("gain", output)
+    assert np.all(output == 1.0)
+
+#==================================================================================================
+
+def test_linear_smoothing():
+    block = juce.ParameterBlock({ "gain": 0.0 })
+    block.prepare(1000.0)
+    block.setSmoothingTime("gain", 0.01)
+    assert block.getSmoothingTime("gain") == pytest.approx(0.01)
+
+    block["gain"] = 1.0
+    assert block.isSmoothing("gain")
+
+    output = np.zeros(16, dtype=np.float32)
+    block.fillSmoothedValues("gain", output)
+    assert np.allclose(output[:10], np.linspace(0.1, 1.0, 10))
+    assert np.all(output[10:] == 1.0)
+    assert not block.isSmoothing("gain")
+
+    block["gain"] = 0.0
+    assert block.skip("gain", 5) == pytest.approx(0.5)
+    assert block.getNextValue("gain") == pytest.approx(0.4)
+
+    with pytest.raises(ValueError):
+        block.fillSmoothedValues("gain", np.zeros(4, dtype=np.float64))
+
+    with pytest.raises(ValueError):
+        block.fillSmoothedValues("gain", output, 32)
+
+#==================================================================================================
+
+def test_smoothing_all_parameters():
+    block = juce.ParameterBlock(["a", "b"])
+    block.setSmoothingTime(None, 0.5)
+    assert block.getSmoothingTime("a") == 0.5
+    assert block.getSmoothingTime("b") == 0.5
+
+#==================================================================================================
+
+def test_native_functions():
+    block = juce.ParameterBlock({ "gain": 0.0 })
+    block.prepare(100.0)
+    block.setSmoothingTime("gain", 0.04)
+    block["gain"] = 1.0
+
+    get_value = GET_VALUE(juce.ParameterBlock.getValueFunction)
+    get_next_value = GET_VALUE(juce.ParameterBlock.getNextValueFunction)
+    fill_smoothed_values = FILL_SMOOTHED_VALUES(juce.ParameterBlock.fillSmoothedValuesFunction)
+
+    assert get_value(block.address, 0) == 1.0
+    assert get_next_value(block.address, 0) == pytest.approx(0.25)
+
+    output = (ctypes.c_float * 4)()
+    fill_smoothed_values(block.address, 0, output, 4)
+    assert list(output) == pytest.approx([0.5, 0.75, 1.0, 1.0])
+
+    for index in (-1, 1, 1000):
+        assert get_value(block.address, index) == 0.0
+        assert get_next_value(block.address, index) == 0.0
+
+        output = (ctypes.c_float * 4)(1.0, 1.0, 1.0, 1.0)
+        fill_smoothed_values(block.address, index, output, 4)
+        assert list(output) == [0.0, 0.0, 0.0, 0.0]
+
+#==================================================================================================
+
+def test_read_from_native_audio_source():
+    block = juce.ParameterBlock({ "gain": 0.5 })
+    get_value = GET_VALUE(juce.ParameterBlock.getValueFunction)
+
+    @PROCESS
+    def process(userData, channels, numChannels, startSample, numSamples):
+        gain = get_value(userData, 0)
+        for channel in range(numChannels):
+            for sample in range(startSample, startSample + numSamples):
+                channels[channel][sample] = gain
+
+    source = juce.NativeAudioSource(process, userData=block)
+    assert source.getUserData() == block.address
+
+    output = juce.renderAudioSource(source, 64, blockSize=32, numChannels=1)
+    assert np.all(output == 0.5)
+
+    block["gain"] = 0.25
+
+    output = juce.renderAudioSource(source, 64, blockSize=32, numChannels=1)
+    assert np.all(output == 0.25)
@@ -0,0 +1,253 @@
+import pytest
+import numpy as np
+
+import popsicle as juce
+
+#==================================================================================================
+
+SAMPLE_RATE = 48000.0
+BLOCK_SIZE = 480
+
+def make_synth(voice_factory, num_voices=4, sound=None):
+    synth = juce.Synthesiser()
+    for _ in range(num_voices):
+        synth.addVoice(voice_factory())
+
+    synth.addSound(sound or juce.SimpleSynthesiserSound())
+    synth.setCurrentPlaybackSampleRate(SAMPLE_RATE)
+    return synth
+
+def render(synth, midi_buffer=None, num_samples=BLOCK_SIZE, num_channels=2):
+    buffer = juce.AudioBufferFloat(num_channels, num_samples)
+    buffer.clear()
+
+    synth.renderNextBlock(buffer, midi_buffer or juce.MidiBuffer(), 0, num_samples)
+    return np.array(buffer)
+
+def note_on_buffer(note, velocity=1.0, position=0):
+    midi = juce.MidiBuffer()
+    midi.addEvent(juce.MidiMessage.noteOn(1, note, velocity), position)
+    return midi
+
+def dominant_frequency(samples):
+    spectrum = np.abs(np.fft.rfft(samples * np.hanning(len(samples))))
+    return np.argmax(spectrum) * SAMPLE_RATE / len(samples)
+
+#==================================================================================================
+
+def test_silent_without_notes():
+    synth = make_synth(juce.SineVoice)
+    assert np.all(render(synth) == 0.0)
+
+#==================================================================================================
+
+def test_sine_voice_renders_note():
+    synth = make_synth(juce.SineVoice)
+
+    output = render(synth, note_on_buffer(69), num_samples=4800)
+    assert np.max(np.abs(output)) > 0.1
+    assert np.array_equal(output[0], output[1])
+    assert dominant_frequency(output[0]) == pytest.approx(440.0, abs=10.0)
+
+    voices = [synth.getVoice(i) for i in range(synth.getNumVoices())]
+    assert sum(v.getCurrentlyPlayingNote() == 69 for v in voices) == 1
+
+#==================================================================================================
+
+def test_sine_voice_release():
+    synth = make_synth(juce.SineVoice, num_voices=1)
+    voice = synth.getVoice(0)
+    voice.setEnvelopeParameters(juce.ADSR.Parameters(0.0, 0.0, 1.0, 0.01))
+    assert voice.getEnvelopeParameters().release == pytest.approx(0.01)
+
+    synth.noteOn(1, 60, 1.0)
+    assert voice.isVoiceActive()
+    render(synth)
+
+    synth.noteOff(1, 60, 0.0, True)
+    render(synth, num_samples=4800)
+    assert not voice.isVoiceActive()
+    assert np.all(render(synth) == 0.0)
+
+#==================================================================================================
+
+def test_native_voice_gain():
+    loud = make_synth(juce.SineVoice, num_voices=1)
+    quiet = make_synth(juce.SineVoice, num_voices=1)
+    quiet.getVoice(0).setGain(loud.getVoice(0).getGain() * 0.5)
+
+    a = render(loud, note_on_buffer(60))
+    b = render(quiet, note_on_buffer(60))
+    assert np.allclose(b, a * 0.5, atol=1e-6)
+
+#==================================================================================================
+
+def test_wavetable_voice_matches_sine():
+    table = juce.AudioBufferFloat(1, 2048)
+    np.asarray(table)[0] = np.sin(np.arange(2048) * 2.0 * np.pi / 2048)
+
+    synth = make_synth(lambda: juce.WavetableVoice(table))
+    assert synth.getVoice(0).getTableSize() == 2048
+
+    output = render(synth, note_on_buffer(69), num_samples=4800)
+    assert dominant_frequency(output[0]) == pytest.approx(440.0, abs=10.0)
+
+    reference = render(make_synth(juce.SineVoice), note_on_buffer(69), num_samples=4800)
+    assert np.allclose(output, reference, atol=1e-3)
+
+#==================================================================================================
+
+def test_simple_sound_note_range():
+    sound = juce.SimpleSynthesiserSound(60, 72, 2)
+    assert sound.getLowestNote() == 60
+    assert sound.getHighestNote() == 72
+    assert sound.getMidiChannel() == 2
+    assert sound.appliesToNote(60) and sound.appliesToNote(72) and not sound.appliesToNote(73)
+    assert sound.appliesToChannel(2) and not sound.appliesToChannel(1)
+
+    synth = make_synth(juce.SineVoice, sound=sound)
+
+    synth.noteOn(1, 64, 1.0)
+    synth.noteOn(2, 80, 1.0)
+    assert np.all(render(synth) == 0.0)
+
+    synth.noteOn(2, 64, 1.0)
+    assert np.max(np.abs(render(synth))) > 0.0
+
+#==================================================================================================
+
+def test_python_voice_and_sound():
+    class PythonSound(juce.SynthesiserSound):
+        def appliesToNote(self, midiNoteNumber):
+            return True
+
+        def appliesToChannel(self, midiChannel):
+            return True
+
+    class ConstantVoice(juce.SynthesiserVoice):
+        def __init__(self):
+            juce.SynthesiserVoice.__init__(self)
+            self.started = []
+            self.level = 0.0
+
+        def canPlaySound(self, sound):
+            return isinstance(sound, PythonSound)
+
+        def startNote(self, midiNoteNumber, velocity, sound, currentPitchWheelPosition):
+            self.started.append(midiNoteNumber)
+            self.level = velocity
+
+        def stopNote(self, velocity, allowTailOff):
+            self.level = 0.0
+            self.clearCurrentNote()
+
+        def pitchWheelMoved(self, newPitchWheelValue):
+            pass
+
+        def controllerMoved(self, controllerNumber, newControllerValue):
+            pass
+
+        def renderNextBlock(self, outputBuffer, startSample, numSamples):
+            for channel in range(outputBuffer.getNumChannels()):
+                np.asarray(outputBuffer)[channel, startSample:startSample + numSamples] += self.level
+
+    voice = ConstantVoice()
+    synth = juce.Synthesiser()
+    assert synth.addVoice(voice) is voice
+    synth.addSound(PythonSound())
+    synth.setCurrentPlaybackSampleRate(SAMPLE_RATE)
+
+    output = render(synth, note_on_buffer(64, 0.5, position=100))
+    assert voice.started == [64]
+    assert voice.level == pytest.approx(0.5, abs=0.01)
+    assert np.all(output[:, :100] == 0.0)
+    assert np.allclose(output[:, 100:], voice.level)
+    assert synth.getVoice(0) is voice
+    assert isinstance(synth.getVoice(0).getCurrentlyPlayingSound(), PythonSound)
+
+    synth.noteOff(1, 64, 0.0, False)
+    assert voice.getCurrentlyPlayingNote() == -1
+    assert np.all(render(synth) == 0.0)
+
+#==================================================================================================
+
+def test_python_voice_allocation_policy():
+    class LowestVoiceSynth(juce.Synthesiser):
+        def __init__(self):
+            juce.Synthesiser.__init__(self)
+            self.requests = []
+
+        def findFreeVoice(self, soundToPlay, midiChannel, midiNoteNumber, stealIfNoneAvailable):
+            self.requests.append(midiNoteNumber)
+            for index in range(self.getNumVoices()):
+                voice = self.getVoice(index)
+                if not voice.isVoiceActive():
+                    return voice
+            return None
+
+    synth = LowestVoiceSynth()
+    for _ in range(2):
+        synth.addVoice(juce.SineVoice())
+    synth.addSound(juce.SimpleSynthesiserSound())
+    synth.setCurrentPlaybackSampleRate(SAMPLE_RATE)
+
+    for note in (60, 64, 67):
+        synth.noteOn(1, note, 1.0)
+
+    assert synth.requests == [60, 64, 67]
+    assert synth.getVoice(0).getCurrentlyPlayingNote() == 60
+    assert synth.getVoice(1).getCurrentlyPlayingNote() == 64
+
+#==================================================================================================
+
+def test_python_synth_handlers_from_render():
+    class ControllerSynth(juce.Synthesiser):
+        def __init__(self):
+            juce.Synthesiser.__init__(self)
+            self.controllers = []
+
+        def handleController(self, midiChannel, controllerNumber, controllerValue):
+            self.controllers.append((controllerNumber, controllerValue))
+            for index in range(self.getNumVoices()):
+                self.getVoice(index)
+
+    synth = ControllerSynth()
+    synth.addVoice(juce.SineVoice())
+    synth.addSound(juce.SimpleSynthesiserSound())
+    synth.setCurrentPlaybackSampleRate(SAMPLE_RATE)
+
+    midi = note_on_buffer(69)
+    midi.addEvent(juce.MidiMessage.controllerEvent(1, 7, 100), 10)
+
+    output = render(synth, midi)
+    assert synth.controllers == [(7, 100)]
+    assert synth.getVoice(0).getCurrentlyPlayingNote() == 69
+    assert np.any(output != 0.0)
+
+#==================================================================================================
+
+def test_add_voice_type_checked():
+    synth = juce.Synthesiser()
+
+    with pytest.raises(TypeError):
+        synth.addVoice(object())
+
+    assert synth.getNumVoices() == 0
+
+#==================================================================================================
+
+def test_adsr():
+    adsr = juce.ADSR()
+    adsr.setSampleRate(1000.0)
+    adsr.setParameters(juce.ADSR.Parameters(0.01, 0.0, 1.0, 0.01))
+    assert not adsr.isActive()
+
+    adsr.noteOn()
+    values = [adsr.getNextSample() for _ in range(20)]
+    assert adsr.isActive()
+    assert values[-1] == pytest.approx(1.0)
+
+    adsr.noteOff()
+    for _ in range(20):
+        adsr.getNextSample()
+    assert not adsr.isActive()
@@ -0,0 +1,86 @@
+import math
+import pytest
+import numpy as np
+
+import popsicle as juce
+
+#==================================================================================================
+
+class RampSource(juce.AudioSource):
+    def __init__(self):
+        juce.AudioSource.__init__(self)
+        self.prepared = None
+        self.released = False
+        self.position = 0
+
+    def prepareToPlay(self, samplesPerBlockExpected, sampleRate):
+        self.prepared = (samplesPerBlockExpected, sampleRate)
+
+    def releaseResources(self):
+        self.released = True
+
+    def getNextAudioBlock(self, bufferToFill):
+        for channel in range(bufferToFill.buffer.getNumChannels()):
+            output = np.asarray(bufferToFill.buffer.getWritePointer(channel, bufferToFill.startSample))
+            output[:bufferToFill.numSamples] = np.arange(self.position, self.position + bufferToFill.numSamples)
+        self.position += bufferToFill.numSamples
+
+#==================================================================================================
+
+def test_render_native_source():
+    source = juce.ToneGeneratorAudioSource()
+    source.setFrequency(1000.0)
+    source.setAmplitude(0.5)
+
+    result = juce.renderAudioSource(source, 1000, blockSize=128, sampleRate=48000.0)
+
+    assert isinstance(result, np.ndarray)
+    assert result.shape == (2, 1000)
+    assert result.dtype == np.float32
+    assert result.flags.c_contiguous
+
+    expected = 0.5 * np.sin(2.0 * math.pi * 1000.0 * np.arange(1000) / 48000.0)
+    assert np.allclose(result[0], expected, atol=1e-4)
+    assert np.array_equal(result[0], result[1])
+
+#==================================================================================================
+
+def test_render_python_source():
+    source = RampSource()
+
+    result = juce.renderAudioSource(source, 300, blockSize=64, sampleRate=22050.0, numChannels=1)
+
+    assert source.prepared == (64, 22050.0)
+    assert source.released
+    assert result.shape == (1, 300)
+    assert np.array_equal(result[0], np.arange(300, dtype=np.float32))
+
+#==================================================================================================
+
+def test_render_python_source_through_native_chain():
+    ramp = RampSource()
+
+    mixer = juce.MixerAudioSource()
+    mixer.addInputSource(ramp, False)
+
+    result = juce.renderAudioSource(mixer, 256, blockSize=100, numChannels=2)
+    assert np.array_equal(result[1], np.arange(256, dtype=np.float32))
+
+    mixer.removeAllInputs()
+
+#==================================================================================================
+
+def test_render_into_output():
+    out = np.full((3, 50), -1.0, dtype=np.float32)
+    source = RampSource()
+
+    result = juce.renderAudioSource(source, 40, blockSize=16, numChannels=2, out=out, releaseResources=False)
+
+    assert result is out
+    assert not source.released
+    assert np.array_equal(out[0, :40], np.arange(40, dtype=np.float32))
+    assert np.all(out[0, 40:] == -1.0)
+    assert np.all(out[2] == -1.0)
+
+    with pytest.raises(ValueError):
+        juce.renderAudioSource(source, 100, numChannels=2, out=out)
@@ -0,0 +1,116 @@
+import pytest
+import numpy as np
+
+import popsicle as juce
+
+#==================================================================================================
+
+def make_sine(frequency, sample_rate, num_samples, num_channels=2):
+    phase = 2.0 * np.pi * frequency * np.arange(num_samples) / sample_rate
+    return np.stack([np.sin(phase + channel) * 0.5 for channel in range(num_channels)]).astype(np.float32)
+
+def peak_frequency(signal, sample_rate):
+    spectrum = np.abs(np.fft.rfft(signal * np.hanning(len(signal))))
+    return np.argmax(spectrum) * sample_rate / len(signal)
+
+#==================================================================================================
+
+@pytest.mark.parametrize("interpolator", [juce.ResamplingInterpolator.lagrange, juce.ResamplingInterpolator.windowedSinc])
+def test_resample_array(interpolator):
+    data = make_sine(1000.0, 48000.0, 48000)
+
+    result = juce.resample(data, 48000.0, 44100.0, interpolator=interpolator)
+    assert result.dtype == np.float32
+    assert result.shape == (2, 44100)
+    assert result.flags.c_contiguous
+
+    expected = make_sine(1000.0, 44100.0, 44100)
+    assert np.allclose(result[:, 1000:-1000], expected[:, 1000:-1000], atol=5e-2)
+    assert peak_frequency(result[0], 44100.0) == pytest.approx(1000.0, abs=2.0)
+
+#==================================================================================================
+
+def test_resample_single_channel_and_lists():
+    data = make_sine(440.0, 44100.0, 4410, num_channels=1)[0]
+
+    result = juce.resample(data, 44100.0, 22050.0)
+    assert result.shape == (2205,)
+
+    result = juce.resample([data, data], 44100.0, 88200.0)
+    assert result.shape == (2, 8820)
+    assert np.array_equal(result[0], result[1])
+
+#==================================================================================================
+
+def test_resample_in_parallel():
+    data = np.random.default_rng(1).standard_normal((8, 100000)).astype(np.float32)
+
+    sequential = np.stack([juce.resample(channel, 44100.0, 16000.0) for channel in data])
+
+    pool = juce.ThreadPool()
+    assert np.array_equal(juce.resample(data, 44100.0, 16000.0, threadPool=pool), sequential)
+    assert np.array_equal(juce.resample(data, 44100.0, 16000.0), sequential)
+
+#==================================================================================================
+
+def test_resample_invalid_arguments():
+    data = np.zeros((2, 100), dtype=np.float32)
+
+    with pytest.raises(ValueError):
+        juce.resample(data, 0.0, 44100.0)
+
+    with pytest.raises(ValueError):
+        juce.resample(data, 44100.0, -1.0)
+
+    with pytest.raises(TypeError):
+        juce.resample(data.astype(np.float64), 44100.0, 48000.0)
+
+#==================================================================================================
+
+@pytest.mark.parametrize("source_rate, target_rate", [(48000.0, 44100.0), (44100.0, 48000.0), (44100.0, 16000.0)])
+@pytest.mark.parametrize("interpolator", [juce.ResamplingInterpolator.lagrange, juce.ResamplingInterpolator.windowedSinc])
+def test_streaming_resampler_matches_offline(source_rate, target_rate, interpolator):
+    data = np.random.default_rng(2).standard_normal((2, 20000)).astype(np.float32)
+    expected = juce.resample(data, source_rate, target_rate, interpolator=interpolator)
+
+    # Smaller than some of the chunks, so the pending samples also have to grow while processing
+    resampler = juce.StreamingResampler(2, source_rate, target_rate, interpolator=interpolator, maximumBlockSize=512)
+    assert resampler.getNumChannels() == 2
+    assert resampler.getSourceSampleRate() == source_rate
+    assert resampler.getTargetSampleRate() == target_rate
+
+    chunks = []
+    position = 0
+    for size in [1, 7, 64, 0, 513, 4096, 37] * 10:
+        chunk = data[:, position:position + size]
+        assert resampler.getNumOutputSamples(chunk.shape[1]) >= 0
+        chunks.append(resampler.process(chunk))
+        position += chunk.shape[1]
+
+    chunks.append(resampler.flush())
+    assert resampler.getNumPendingSamples() == 0
+
+    assert np.array_equal(np.concatenate(chunks, axis=1), expected)
+
+#==================================================================================================
+
+def test_streaming_resampler_reset():
+    data = make_sine(100.0, 44100.0, 1000)
+
+    resampler = juce.StreamingResampler(2, 44100.0, 22050.0)
+    first = np.concatenate([resampler.process(data), resampler.flush()], axis=1)
+
+    resampler.process(data[:, :300])
+    resampler.reset()
+
+    second = np.concatenate([resampler.process(data), resampler.flush()], axis=1)
+    assert np.array_equal(first, second)
+
+    with pytest.raises(ValueError):
+        resampler.process(data[:1])
+
+    with pytest.raises(ValueError):
+        juce.StreamingResampler(0, 44100.0, 22050.0)
+
+    with pytest.raises(ValueError):
+        juce.StreamingResampler(2, 44100.0, 22050.0, maximumBlockSize=-1)
@@ -0,0 +1,323 @@
+import pytest
+import numpy as np
+
+import popsicle as juce
+
+#==================================================================================================
+
+class RecordingCallback(juce.AudioIODeviceCallback):
+    def __init__(self):
+        juce.AudioIODeviceCallback.__init__(self)
+        self.blocks = []
+
+    def audioDeviceAboutToStart(self, device):
+        pass
+
+    def audioDeviceStopped(self):
+        pass
+
+    def audioDeviceIOCallbackWithContext(self, inputs, numInputChannels, outputs, numOutputChannels, numSamples, context):
+        self.blocks.append((inputs, outputs))
+
+        for channel in range(numOutputChannels):
+            output = np.asarray(outputs[channel])
+            output[:] = np.asarray(inputs[channel]) * 2.0
+
+#==================================================================================================
+
+def render_block(callback, inputs, outputs):
+    juce.AudioIODeviceCallback.audioDeviceIOCallbackWithContext(
+        callback, inputs, len(inputs), outputs, len(outputs), outputs.shape[1] if hasattr(outputs, "shape") else len(outputs[0]),
+        juce.AudioIODeviceCallbackContext())
+
+#==================================================================================================
+
+def test_default_dispatch_mode():
+    callback = RecordingCallback()
+    assert callback.getDispatchMode() == juce.AudioIODeviceCallback.DispatchMode.channelLists
+
+    callback.setDispatchMode(juce.AudioIODeviceCallback.DispatchMode.channelViews)
+    assert callback.getDispatchMode() == juce.AudioIODeviceCallback.DispatchMode.channelViews
+
+#==================================================================================================
+
+def test_channel_lists_dispatch():
+    callback = RecordingCallback()
+
+    inputs = np.ones((2, 64), dtype=np.float32)
+    outputs = np.zeros((2, 64), dtype=np.float32)
+    render_block(callback, inputs, outputs)
+
+    assert len(callback.blocks) == 1
+    assert isinstance(callback.blocks[0][1], list)
+    assert np.all(outputs == 2.0)
+
+#==================================================================================================
+
+def test_channel_views_dispatch_reuses_objects():
+    callback = RecordingCallback()
+    callback.setDispatchMode(juce.AudioIODeviceCallback.DispatchMode.channelViews)
+
+    inputs = np.ones((2, 64), dtype=np.float32)
+    outputs = np.zeros((2, 64), dtype=np.float32)
+    for _ in range(4):
+        render_block(callback, inputs, outputs)
+
+    assert len(callback.blocks) == 4
+    assert all(block[0] is callback.blocks[0][0] for block in callback.blocks)
+    assert all(block[1] is callback.blocks[0][1] for block in callback.blocks)
+    assert np.all(outputs == 2.0)
+
+#==================================================================================================
+
+def test_channel_views_survive_more_channels():
+    class Callback(RecordingCallback):
+        def audioDeviceIOCallbackWithContext(self, inputs, numInputChannels, outputs, numOutputChannels, numSamples, context):
+            self.blocks.append([outputs[channel] for channel in range(numOutputChannels)])
+
+            for channel in range(numOutputChannels):
+                np.asarray(outputs[channel])[:] = channel + 1
+
+    callback = Callback()
+    callback.setDispatchMode(juce.AudioIODeviceCallback.DispatchMode.channelViews)
+
+    render_block(callback, [], np.zeros((1, 16), dtype=np.float32))
+    first_channel = callback.blocks[0][0]
+
+    outputs = np.zeros((4, 32), dtype=np.float32)
+    render_block(callback, [], outputs)
+
+    assert first_channel is callback.blocks[1][0]
+    assert len(np.asarray(first_channel)) == 32
+    assert np.all(outputs == np.arange(1, 5, dtype=np.float32)[:, None])
+
+#==================================================================================================
+
+def test_channel_views_expose_2d_buffer():
+    class Callback(RecordingCallback):
+        def audioDeviceIOCallbackWithContext(self, inputs, numInputChannels, outputs, numOutputChannels, numSamples, context):
+            assert len(outputs) == numOutputChannels
+            assert outputs.getNumSamples() == numSamples
+            assert outputs.hasUniformStride()
+
+            in_array = np.asarray(inputs)
+            out_array = np.asarray(outputs)
+            assert in_array.shape == (numInputChannels, numSamples)
+            assert out_array.shape == (numOutputChannels, numSamples)
+            assert not in_array.flags.writeable
+            assert out_array.flags.writeable
+
+            out_array[:] = in_array + 1.0
+
+    callback = Callback()
+    callback.setDispatchMode(juce.AudioIODeviceCallback.DispatchMode.channelViews)
+
+    inputs = np.arange(3 * 32, dtype=np.float32).reshape(3, 32)
+    outputs = np.zeros((3, 32), dtype=np.float32)
+    render_block(callback, inputs, outputs)
+
+    assert np.array_equal(outputs, inputs + 1.0)
+
+#==================================================================================================
+
+def test_channel_views_non_uniform_layout():
+    class Callback(RecordingCallback):
+        def audioDeviceIOCallbackWithContext(self, inputs, numInputChannels, outputs, numOutputChannels, numSamples, context):
+            assert not outputs.hasUniformStride()
+
+            with pytest.raises(BufferError):
+                np.asarray(outputs)
+
+            for channel, output in enumerate(outputs):
+                np.asarray(output)[:] = channel + 1
+
+    callback = Callback()
+    callback.setDispatchMode(juce.AudioIODeviceCallback.DispatchMode.channelViews)
+
+    storage = np.zeros(256, dtype=np.float32)
+    outputs = [storage[128:192], storage[0:64]]
+    juce.AudioIODeviceCallback.audioDeviceIOCallbackWithContext(
+        callback, [], 0, outputs, 2, 64, juce.AudioIODeviceCallbackContext())
+
+    assert np.all(outputs[0] == 1.0)
+    assert np.all(outputs[1] == 2.0)
+
+#==================================================================================================
+
+def test_invalid_channel_data():
+    callback = RecordingCallback()
+
+    with pytest.raises(TypeError):
+        render_block(callback, np.zeros((2, 64), dtype=np.float64), np.zeros((2, 64), dtype=np.float32))
+
+    with pytest.raises(ValueError):
+        juce.AudioIODeviceCallback.audioDeviceIOCallbackWithContext(
+            callback, np.zeros((1, 64), dtype=np.float32), 2, np.zeros((2, 64), dtype=np.float32), 2, 64,
+            juce.AudioIODeviceCallbackContext())
+
+#==================================================================================================
+
+class FakeDevice(juce.AudioIODevice):
+    def __init__(self, numInputs, numOutputs, bufferSize):
+        juce.AudioIODevice.__init__(self, "fake", "fake")
+        self.numInputs = numInputs
+        self.numOutputs = numOutputs
+        self.bufferSize = bufferSize
+
+    def getActiveInputChannels(self):
+        channels = juce.BigInteger(0)
+        channels.setRange(0, self.numInputs, True)
+        return channels
+
+    def getActiveOutputChannels(self):
+        channels = juce.BigInteger(0)
+        channels.setRange(0, self.numOutputs, True)
+        return channels
+
+    def getCurrentBufferSizeSamples(self):
+        return self.bufferSize
+
+#==================================================================================================
+
+class CountingCallback(juce.AudioIODeviceCallback):
+    def __init__(self):
+        juce.AudioIODeviceCallback.__init__(self)
+        self.numBlocks = 0
+
+    def audioDeviceAboutToStart(self, device):
+        pass
+
+    def audioDeviceStopped(self):
+        pass
+
+    def audioDeviceIOCallbackWithContext(self, inputs, numInputChannels, outputs, numOutputChannels, numSamples, context):
+        self.numBlocks += 1
+        for channel in range(numOutputChannels):
+            np.asarray(outputs[channel])[:] = self.numBlocks
+
+#==================================================================================================
+
+def test_lookahead_renders_ahead_of_device():
+    callback = CountingCallback()
+    callback.setLookaheadBlocks(16)
+    assert callback.getLookaheadBlocks() == 16
+    assert callback.getAddedLatencyInSamples() == 0
+
+    device = FakeDevice(0, 2, 64)
+    juce.AudioIODeviceCallback.audioDeviceAboutToStart(callback, device)
+
+    try:
+        assert callback.getAddedLatencyInSamples() == 16 * 64
+        assert callback.numBlocks >= 16
+
+        for expected in range(1, 9):
+            outputs = np.zeros((2, 64), dtype=np.float32)
+            juce.AudioIODeviceCallback.audioDeviceIOCallbackWithContext(
+                callback, [], 0, outputs, 2, 64, juce.AudioIODeviceCallbackContext())
+
+            # All the played blocks were rendered when starting, so they never depend on the worker keeping up
+            assert np.all(outputs == expected)
+
+        assert callback.getUnderrunCount() == 0
+
+    finally:
+        juce.AudioIODeviceCallback.audioDeviceStopped(callback)
+
+    assert callback.getAddedLatencyInSamples() == 0
+
+#==================================================================================================
+
+def test_lookahead_counts_underruns():
+    import threading
+
+    release = threading.Event()
+
+    class StallingCallback(CountingCallback):
+        def audioDeviceIOCallbackWithContext(self, *args):
+            if self.numBlocks >= 1:
+                release.wait()
+            CountingCallback.audioDeviceIOCallbackWithContext(self, *args)
+
+    callback = StallingCallback()
+    callback.setLookaheadBlocks(1)
+
+    device = FakeDevice(0, 1, 32)
+    juce.AudioIODeviceCallback.audioDeviceAboutToStart(callback, device)
+
+    try:
+        first = np.zeros((1, 32), dtype=np.float32)
+        juce.AudioIODeviceCallback.audioDeviceIOCallbackWithContext(
+            callback, [], 0, first, 1, 32, juce.AudioIODeviceCallbackContext())
+        assert np.all(first == 1.0)
+        assert callback.getUnderrunCount() == 0
+
+        second = np.ones((1, 32), dtype=np.float32)
+        juce.AudioIODeviceCallback.audioDeviceIOCallbackWithContext(
+            callback, [], 0, second, 1, 32, juce.AudioIODeviceCallbackContext())
+        assert np.all(second == 0.0)
+        assert callback.getUnderrunCount() == 1
+
+    finally:
+        release.set()
+        juce.AudioIODeviceCallback.audioDeviceStopped(callback)
+
+#==================================================================================================
+
+def test_lookahead_with_inputs_adds_latency():
+    class EchoCallback(CountingCallback):
+        def audioDeviceIOCallbackWithContext(self, inputs, numInputChannels, outputs, numOutputChannels, numSamples, context):
+            np.asarray(outputs[0])[:] = np.asarray(inputs[0])
+
+    callback = EchoCallback()
+    callback.setLookaheadBlocks(2)
+
+    device = FakeDevice(1, 1, 16)
+    juce.AudioIODeviceCallback.audioDeviceAboutToStart(callback, device)
+
+    try:
+        assert callback.getAddedLatencyInSamples() == 2 * 16
+
+        inputs = np.full((1, 16), 0.5, dtype=np.float32)
+        outputs = np.ones((1, 16), dtype=np.float32)
+        juce.AudioIODeviceCallback.audioDeviceIOCallbackWithContext(
+            callback, inputs, 1, outputs, 1, 16, juce.AudioIODeviceCallbackContext())
+
+        # The first blocks played are the silence priming the lookahead
+        assert np.all(outputs == 0.0)
+
+    finally:
+        juce.AudioIODeviceCallback.audioDeviceStopped(callback)
+
+#==================================================================================================
+
+def test_timing_stats():
+    callback = RecordingCallback()
+    assert not callback.isTimingEnabled()
+
+    inputs = np.ones((2, 64), dtype=np.float32)
+    outputs = np.zeros((2, 64), dtype=np.float32)
+
+    render_block(callback, inputs, outputs)
+    assert callback.getTimingStats()["total"]["count"] == 0
+
+    callback.setTimingEnabled(True)
+    for _ in range(8):
+        render_block(callback, inputs, outputs)
+
+    stats = callback.getTimingStats()
+    for key in ("gil", "python", "total"):
+        assert stats[key]["count"] == 8
+        assert 0.0 <= stats[key]["p50"] <= stats[key]["p99"] <= stats[key]["max"]
+    assert stats["total"]["max"] >= stats["python"]["max"]
+
+    callback.resetTimingStats()
+    assert callback.getTimingStats()["total"]["count"] == 0
+
+#==================================================================================================
+
+def test_timing_stats_unavailable_on_native_callbacks():
+    callback = juce.NativeAudioIODeviceCallback(None)
+    assert callback.getTimingStats() is None
+
+    with pytest.raises(TypeError):
+        callback.setTimingEnabled(True)
@@ -0,0 +1,186 @@
+import gc
+import time
+import weakref
+import pytest
+import numpy as np
+
+import popsicle as juce
+
+#==================================================================================================
+
+def note_on(note, timestamp):
+    return juce.MidiMessage.noteOn(1, note, 1.0).withTimeStamp(timestamp)
+
+def deliver(callback, message):
+    juce.MidiInputCallback.handleIncomingMidiMessage(callback, None, message)
+
+#==================================================================================================
+
+def test_queue_delivers_records_in_order():
+    queue = juce.MidiInputQueue(16)
+    assert queue.getCapacity() == 16
+    assert len(queue) == 0
+
+    for index in range(5):
+        deliver(queue, note_on(60 + index, 1.0 + index * 0.01))
+
+    assert len(queue) == 5
+
+    records = queue.pop()
+    assert records.dtype == juce.getMidiEventDtype()
+    assert list(records["data1"]) == [60, 61, 62, 63, 64]
+    assert np.all(records["status"] == 0x90)
+    assert np.allclose(records["timestamp"], [1.0, 1.01, 1.02, 1.03, 1.04])
+    assert len(queue) == 0
+
+#==================================================================================================
+
+def test_queue_pop_partial():
+    queue = juce.MidiInputQueue(16)
+
+    for index in range(10):
+        queue.push(note_on(index, float(index)))
+
+    assert len(queue.pop(4)) == 4
+    assert list(queue.pop(100)["data1"]) == list(range(4, 10))
+    assert len(queue.pop()) == 0
+
+#==================================================================================================
+
+def test_queue_wraps_around():
+    queue = juce.MidiInputQueue(4)
+
+    for round in range(10):
+        for index in range(3):
+            assert queue.push(note_on(index, round))
+
+        assert list(queue.pop()["data1"]) == [0, 1, 2]
+
+    assert queue.getNumDropped() == 0
+
+#==================================================================================================
+
+def test_queue_counts_dropped_messages():
+    queue = juce.MidiInputQueue(2)
+
+    assert queue.push(note_on(1, 0.0))
+    assert queue.push(note_on(2, 0.0))
+    assert not queue.push(note_on(3, 0.0))
+    assert not queue.push(juce.MidiMessage.createSysExMessage(b"\x01\x02\x03\x04"))
+    assert queue.getNumDropped() == 2
+
+    queue.reset()
+    assert len(queue) == 0
+    assert queue.getNumDropped() == 0
+
+#==================================================================================================
+
+def test_queue_pop_into_midi_buffer():
+    queue = juce.MidiInputQueue()
+    queue.push(note_on(60, 10.0))
+    queue.push(juce.MidiMessage.controllerEvent(2, 7, 100).withTimeStamp(10.5))
+
+    buffer = juce.MidiBuffer()
+    assert queue.popInto(buffer, startTime=10.0, sampleRate=1000.0) == 2
+    assert buffer.getNumEvents() == 2
+
+    events = list(buffer)
+    assert events[0][1] == 0
+    assert events[0][0] == bytes([0x90, 60, 127])
+    assert events[1][1] == 500
+    assert events[1][0] == bytes([0xb1, 7, 100])
+
+    with pytest.raises(ValueError):
+        queue.popInto(buffer, sampleRate=0.0)
+
+#==================================================================================================
+
+def test_python_midi_input_callback():
+    class Callback(juce.MidiInputCallback):
+        def __init__(self):
+            juce.MidiInputCallback.__init__(self)
+            self.messages = []
+
+        def handleIncomingMidiMessage(self, source, message):
+            self.messages.append((source, message.getNoteNumber()))
+
+    callback = Callback()
+    deliver(callback, note_on(72, 0.0))
+    assert callback.messages == [(None, 72)]
+
+#==================================================================================================
+
+def test_midi_message_collector():
+    collector = juce.MidiMessageCollector()
+    collector.reset(44100.0)
+
+    now = juce.Time.getMillisecondCounterHiRes() * 0.001
+    collector.addMessageToQueue(note_on(60, now))
+    deliver(collector, note_on(64, now))
+
+    buffer = juce.MidiBuffer()
+    collector.removeNextBlockOfMessages(buffer, 512)
+    assert buffer.getNumEvents() == 2
+
+    buffer.clear()
+    collector.removeNextBlockOfMessages(buffer, 512)
+    assert buffer.getNumEvents() == 0
+
+#==================================================================================================
+
+def test_device_lists():
+    for info in juce.MidiInput.getAvailableDevices() + juce.MidiOutput.getAvailableDevices():
+        assert isinstance(info, juce.MidiDeviceInfo)
+        assert isinstance(info.identifier, str)
+
+    info = juce.MidiDeviceInfo("name", "identifier")
+    assert info == juce.MidiDeviceInfo("name", "identifier")
+    assert info != juce.MidiDeviceInfo("name", "other")
+
+#==================================================================================================
+
+def test_virtual_port_loopback():
+    output = juce.MidiOutput.createNewDevice("popsicle loopback")
+    if output is None:
+        pytest.skip("Virtual MIDI ports are not available")
+
+    matching = [d for d in juce.MidiInput.getAvailableDevices() if d.name == output.getName()]
+    if not matching:
+        pytest.skip("The virtual MIDI port is not visible as an input")
+
+    queue = juce.MidiInputQueue()
+    midi_input = juce.MidiInput.openDevice(matching[0].identifier, queue)
+    if midi_input is None:
+        pytest.skip("Unable to open the virtual MIDI port")
+
+    midi_input.start()
+    try:
+        output.sendMessageNow(juce.MidiMessage.noteOn(1, 60, 1.0))
+
+        deadline = time.monotonic() + 2.0
+        while len(queue) == 0 and time.monotonic() < deadline:
+            time.sleep(0.01)
+
+        records = queue.pop()
+        assert len(records) == 1
+        assert records[0]["data1"] == 60
+
+    finally:
+        midi_input.stop()
+
+#==================================================================================================
+
+def test_device_manager_keeps_midi_callbacks_while_registered(juce_app):
+    manager = juce.AudioDeviceManager()
+
+    queue = juce.MidiInputQueue(16)
+    queue_ref = weakref.ref(queue)
+
+    manager.addMidiInputDeviceCallback("", queue)
+    del queue
+    gc.collect()
+    assert queue_ref() is not None
+
+    manager.removeMidiInputDeviceCallback("", queue_ref())
+    gc.collect()
+    assert queue_ref() is None
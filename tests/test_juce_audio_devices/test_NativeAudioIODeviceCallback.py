@@ -0,0 +1,88 @@
+import ctypes
+import numpy as np
+
+import popsicle as juce
+
+#==================================================================================================
+
+PROCESS = ctypes.CFUNCTYPE(None,
+    ctypes.c_void_p,
+    ctypes.POINTER(ctypes.POINTER(ctypes.c_float)), ctypes.c_int,
+    ctypes.POINTER(ctypes.POINTER(ctypes.c_float)), ctypes.c_int,
+    ctypes.c_int)
+
+STOPPED = ctypes.CFUNCTYPE(None, ctypes.c_void_p)
+
+#==================================================================================================
+
+def test_process_with_user_data():
+    gain = np.array([0.5], dtype=np.float32)
+
+    @PROCESS
+    def process(userData, inputs, numInputs, outputs, numOutputs, numSamples):
+        value = ctypes.cast(userData, ctypes.POINTER(ctypes.c_float))[0]
+        for channel in range(numOutputs):
+            for sample in range(numSamples):
+                outputs[channel][sample] = inputs[channel][sample] * value
+
+    callback = juce.NativeAudioIODeviceCallback(process, gain)
+    assert callback.getUserData() == gain.ctypes.data
+
+    inputs = np.ones((2, 16), dtype=np.float32)
+    outputs = np.zeros((2, 16), dtype=np.float32)
+    juce.AudioIODeviceCallback.audioDeviceIOCallbackWithContext(
+        callback, inputs, 2, outputs, 2, 16, juce.AudioIODeviceCallbackContext())
+
+    assert np.all(outputs == 0.5)
+
+#==================================================================================================
+
+def test_user_data_from_ctypes_pointers():
+    gain = np.array([0.5], dtype=np.float32)
+
+    pointer = gain.ctypes.data_as(ctypes.POINTER(ctypes.c_float))
+    assert juce.NativeAudioIODeviceCallback(None, pointer).getUserData() == gain.ctypes.data
+
+    text = ctypes.c_char_p(b"user data")
+    assert juce.NativeAudioIODeviceCallback(None, text).getUserData() == ctypes.cast(text, ctypes.c_void_p).value
+
+    value = ctypes.c_float(0.5)
+    assert juce.NativeAudioIODeviceCallback(None, value).getUserData() == ctypes.addressof(value)
+
+#==================================================================================================
+
+def test_process_from_address():
+    @PROCESS
+    def process(userData, inputs, numInputs, outputs, numOutputs, numSamples):
+        for channel in range(numOutputs):
+            for sample in range(numSamples):
+                outputs[channel][sample] = channel + 1
+
+    address = ctypes.cast(process, ctypes.c_void_p).value
+    callback = juce.NativeAudioIODeviceCallback(address)
+
+    outputs = np.zeros((2, 8), dtype=np.float32)
+    juce.AudioIODeviceCallback.audioDeviceIOCallbackWithContext(
+        callback, [], 0, outputs, 2, 8, juce.AudioIODeviceCallbackContext())
+
+    assert np.all(outputs[0] == 1.0)
+    assert np.all(outputs[1] == 2.0)
+
+#==================================================================================================
+
+def test_no_process_clears_outputs():
+    stopped = []
+
+    @STOPPED
+    def on_stopped(userData):
+        stopped.append(userData)
+
+    callback = juce.NativeAudioIODeviceCallback(None, 1234, stopped=on_stopped)
+
+    outputs = np.ones((1, 8), dtype=np.float32)
+    juce.AudioIODeviceCallback.audioDeviceIOCallbackWithContext(
+        callback, [], 0, outputs, 1, 8, juce.AudioIODeviceCallbackContext())
+    assert np.all(outputs == 0.0)
+
+    callback.audioDeviceStopped()
+    assert stopped == [1234]
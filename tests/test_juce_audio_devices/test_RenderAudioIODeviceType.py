@@ -0,0 +1,125 @@
+import numpy as np
+
+import popsicle as juce
+
+#==================================================================================================
+
+class CollectingCallback(juce.AudioIODeviceCallback):
+    def __init__(self):
+        juce.AudioIODeviceCallback.__init__(self)
+        self.started = None
+        self.stopped = False
+        self.blocks = []
+
+    def audioDeviceAboutToStart(self, device):
+        self.started = (device.getCurrentSampleRate(), device.getCurrentBufferSizeSamples())
+
+    def audioDeviceStopped(self):
+        self.stopped = True
+
+    def audioDeviceIOCallbackWithContext(self, inputs, numInputChannels, outputs, numOutputChannels, numSamples, context):
+        self.blocks.append((numInputChannels, numOutputChannels, numSamples))
+        for output in outputs:
+            np.asarray(output)[:] = 1.0
+
+#==================================================================================================
+
+def test_device_type():
+    device_type = juce.RenderAudioIODeviceType(sampleRate=48000.0, bufferSize=256, numInputChannels=1, numOutputChannels=4)
+    assert device_type.getTypeName() == juce.RenderAudioIODeviceType.getRenderTypeName()
+    assert device_type.getDeviceNames(False) == [juce.RenderAudioIODeviceType.getRenderTypeName()]
+    assert device_type.getSampleRate() == 48000.0
+    assert device_type.getBufferSize() == 256
+    assert device_type.getNumInputChannels() == 1
+    assert device_type.getNumOutputChannels() == 4
+    assert device_type.getSpeed() == 0.0
+    assert device_type.getLengthInSamples() == -1
+
+    device = device_type.createDevice("", "")
+    assert isinstance(device, juce.RenderAudioIODevice)
+    assert len(device.getOutputChannelNames()) == 4
+    assert len(device.getInputChannelNames()) == 1
+    assert device.getDefaultBufferSize() == 256
+    assert 48000.0 in device.getAvailableSampleRates()
+
+#==================================================================================================
+
+def test_render_fixed_length():
+    device_type = juce.RenderAudioIODeviceType(bufferSize=128, numOutputChannels=2, lengthInSamples=1000)
+    device = device_type.createDevice("", "")
+
+    outputs = juce.BigInteger(0)
+    outputs.setRange(0, 2, True)
+    assert not device.open(juce.BigInteger(0), outputs, 0.0, 0)
+    assert device.isOpen()
+    assert device.getCurrentBufferSizeSamples() == 128
+    assert device.getCurrentSampleRate() == 44100.0
+
+    callback = CollectingCallback()
+    device.start(callback)
+    assert device.waitForRenderToFinish(5000)
+
+    device.stop()
+    device.close()
+
+    assert callback.started == (44100.0, 128)
+    assert callback.stopped
+    assert device.getNumSamplesRendered() == 1000
+    assert sum(block[2] for block in callback.blocks) == 1000
+    assert all(block[:2] == (0, 2) for block in callback.blocks)
+    assert callback.blocks[-1][2] == 1000 - 7 * 128
+
+#==================================================================================================
+
+def test_render_restart_and_early_stop():
+    device_type = juce.RenderAudioIODeviceType(bufferSize=128, numOutputChannels=2, lengthInSamples=1000)
+    device = device_type.createDevice("", "")
+
+    outputs = juce.BigInteger(0)
+    outputs.setRange(0, 2, True)
+    assert not device.open(juce.BigInteger(0), outputs, 0.0, 0)
+
+    for _ in range(2):
+        callback = CollectingCallback()
+        device.start(callback)
+        assert device.waitForRenderToFinish(5000)
+        device.stop()
+
+        assert device.getNumSamplesRendered() == 1000
+        assert sum(block[2] for block in callback.blocks) == 1000
+
+    device.close()
+
+    device_type = juce.RenderAudioIODeviceType(bufferSize=128, numOutputChannels=2, speed=1.0, lengthInSamples=44100 * 60)
+    device = device_type.createDevice("", "")
+    assert not device.open(juce.BigInteger(0), outputs, 0.0, 0)
+
+    callback = CollectingCallback()
+    device.start(callback)
+    device.stop()
+
+    assert callback.stopped
+    assert not device.waitForRenderToFinish(100)
+    assert device.getNumSamplesRendered() < 44100 * 60
+
+    device.close()
+
+#==================================================================================================
+
+def test_render_through_device_manager(juce_app):
+    manager = juce.AudioDeviceManager()
+    manager.addAudioDeviceType(juce.RenderAudioIODeviceType(bufferSize=64, lengthInSamples=64 * 10))
+
+    callback = CollectingCallback()
+    manager.addAudioCallback(callback)
+    manager.setCurrentAudioDeviceType(juce.RenderAudioIODeviceType.getRenderTypeName(), True)
+
+    device = manager.getCurrentAudioDevice()
+    assert isinstance(device, juce.RenderAudioIODevice)
+    assert device.waitForRenderToFinish(5000)
+    assert device.getNumSamplesRendered() == 640
+
+    manager.removeAudioCallback(callback)
+    manager.closeAudioDevice()
+
+    assert len(callback.blocks) == 10
@@ -0,0 +1,104 @@
+import pytest
+import numpy as np
+
+import popsicle as juce
+
+from .utilities import make_test_signal, write_wav
+
+#==================================================================================================
+
+@pytest.fixture
+def manager():
+    manager = juce.AudioFormatManager()
+    manager.registerBasicFormats()
+    return manager
+
+def write_corpus(folder, num_files, num_samples=4410):
+    files = []
+
+    for index in range(num_files):
+        samples = (make_test_signal(2, num_samples + index * 10) * 32767).astype(np.int16)
+        files.append((write_wav(folder / f"file_{index}.wav", samples), samples))
+
+    return files
+
+#==================================================================================================
+
+def test_decode_files_in_completion_order(tmp_path, manager):
+    corpus = write_corpus(tmp_path, 20)
+
+    decoder = manager.decodeFiles([file for file, _ in corpus], dtype=np.int16, numThreads=4)
+    assert len(decoder) == 20
+
+    seen = set()
+    for index, data, sample_rate, error in decoder:
+        assert error is None
+        assert sample_rate == 44100.0
+        assert data.dtype == np.int16
+        assert np.array_equal(data, corpus[index][1])
+        seen.add(index)
+
+    assert seen == set(range(20))
+
+#==================================================================================================
+
+def test_decode_files_accepts_paths(tmp_path, manager):
+    corpus = write_corpus(tmp_path, 3)
+    paths = [tmp_path / f"file_{index}.wav" for index in range(3)]
+
+    results = sorted(manager.decodeFiles(paths + [str(paths[0])]), key=lambda result: result[0])
+    assert [result[0] for result in results] == [0, 1, 2, 3]
+    assert np.allclose(results[3][1], corpus[0][1] / 32768.0)
+
+    with pytest.raises(TypeError):
+        manager.decodeFiles([42])
+
+#==================================================================================================
+
+def test_decode_files_reports_errors(tmp_path, manager):
+    corpus = write_corpus(tmp_path, 2)
+
+    broken = tmp_path / "broken.wav"
+    broken.write_bytes(b"not an audio file")
+
+    files = [corpus[0][0], juce.File(str(broken)), juce.File(str(tmp_path / "missing.wav")), corpus[1][0]]
+    results = { index: (data, error) for index, data, _, error in manager.decodeFiles(files) }
+
+    assert len(results) == 4
+    assert results[0][1] is None and results[3][1] is None
+    for index in (1, 2):
+        data, error = results[index]
+        assert data is None
+        assert isinstance(error, str) and error
+
+#==================================================================================================
+
+def test_decode_files_options(tmp_path, manager):
+    file, samples = write_corpus(tmp_path, 1, num_samples=44100)[0]
+    expected = samples / 32768.0
+
+    (_, data, _, _), = manager.decodeFiles([file], numChannels=1)
+    assert data.shape == (1, 44100)
+    assert np.allclose(data[0], expected.mean(axis=0), atol=1e-6)
+
+    (_, data, _, _), = manager.decodeFiles([file], numChannels=3, dtype="int32")
+    assert data.shape == (3, 44100)
+    assert np.array_equal(data[2], data[1])
+
+    (_, data, _, _), = manager.decodeFiles([file], maxSeconds=0.25)
+    assert data.shape == (2, 11025)
+    assert np.allclose(data, expected[:, :11025])
+
+    (_, data, sample_rate, _), = manager.decodeFiles([file], sampleRate=22050.0)
+    assert sample_rate == 22050.0
+    assert data.shape == (2, 22050)
+    assert np.allclose(data[0, 100:-100], expected[0, ::2][100:-100], atol=1e-2)
+
+    (_, sinc, _, _), = manager.decodeFiles([file], sampleRate=22050.0, interpolator=juce.ResamplingInterpolator.windowedSinc)
+    assert sinc.shape == (2, 22050)
+    assert np.array_equal(sinc, juce.resample(expected.astype(np.float32), 44100.0, 22050.0, interpolator=juce.ResamplingInterpolator.windowedSinc))
+
+#==================================================================================================
+
+def test_decode_no_files(manager):
+    assert list(manager.decodeFiles([])) == []
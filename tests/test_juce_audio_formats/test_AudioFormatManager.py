@@ -0,0 +1,111 @@
+import gc
+import zipfile
+import pytest
+import numpy as np
+
+import popsicle as juce
+
+from .utilities import make_test_signal, write_wav
+
+#==================================================================================================
+
+@pytest.fixture
+def manager():
+    manager = juce.AudioFormatManager()
+    manager.registerBasicFormats()
+    return manager
+
+@pytest.fixture
+def pcm_samples():
+    return (make_test_signal() * 32767).astype(np.int16)
+
+@pytest.fixture
+def wav_path(tmp_path, pcm_samples):
+    write_wav(tmp_path / "signal.wav", pcm_samples)
+    return tmp_path / "signal.wav"
+
+#==================================================================================================
+
+def test_create_reader_for_buffer(manager, wav_path, pcm_samples):
+    for data in (wav_path.read_bytes(), bytearray(wav_path.read_bytes()), np.fromfile(wav_path, dtype=np.uint8)):
+        reader = manager.createReaderForBuffer(data)
+        assert reader is not None
+        assert reader.getFormatName() == "WAV file"
+        assert reader.lengthInSamples == pcm_samples.shape[1]
+        assert np.array_equal(reader.readArray(dtype=np.int16), pcm_samples)
+
+def test_create_reader_for_buffer_keeps_data_alive(manager, wav_path, pcm_samples):
+    reader = manager.createReaderForBuffer(memoryview(bytes(wav_path.read_bytes())))
+    gc.collect()
+
+    assert np.array_equal(reader.readArray(dtype=np.int16), pcm_samples)
+
+def test_create_reader_for_buffer_locks_data(manager, wav_path, pcm_samples):
+    data = bytearray(wav_path.read_bytes())
+    reader = manager.createReaderForBuffer(data)
+
+    with pytest.raises(BufferError):
+        data.extend(b"\0" * 1024)
+
+    assert np.array_equal(reader.readArray(dtype=np.int16), pcm_samples)
+
+    del reader
+    gc.collect()
+
+    data.extend(b"\0" * 1024)
+
+def test_create_reader_for_invalid_buffer(manager, wav_path):
+    assert manager.createReaderForBuffer(b"not an audio file") is None
+
+    data = np.frombuffer(wav_path.read_bytes(), dtype=np.uint8)
+    with pytest.raises(ValueError):
+        manager.createReaderForBuffer(data[::2])
+
+    with pytest.raises(TypeError):
+        manager.createReaderForBuffer(42)
+
+#==================================================================================================
+
+def test_create_reader_for_stream(manager, wav_path, pcm_samples):
+    reader = manager.createReaderFor(juce.MemoryInputStream(wav_path.read_bytes(), True))
+    assert reader is not None
+    assert np.array_equal(reader.readArray(dtype=np.int16), pcm_samples)
+
+    assert manager.createReaderFor(juce.MemoryInputStream(b"not an audio file", True)) is None
+
+    with pytest.raises(TypeError):
+        manager.createReaderFor(42)
+
+#==================================================================================================
+
+@pytest.mark.parametrize("compression", [zipfile.ZIP_STORED, zipfile.ZIP_DEFLATED])
+def test_create_reader_for_zip_entry(tmp_path, manager, wav_path, pcm_samples, compression):
+    archive = tmp_path / "archive.zip"
+    with zipfile.ZipFile(archive, "w", compression=compression) as z:
+        z.writestr("readme.txt", "not audio")
+        z.write(wav_path, "audio/signal.wav")
+
+    zip_file = juce.ZipFile(juce.File(str(archive)))
+
+    reader = manager.createReaderForZipEntry(zip_file, "audio/signal.wav")
+    assert reader is not None
+    assert np.array_equal(reader.readArray(dtype=np.int16), pcm_samples)
+    assert np.array_equal(reader.readArray(5000, 100, dtype=np.int16), pcm_samples[:, 5000:5100])
+    assert np.array_equal(reader.readArray(10, 100, dtype=np.int16), pcm_samples[:, 10:110])
+
+    index = zip_file.getIndexOfFileName("audio/signal.wav")
+    del zip_file
+    gc.collect()
+
+    assert np.array_equal(reader.readArray(dtype=np.int16), pcm_samples)
+
+    zip_file = juce.ZipFile(juce.File(str(archive)))
+    assert manager.createReaderForZipEntry(zip_file, index) is not None
+    assert manager.createReaderForZipEntry(zip_file, "AUDIO/SIGNAL.WAV", ignoreCase=True) is not None
+    assert manager.createReaderForZipEntry(zip_file, "readme.txt") is None
+
+    with pytest.raises(KeyError):
+        manager.createReaderForZipEntry(zip_file, "missing.wav")
+
+    with pytest.raises(IndexError):
+        manager.createReaderForZipEntry(zip_file, 10)
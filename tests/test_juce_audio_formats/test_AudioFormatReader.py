@@ -0,0 +1,138 @@
+import pytest
+import numpy as np
+
+import popsicle as juce
+
+from .utilities import make_test_signal, write_wav, create_reader
+
+#==================================================================================================
+
+@pytest.fixture
+def pcm_samples():
+    return (make_test_signal() * 32767).astype(np.int16)
+
+@pytest.fixture
+def pcm_reader(tmp_path, pcm_samples):
+    return create_reader(write_wav(tmp_path / "pcm.wav", pcm_samples))
+
+@pytest.fixture
+def float_reader(tmp_path):
+    return create_reader(write_wav(tmp_path / "float.wav", make_test_signal(), floating_point=True))
+
+#==================================================================================================
+
+def test_read_array_int16(pcm_reader, pcm_samples):
+    assert pcm_reader.numChannels == 2
+    assert pcm_reader.lengthInSamples == pcm_samples.shape[1]
+
+    data = pcm_reader.readArray(dtype=np.int16)
+    assert data.dtype == np.int16
+    assert data.shape == pcm_samples.shape
+    assert data.flags.c_contiguous
+    assert np.array_equal(data, pcm_samples)
+
+#==================================================================================================
+
+def test_read_array_float32_and_int32(pcm_reader, pcm_samples):
+    data = pcm_reader.readArray()
+    assert data.dtype == np.float32
+    assert np.allclose(data, pcm_samples / 32768.0)
+
+    data = pcm_reader.readArray(dtype="int32")
+    assert data.dtype == np.int32
+    assert np.array_equal(data, pcm_samples.astype(np.int32) << 16)
+
+#==================================================================================================
+
+def test_read_array_range(pcm_reader, pcm_samples):
+    data = pcm_reader.readArray(1000, 500, np.int16)
+    assert data.shape == (2, 500)
+    assert np.array_equal(data, pcm_samples[:, 1000:1500])
+
+    data = pcm_reader.readArray(pcm_samples.shape[1] - 100, dtype=np.int16)
+    assert data.shape == (2, 100)
+
+    data = pcm_reader.readArray(pcm_samples.shape[1] - 10, 20, np.int16)
+    assert np.array_equal(data[:, :10], pcm_samples[:, -10:])
+    assert np.all(data[:, 10:] == 0)
+
+#==================================================================================================
+
+def test_read_array_from_float_file(float_reader):
+    expected = make_test_signal()
+
+    assert np.array_equal(float_reader.readArray(), expected)
+    assert np.allclose(float_reader.readArray(dtype=np.int16) / 32768.0, expected, atol=1.0 / 16384)
+    assert np.allclose(float_reader.readArray(dtype=np.int32) / 2147483648.0, expected, atol=1e-6)
+
+#==================================================================================================
+
+def test_read_array_invalid_dtype(pcm_reader):
+    with pytest.raises(TypeError):
+        pcm_reader.readArray(dtype=np.float64)
+
+#==================================================================================================
+
+def test_read_into(pcm_reader, pcm_samples):
+    destination = np.zeros((2, 2000), dtype=np.float32)
+    assert pcm_reader.readInto(destination, 500)
+    assert np.allclose(destination, pcm_samples[:, 500:2500] / 32768.0)
+
+    destination = np.zeros((2, 2000), dtype=np.int16)
+    assert pcm_reader.readInto(destination, 100, 1000)
+    assert np.array_equal(destination[:, :1000], pcm_samples[:, 100:1100])
+    assert np.all(destination[:, 1000:] == 0)
+
+    with pytest.raises(ValueError):
+        pcm_reader.readInto(destination, 0, 3000)
+
+#==================================================================================================
+
+def test_read_into_channel_list(pcm_reader, pcm_samples):
+    left = np.zeros(1000, dtype=np.int16)
+    right = np.zeros(1000, dtype=np.int16)
+
+    assert pcm_reader.readInto([left, right])
+    assert np.array_equal(left, pcm_samples[0, :1000])
+    assert np.array_equal(right, pcm_samples[1, :1000])
+
+    mono = np.zeros(1000, dtype=np.int32)
+    assert pcm_reader.readInto(mono, 200)
+    assert np.array_equal(mono, pcm_samples[0, 200:1200].astype(np.int32) << 16)
+
+#==================================================================================================
+
+def test_read_into_extra_channels_are_cleared(pcm_reader):
+    destination = np.ones((3, 100), dtype=np.float32)
+    assert pcm_reader.readInto(destination)
+    assert np.all(destination[2] == 0.0)
+
+#==================================================================================================
+
+def test_read_into_invalid_destination(pcm_reader):
+    with pytest.raises(TypeError):
+        pcm_reader.readInto(np.zeros((2, 100), dtype=np.float64))
+
+    with pytest.raises(ValueError):
+        pcm_reader.readInto(np.zeros((100, 2), dtype=np.float32).T)
+
+    with pytest.raises(TypeError):
+        pcm_reader.readInto(42)
+
+#==================================================================================================
+
+@pytest.mark.parametrize("interpolator", [juce.ResamplingInterpolator.lagrange, juce.ResamplingInterpolator.windowedSinc])
+def test_read_resampled(pcm_reader, interpolator):
+    full = pcm_reader.readArray()
+
+    result = pcm_reader.readResampled(22050.0, interpolator=interpolator)
+    assert result.dtype == np.float32
+    assert result.shape == (2, full.shape[1] // 2)
+    assert np.array_equal(result, juce.resample(full, 44100.0, 22050.0, interpolator=interpolator))
+
+    result = pcm_reader.readResampled(48000.0, startSample=1000, numSamples=4410, threadPool=juce.ThreadPool())
+    assert result.shape == (2, 4800)
+    assert np.array_equal(result, juce.resample(full[:, 1000:5410], 44100.0, 48000.0))
+
+    with pytest.raises(ValueError):
+        pcm_reader.readResampled(0.0)
@@ -0,0 +1,113 @@
+import pytest
+import numpy as np
+
+import popsicle as juce
+
+from .utilities import make_test_signal, write_wav, create_reader
+
+#==================================================================================================
+
+@pytest.fixture
+def samples():
+    return make_test_signal(2, 10000)
+
+@pytest.fixture
+def reader(tmp_path, samples):
+    return create_reader(write_wav(tmp_path / "float.wav", samples, floating_point=True))
+
+@pytest.fixture
+def thread():
+    thread = juce.TimeSliceThread("prefetch")
+    thread.startThread()
+    yield thread
+    thread.stopThread(1000)
+
+def collect(chunks):
+    return [(chunks.getChunkPosition(), chunks.getNumValidSamples(), chunk.copy()) for chunk in chunks]
+
+#==================================================================================================
+
+def test_chunks_cover_the_reader(reader, samples):
+    chunks = reader.chunks(4096)
+    assert len(chunks) == 3
+    assert chunks.getChunkSize() == 4096
+    assert chunks.getHopSize() == 4096
+
+    result = collect(chunks)
+    assert [position for position, _, _ in result] == [0, 4096, 8192]
+    assert [valid for _, valid, _ in result] == [4096, 4096, 10000 - 8192]
+
+    assert np.array_equal(np.concatenate([chunk for _, _, chunk in result], axis=1)[:, :10000], samples)
+    assert np.all(result[-1][2][:, 10000 - 8192:] == 0.0)
+
+#==================================================================================================
+
+def test_chunks_reuse_the_same_array(reader):
+    arrays = [chunk for chunk in reader.chunks(1000)]
+    assert len(arrays) == 10
+    assert all(array is arrays[0] for array in arrays)
+    assert arrays[0].shape == (2, 1000)
+    assert arrays[0].dtype == np.float32
+
+#==================================================================================================
+
+def test_chunks_with_overlap(reader, samples):
+    chunks = reader.chunks(1024, overlap=768)
+    assert chunks.getHopSize() == 256
+
+    result = collect(chunks)
+    assert len(result) == len(chunks)
+    assert result[-1][0] + 1024 >= 10000
+    assert result[-2][0] + 1024 < 10000
+
+    for position, valid, chunk in result:
+        assert np.array_equal(chunk[:, :valid], samples[:, position:position + valid])
+
+#==================================================================================================
+
+def test_chunks_of_a_range(reader, samples):
+    result = collect(reader.chunks(300, startSample=1000, numSamples=1000))
+    assert [position for position, _, _ in result] == [1000, 1300, 1600, 1900]
+    assert result[-1][1] == 100
+
+    # Samples past the requested range are padding, even if the file has more
+    assert np.array_equal(result[-1][2][:, :100], samples[:, 1900:2000])
+    assert np.all(result[-1][2][:, 100:] == 0.0)
+
+    assert len(reader.chunks(100, startSample=10000)) == 0
+
+#==================================================================================================
+
+def test_chunks_prefetched_on_thread(reader, samples, thread):
+    for overlap in (0, 100):
+        sequential = collect(reader.chunks(512, overlap=overlap))
+        prefetched = collect(reader.chunks(512, overlap=overlap, thread=thread, prefetchChunks=4))
+
+        assert len(sequential) == len(prefetched)
+        for lhs, rhs in zip(sequential, prefetched):
+            assert lhs[0] == rhs[0]
+            assert np.array_equal(lhs[2], rhs[2])
+
+    assert thread.getNumClients() == 0
+
+#==================================================================================================
+
+def test_chunks_from_reader_source(reader, samples):
+    source = juce.AudioFormatReaderSource(reader, False)
+    source.setNextReadPosition(5000)
+
+    result = collect(source.chunks(2500))
+    assert [position for position, _, _ in result] == [5000, 7500]
+    assert np.array_equal(result[0][2], samples[:, 5000:7500])
+
+#==================================================================================================
+
+def test_chunks_invalid_arguments(reader):
+    with pytest.raises(ValueError):
+        reader.chunks(0)
+
+    with pytest.raises(ValueError):
+        reader.chunks(100, overlap=100)
+
+    with pytest.raises(ValueError):
+        reader.chunks(100, prefetchChunks=0)
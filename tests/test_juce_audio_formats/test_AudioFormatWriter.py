@@ -0,0 +1,93 @@
+import pytest
+import numpy as np
+
+import popsicle as juce
+
+from .utilities import make_test_signal, create_reader, create_wav_writer
+
+#==================================================================================================
+
+def write_and_read_back(tmp_path, data, bits_per_sample, dtype):
+    file = juce.File(str(tmp_path / "written.wav"))
+
+    writer = create_wav_writer(file, data.shape[0], bits_per_sample)
+    assert writer is not None
+    assert writer.writeArray(data)
+    del writer
+
+    return create_reader(file).readArray(dtype=dtype)
+
+#==================================================================================================
+
+def test_write_array_int16(tmp_path):
+    data = (make_test_signal() * 32767).astype(np.int16)
+    assert np.array_equal(write_and_read_back(tmp_path, data, 16, np.int16), data)
+
+#==================================================================================================
+
+def test_write_array_float32(tmp_path):
+    data = make_test_signal()
+
+    assert np.array_equal(write_and_read_back(tmp_path, data, 32, np.float32), data)
+    assert np.allclose(write_and_read_back(tmp_path, data, 24, np.float32), data, atol=1e-6)
+
+#==================================================================================================
+
+def test_write_array_int32(tmp_path):
+    data = (make_test_signal() * 2147483647).astype(np.int32)
+
+    assert np.array_equal(write_and_read_back(tmp_path, data, 24, np.int32) >> 8, data >> 8)
+    assert np.allclose(write_and_read_back(tmp_path, data, 32, np.float32), data / 2147483648.0, atol=1e-6)
+
+#==================================================================================================
+
+def test_write_array_partial_and_channel_list(tmp_path):
+    file = juce.File(str(tmp_path / "written.wav"))
+    data = (make_test_signal() * 32767).astype(np.int16)
+
+    writer = create_wav_writer(file)
+    assert writer.writeArray([data[0], data[1]], 1000)
+    assert writer.writeArray(data[:, 1000:])
+    del writer
+
+    assert np.array_equal(create_reader(file).readArray(dtype=np.int16), data)
+
+#==================================================================================================
+
+def test_write_array_invalid_data(tmp_path):
+    writer = create_wav_writer(juce.File(str(tmp_path / "written.wav")))
+
+    with pytest.raises(ValueError):
+        writer.writeArray(np.zeros((1, 100), dtype=np.float32))
+
+    with pytest.raises(ValueError):
+        writer.writeArray(np.zeros((2, 100), dtype=np.float32), 200)
+
+    with pytest.raises(TypeError):
+        writer.writeArray(np.zeros((2, 100), dtype=np.float64))
+
+#==================================================================================================
+
+def test_threaded_writer(tmp_path):
+    file = juce.File(str(tmp_path / "threaded.wav"))
+    data = make_test_signal()
+
+    thread = juce.TimeSliceThread("writer")
+    thread.startThread()
+
+    try:
+        writer = juce.AudioFormatWriter.ThreadedWriter(create_wav_writer(file, bits_per_sample=32), thread, 65536)
+        assert writer.getNumChannels() == 2
+
+        for start in range(0, data.shape[1], 512):
+            assert writer.write(np.ascontiguousarray(data[:, start:start + 512]))
+
+        with pytest.raises(ValueError):
+            writer.write(np.zeros((1, 512), dtype=np.float32))
+
+        del writer
+
+    finally:
+        thread.stopThread(1000)
+
+    assert np.array_equal(create_reader(file).readArray(), data)
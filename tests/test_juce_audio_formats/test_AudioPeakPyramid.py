@@ -0,0 +1,152 @@
+import pytest
+import numpy as np
+
+import popsicle as juce
+
+from .utilities import make_test_signal, write_wav, create_reader
+
+#==================================================================================================
+
+@pytest.fixture
+def manager():
+    manager = juce.AudioFormatManager()
+    manager.registerBasicFormats()
+    return manager
+
+@pytest.fixture
+def wav_file(tmp_path):
+    return write_wav(tmp_path / "signal.wav", (make_test_signal() * 32767).astype(np.int16))
+
+def reference_levels(samples, bin_size):
+    num_bins = -(-samples.shape[1] // bin_size)
+    levels = np.zeros((samples.shape[0], num_bins, 3), dtype=np.float64)
+
+    for bin in range(num_bins):
+        block = samples[:, bin * bin_size:(bin + 1) * bin_size].astype(np.float64)
+        levels[:, bin, 0] = block.min(axis=1)
+        levels[:, bin, 1] = block.max(axis=1)
+        levels[:, bin, 2] = np.sqrt((block ** 2).mean(axis=1))
+
+    return levels
+
+#==================================================================================================
+
+def test_build_levels(wav_file):
+    reader = create_reader(wav_file)
+    samples = reader.readArray()
+
+    pyramid = juce.AudioPeakPyramid.build(reader, binSize=256, factor=4)
+    assert pyramid.getNumChannels() == 2
+    assert pyramid.getSampleRate() == 44100.0
+    assert pyramid.getLengthInSamples() == 10000
+    assert pyramid.getFactor() == 4
+    assert pyramid.getNumLevels() == 4
+    assert [pyramid.getBinSize(level) for level in range(4)] == [256, 1024, 4096, 16384]
+
+    for level in range(pyramid.getNumLevels()):
+        values = pyramid.getLevel(level)
+        assert values.dtype == np.float32
+        assert np.allclose(values, reference_levels(samples, pyramid.getBinSize(level)), atol=1e-6)
+
+    assert pyramid.getLevel(3).shape == (2, 1, 3)
+
+    with pytest.raises(IndexError):
+        pyramid.getLevel(4)
+
+#==================================================================================================
+
+def test_pixel_queries(wav_file):
+    reader = create_reader(wav_file)
+    samples = reader.readArray()
+    pyramid = juce.AudioPeakPyramid.build(reader)
+
+    expected = reference_levels(samples, 1024)
+
+    min_max = pyramid.getMinMax(0, 10240, 10)
+    assert min_max.shape == (2, 10, 2)
+    assert np.allclose(min_max, expected[:, :, :2], atol=1e-6)
+
+    rms = pyramid.getRMS(0, 10240, 10)
+    assert rms.shape == (2, 10)
+    assert np.allclose(rms, expected[:, :, 2], atol=1e-6)
+
+    levels = pyramid.getLevels(0, 10240, 10)
+    assert levels.shape == (2, 10, 3)
+    assert np.allclose(levels, expected, atol=1e-6)
+
+    # Every pixel covers at least the samples it spans
+    min_max = pyramid.getMinMax(1000, 9000, 7)
+    for pixel, start in enumerate(np.linspace(1000, 9000, 8)[:-1]):
+        block = samples[:, int(start):int(start + 8000 / 7)]
+        assert np.all(min_max[:, pixel, 0] <= block.min(axis=1))
+        assert np.all(min_max[:, pixel, 1] >= block.max(axis=1))
+
+    # Pixels finer than the first level repeat its bins, pixels past the end are silent
+    assert np.array_equal(pyramid.getMinMax(0, 256, 4)[:, 0], pyramid.getMinMax(0, 256, 4)[:, 3])
+    assert np.all(pyramid.getMinMax(20000, 30000, 5) == 0.0)
+
+    with pytest.raises(ValueError):
+        pyramid.getMinMax(100, 100, 10)
+
+    with pytest.raises(ValueError):
+        pyramid.getMinMax(0, 100, 0)
+
+#==================================================================================================
+
+def test_save_and_load(tmp_path, wav_file):
+    pyramid = juce.AudioPeakPyramid.build(create_reader(wav_file), binSize=100, factor=2)
+
+    assert pyramid.save(tmp_path / "saved.peaks")
+
+    loaded = juce.AudioPeakPyramid.load(tmp_path / "saved.peaks")
+    assert loaded.getNumLevels() == pyramid.getNumLevels()
+    assert loaded.getBinSize(0) == 100
+    for level in range(pyramid.getNumLevels()):
+        assert np.array_equal(loaded.getLevel(level), pyramid.getLevel(level))
+
+    (tmp_path / "broken.peaks").write_bytes(b"not a pyramid")
+    assert juce.AudioPeakPyramid.load(tmp_path / "broken.peaks") is None
+    assert juce.AudioPeakPyramid.load(tmp_path / "missing.peaks") is None
+
+#==================================================================================================
+
+def test_create_for_uses_the_cache(tmp_path, manager, wav_file):
+    cache_directory = tmp_path / "cache"
+
+    cache_file = juce.AudioPeakPyramid.getCacheFileFor(wav_file, cache_directory)
+    assert cache_file.getParentDirectory().getFullPathName() == str(cache_directory)
+    assert juce.AudioPeakPyramid.getCacheFileFor(wav_file).getFullPathName() == wav_file.getFullPathName() + ".peaks"
+
+    pyramid = juce.AudioPeakPyramid.createFor(manager, wav_file, cache_directory)
+    assert cache_file.existsAsFile()
+    modification_time = cache_file.getLastModificationTime().toMilliseconds()
+
+    cached = juce.AudioPeakPyramid.createFor(manager, wav_file, cache_directory)
+    assert cache_file.getLastModificationTime().toMilliseconds() == modification_time
+    assert np.array_equal(cached.getLevel(0), pyramid.getLevel(0))
+
+    # Changing the source invalidates the cache
+    write_wav(tmp_path / "signal.wav", (make_test_signal(2, 5000) * 16000).astype(np.int16))
+    rebuilt = juce.AudioPeakPyramid.createFor(manager, wav_file, cache_directory)
+    assert rebuilt.getLengthInSamples() == 5000
+
+    # Different settings rebuild the pyramid too
+    assert juce.AudioPeakPyramid.createFor(manager, wav_file, cache_directory, binSize=512).getBinSize(0) == 512
+
+#==================================================================================================
+
+def test_create_for_next_to_the_file(manager, wav_file):
+    pyramid = juce.AudioPeakPyramid.createFor(manager, str(wav_file.getFullPathName()))
+    assert pyramid.getNumChannels() == 2
+    assert juce.File(wav_file.getFullPathName() + ".peaks").existsAsFile()
+
+#==================================================================================================
+
+def test_invalid_settings(tmp_path, manager, wav_file):
+    with pytest.raises(ValueError):
+        juce.AudioPeakPyramid.build(create_reader(wav_file), binSize=0)
+
+    with pytest.raises(ValueError):
+        juce.AudioPeakPyramid.build(create_reader(wav_file), factor=1)
+
+    assert juce.AudioPeakPyramid.createFor(manager, tmp_path / "missing.wav") is None
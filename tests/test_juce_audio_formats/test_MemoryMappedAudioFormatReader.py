@@ -0,0 +1,87 @@
+import gc
+import pytest
+import numpy as np
+
+import popsicle as juce
+
+from .utilities import make_test_signal, write_wav
+
+#==================================================================================================
+
+def write_with_format(format, file, data, bits_per_sample):
+    file.deleteFile()
+
+    writer = format.createWriterFor(juce.FileOutputStream(file), 44100.0, data.shape[0], bits_per_sample)
+    assert writer.writeArray(data)
+    del writer
+
+    return file
+
+#==================================================================================================
+
+def test_sample_view_of_pcm_wav(tmp_path):
+    samples = (make_test_signal() * 32767).astype(np.int16)
+    reader = juce.WavAudioFormat().createMemoryMappedReader(write_wav(tmp_path / "pcm.wav", samples))
+    assert reader is not None
+
+    view = reader.getSampleView()
+    assert view.dtype == np.dtype("<i2")
+    assert view.shape == (samples.shape[1], 2)
+    assert not view.flags.writeable
+    assert np.array_equal(view, samples.T)
+
+    with pytest.raises(ValueError):
+        view[0, 0] = 1
+
+#==================================================================================================
+
+def test_sample_view_of_float_wav(tmp_path):
+    samples = make_test_signal()
+    reader = juce.WavAudioFormat().createMemoryMappedReader(write_wav(tmp_path / "float.wav", samples, floating_point=True))
+
+    view = reader.getSampleView(1000, 500)
+    assert view.dtype == np.dtype("<f4")
+    assert view.shape == (500, 2)
+    assert np.array_equal(view, samples[:, 1000:1500].T)
+
+    assert reader.getSampleView(samples.shape[1]).shape == (0, 2)
+
+#==================================================================================================
+
+def test_sample_view_of_big_endian_aiff(tmp_path):
+    samples = (make_test_signal() * 32767).astype(np.int16)
+    file = write_with_format(juce.AiffAudioFormat(), juce.File(str(tmp_path / "pcm.aiff")), samples, 16)
+
+    reader = juce.AiffAudioFormat().createMemoryMappedReader(file)
+    view = reader.getSampleView()
+    assert view.dtype == np.dtype(">i2")
+    assert np.array_equal(view, samples.T)
+
+#==================================================================================================
+
+def test_sample_view_outlives_reader(tmp_path):
+    samples = (make_test_signal() * 32767).astype(np.int16)
+    reader = juce.WavAudioFormat().createMemoryMappedReader(write_wav(tmp_path / "pcm.wav", samples))
+
+    view = reader.getSampleView(100)
+    del reader
+    gc.collect()
+
+    assert np.array_equal(view, samples[:, 100:].T)
+
+#==================================================================================================
+
+def test_sample_view_invalid_requests(tmp_path):
+    samples = make_test_signal()
+    file = write_with_format(juce.WavAudioFormat(), juce.File(str(tmp_path / "pcm24.wav")), samples, 24)
+
+    reader = juce.WavAudioFormat().createMemoryMappedReader(file)
+    with pytest.raises(ValueError):
+        reader.getSampleView()
+
+    reader = juce.WavAudioFormat().createMemoryMappedReader(write_wav(tmp_path / "pcm.wav", samples))
+    with pytest.raises(ValueError):
+        reader.getSampleView(-1)
+
+    with pytest.raises(ValueError):
+        reader.getSampleView(0, samples.shape[1] + 1)
@@ -0,0 +1,75 @@
+import pytest
+import numpy as np
+
+import popsicle as juce
+
+#==================================================================================================
+
+SAMPLE_RATE = 44100.0
+
+def make_sample(num_samples=4410):
+    buffer = juce.AudioBufferFloat(1, num_samples)
+    np.asarray(buffer)[0] = np.linspace(1.0, 0.0, num_samples, endpoint=False)
+    return buffer
+
+def all_notes():
+    notes = juce.BigInteger()
+    notes.setRange(0, 128, True)
+    return notes
+
+def make_sampler(sound, num_voices=2):
+    synth = juce.Synthesiser()
+    for _ in range(num_voices):
+        synth.addVoice(juce.SamplerVoice())
+
+    synth.addSound(sound)
+    synth.setCurrentPlaybackSampleRate(SAMPLE_RATE)
+    return synth
+
+def render(synth, midi, num_samples):
+    buffer = juce.AudioBufferFloat(2, num_samples)
+    buffer.clear()
+
+    synth.renderNextBlock(buffer, midi, 0, num_samples)
+    return np.array(buffer)
+
+#==================================================================================================
+
+def test_sampler_sound_from_buffer():
+    sample = make_sample()
+
+    sound = juce.SamplerSound("ramp", sample, SAMPLE_RATE, all_notes(), 60)
+    assert sound.getName() == "ramp"
+    assert sound.appliesToNote(60)
+    assert sound.appliesToChannel(1)
+
+    data = sound.getAudioData()
+    assert data.getNumChannels() == 1
+    assert data.getNumSamples() >= sample.getNumSamples()
+    assert np.allclose(np.asarray(data)[0, :sample.getNumSamples()], np.asarray(sample)[0])
+
+#==================================================================================================
+
+def test_sampler_sound_invalid_sample_rate():
+    with pytest.raises(ValueError):
+        juce.SamplerSound("ramp", make_sample(), 0.0, all_notes(), 60)
+
+#==================================================================================================
+
+def test_sampler_voice_plays_sample_at_root_note():
+    sample = make_sample()
+    synth = make_sampler(juce.SamplerSound("ramp", sample, SAMPLE_RATE, all_notes(), 60))
+
+    midi = juce.MidiBuffer()
+    midi.addEvent(juce.MidiMessage.noteOn(1, 60, 1.0), 0)
+
+    output = render(synth, midi, 2048)
+    expected = np.asarray(sample)[0, :2048]
+    assert np.allclose(output[0, 1:2048], expected[1:2048], atol=1e-2)
+
+#==================================================================================================
+
+def test_sampler_voice_ignores_other_sounds():
+    voice = juce.SamplerVoice()
+    assert not voice.canPlaySound(juce.SimpleSynthesiserSound())
+    assert voice.canPlaySound(juce.SamplerSound("ramp", make_sample(), SAMPLE_RATE, all_notes(), 60))
@@ -0,0 +1,40 @@
+import struct
+import numpy as np
+
+import popsicle as juce
+
+#==================================================================================================
+
+def make_test_signal(num_channels=2, num_samples=10000):
+    phase = np.arange(num_samples) * 2.0 * np.pi / 100.0
+    return np.stack([np.sin(phase * (channel + 1)) * 0.5 for channel in range(num_channels)]).astype(np.float32)
+
+def write_wav(path, samples, sample_rate=44100, floating_point=False):
+    """Writes a (channels x samples) array as a 16 bit PCM or 32 bit float WAV file."""
+    samples = np.atleast_2d(samples)
+    num_channels = samples.shape[0]
+
+    if floating_point:
+        data = samples.T.astype("<f4").tobytes()
+        format_tag, bits_per_sample = 3, 32
+    else:
+        data = samples.T.astype("<i2").tobytes()
+        format_tag, bits_per_sample = 1, 16
+
+    block_align = num_channels * bits_per_sample // 8
+
+    with open(path, "wb") as f:
+        f.write(b"RIFF" + struct.pack("<I", 36 + len(data)) + b"WAVE")
+        f.write(b"fmt " + struct.pack("<IHHIIHH", 16, format_tag, num_channels, sample_rate, sample_rate * block_align, block_align, bits_per_sample))
+        f.write(b"data" + struct.pack("<I", len(data)) + data)
+
+    return juce.File(str(path))
+
+def create_reader(file):
+    manager = juce.AudioFormatManager()
+    manager.registerBasicFormats()
+    return manager.createReaderFor(file)
+
+def create_wav_writer(file, num_channels=2, bits_per_sample=16, sample_rate=44100.0):
+    file.deleteFile()
+    return juce.WavAudioFormat().createWriterFor(juce.FileOutputStream(file), sample_rate, num_channels, bits_per_sample)
@@ -0,0 +1,150 @@
+import pytest
+import numpy as np
+
+import popsicle as juce
+
+#==================================================================================================
+
+def stereo_buses():
+    return (juce.AudioProcessor.BusesProperties()
+        .withInput("Input", juce.AudioChannelSet.stereo())
+        .withOutput("Output", juce.AudioChannelSet.stereo()))
+
+class GainProcessor(juce.AudioProcessor):
+    def __init__(self, gain):
+        juce.AudioProcessor.__init__(self, stereo_buses())
+        self.gain = gain
+        self.prepared = None
+        self.released = False
+        self.state = b""
+
+    def getName(self):
+        return "Gain"
+
+    def prepareToPlay(self, sampleRate, maximumExpectedSamplesPerBlock):
+        self.prepared = (sampleRate, maximumExpectedSamplesPerBlock)
+
+    def releaseResources(self):
+        self.released = True
+
+    def processBlock(self, buffer, midiMessages):
+        for channel in range(buffer.getNumChannels()):
+            data = np.asarray(buffer.getWritePointer(channel))
+            data[:buffer.getNumSamples()] *= self.gain
+
+    def getTailLengthSeconds(self):
+        return 0.0
+
+    def acceptsMidi(self):
+        return False
+
+    def producesMidi(self):
+        return False
+
+    def getStateInformation(self, destData):
+        destData.append(b"\x01\x02\x03")
+
+    def setStateInformation(self, data):
+        self.state = bytes(data)
+
+#==================================================================================================
+
+def test_python_processor():
+    processor = GainProcessor(0.5)
+    assert processor.getName() == "Gain"
+    assert processor.getTotalNumInputChannels() == 2
+    assert processor.getTotalNumOutputChannels() == 2
+    assert not processor.hasEditor()
+    assert processor.getNumPrograms() == 1
+    assert processor.getProgramName(0) == ""
+
+    processor.setRateAndBufferSizeDetails(48000.0, 32)
+    juce.AudioProcessor.prepareToPlay(processor, 48000.0, 32)
+    assert processor.prepared == (48000.0, 32)
+
+    buffer = juce.AudioBufferFloat(2, 32)
+    for channel in range(2):
+        np.asarray(buffer.getWritePointer(channel))[:] = 1.0
+
+    midi = juce.MidiBuffer()
+    juce.AudioProcessor.processBlock(processor, buffer, midi)
+
+    for channel in range(2):
+        assert np.all(np.asarray(buffer.getReadPointer(channel)) == 0.5)
+
+    juce.AudioProcessor.releaseResources(processor)
+    assert processor.released
+
+#==================================================================================================
+
+def test_python_processor_state():
+    processor = GainProcessor(1.0)
+
+    block = juce.MemoryBlock()
+    juce.AudioProcessor.getStateInformation(processor, block)
+    assert block.getSize() == 3
+
+    juce.AudioProcessor.setStateInformation(processor, b"\x04\x05")
+    assert processor.state == b"\x04\x05"
+
+#==================================================================================================
+
+def test_python_processor_midi():
+    class NoteCounter(GainProcessor):
+        def __init__(self):
+            super().__init__(1.0)
+            self.events = []
+
+        def acceptsMidi(self):
+            return True
+
+        def processBlock(self, buffer, midiMessages):
+            self.events.extend(midiMessages)
+
+    processor = NoteCounter()
+    assert processor.acceptsMidi()
+
+    midi = juce.MidiBuffer()
+    midi.addEvent(bytes([0x90, 60, 100]), 3)
+    midi.addEvent(bytes([0x80, 60, 0]), 10)
+
+    juce.AudioProcessor.processBlock(processor, juce.AudioBufferFloat(2, 16), midi)
+    assert processor.events == [(bytes([0x90, 60, 100]), 3), (bytes([0x80, 60, 0]), 10)]
+
+#==================================================================================================
+
+def test_missing_process_block_renders_silence():
+    class SilentProcessor(juce.AudioProcessor):
+        def __init__(self):
+            juce.AudioProcessor.__init__(self, stereo_buses())
+
+    processor = SilentProcessor()
+
+    buffer = juce.AudioBufferFloat(2, 16)
+    for channel in range(2):
+        np.asarray(buffer.getWritePointer(channel))[:] = 1.0
+
+    juce.AudioProcessor.processBlock(processor, buffer, juce.MidiBuffer())
+
+    for channel in range(2):
+        assert np.all(np.asarray(buffer.getReadPointer(channel)) == 0.0)
+
+#==================================================================================================
+
+def test_double_precision_falls_back_without_override():
+    processor = GainProcessor(0.5)
+    assert not processor.supportsDoublePrecisionProcessing()
+
+#==================================================================================================
+
+def test_timing_stats():
+    processor = GainProcessor(0.5)
+    processor.setTimingEnabled(True)
+    juce.AudioProcessor.prepareToPlay(processor, 44100.0, 64)
+
+    for _ in range(4):
+        juce.AudioProcessor.processBlock(processor, juce.AudioBufferFloat(2, 64), juce.MidiBuffer())
+
+    stats = processor.getTimingStats()
+    assert stats["total"]["count"] == 4
+    assert stats["python"]["count"] == 4
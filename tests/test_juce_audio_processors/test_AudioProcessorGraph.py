@@ -0,0 +1,162 @@
+import ctypes
+import numpy as np
+
+import popsicle as juce
+
+from .test_AudioProcessor import GainProcessor
+
+#==================================================================================================
+
+PROCESS = ctypes.CFUNCTYPE(None,
+    ctypes.c_void_p,
+    ctypes.POINTER(ctypes.POINTER(ctypes.c_float)), ctypes.c_int,
+    ctypes.c_int)
+
+@PROCESS
+def native_double(userData, channels, numChannels, numSamples):
+    for channel in range(numChannels):
+        for sample in range(numSamples):
+            channels[channel][sample] *= 2.0
+
+IODeviceType = juce.AudioProcessorGraph.AudioGraphIOProcessor.IODeviceType
+
+#==================================================================================================
+
+def make_io_graph():
+    graph = juce.AudioProcessorGraph()
+    graph.setPlayConfigDetails(2, 2, 44100.0, 64)
+
+    input_node = graph.addNode(juce.AudioProcessorGraph.AudioGraphIOProcessor(IODeviceType.audioInputNode))
+    output_node = graph.addNode(juce.AudioProcessorGraph.AudioGraphIOProcessor(IODeviceType.audioOutputNode))
+
+    return graph, input_node, output_node
+
+def connect_stereo(graph, source, destination):
+    Connection = juce.AudioProcessorGraph.Connection
+    NodeAndChannel = juce.AudioProcessorGraph.NodeAndChannel
+
+    for channel in range(2):
+        assert graph.addConnection(Connection(
+            NodeAndChannel(source.nodeID, channel),
+            NodeAndChannel(destination.nodeID, channel)))
+
+def render(graph, value=1.0):
+    buffer = juce.AudioBufferFloat(2, 64)
+    for channel in range(2):
+        np.asarray(buffer.getWritePointer(channel))[:] = value
+
+    graph.processBlock(buffer, juce.MidiBuffer())
+
+    return [np.array(buffer.getReadPointer(channel))[:64] for channel in range(2)]
+
+#==================================================================================================
+
+def test_node_ids():
+    NodeID = juce.AudioProcessorGraph.NodeID
+    assert NodeID(1) == NodeID(1)
+    assert NodeID(1) != NodeID(2)
+    assert NodeID(1) < NodeID(2)
+    assert len({ NodeID(1), NodeID(1), NodeID(3) }) == 2
+
+    assert juce.AudioProcessorGraph.NodeAndChannel(NodeID(1), juce.AudioProcessorGraph.midiChannelIndex).isMIDI()
+
+#==================================================================================================
+
+def test_nodes_and_connections(juce_app):
+    graph, input_node, output_node = make_io_graph()
+    assert graph.getNumNodes() == 2
+    assert [node.nodeID for node in graph.getNodes()] == [input_node.nodeID, output_node.nodeID]
+    assert graph.getNodeForId(input_node.nodeID).nodeID == input_node.nodeID
+    assert graph.getNodeForId(juce.AudioProcessorGraph.NodeID(12345)) is None
+    assert input_node.getProcessor().isInput()
+    assert output_node.getProcessor().isOutput()
+
+    connect_stereo(graph, input_node, output_node)
+    assert graph.isConnected(input_node.nodeID, output_node.nodeID)
+    assert len(graph.getConnections()) == 2
+
+    graph.disconnectNode(input_node.nodeID)
+    assert not graph.isConnected(input_node.nodeID, output_node.nodeID)
+
+    assert graph.removeNode(input_node.nodeID) is not None
+    assert graph.getNumNodes() == 1
+
+    graph.clear()
+    assert graph.getNumNodes() == 0
+
+#==================================================================================================
+
+def test_python_node(juce_app):
+    graph, input_node, output_node = make_io_graph()
+
+    gain_node = graph.addNode(GainProcessor(0.25))
+    assert gain_node.getProcessor().getName() == "Gain"
+
+    connect_stereo(graph, input_node, gain_node)
+    connect_stereo(graph, gain_node, output_node)
+
+    graph.prepareToPlay(44100.0, 64)
+
+    for channel in render(graph):
+        assert np.allclose(channel, 0.25)
+
+    gain_node.setBypassed(True)
+    assert gain_node.isBypassed()
+
+    for channel in render(graph):
+        assert np.allclose(channel, 1.0)
+
+    graph.releaseResources()
+
+#==================================================================================================
+
+def test_native_node(juce_app):
+    graph, input_node, output_node = make_io_graph()
+
+    native = juce.NativeAudioProcessor(native_double, numInputChannels=2, numOutputChannels=2, name="Double")
+    assert native.getName() == "Double"
+    assert native.getTotalNumOutputChannels() == 2
+
+    native_node = graph.addNode(native)
+    gain_node = graph.addNode(GainProcessor(0.25))
+
+    connect_stereo(graph, input_node, native_node)
+    connect_stereo(graph, native_node, gain_node)
+    connect_stereo(graph, gain_node, output_node)
+
+    graph.prepareToPlay(44100.0, 64)
+
+    for channel in render(graph):
+        assert np.allclose(channel, 0.5)
+
+    graph.releaseResources()
+
+#==================================================================================================
+
+def test_player_renders_graph(juce_app):
+    graph, input_node, output_node = make_io_graph()
+
+    native_node = graph.addNode(juce.NativeAudioProcessor(native_double))
+    connect_stereo(graph, input_node, native_node)
+    connect_stereo(graph, native_node, output_node)
+
+    player = juce.AudioProcessorPlayer()
+    player.setProcessor(graph)
+    assert player.getCurrentProcessor() is graph
+
+    device_type = juce.RenderAudioIODeviceType(bufferSize=64, numOutputChannels=2, lengthInSamples=640)
+    device = device_type.createDevice("", "")
+
+    outputs = juce.BigInteger(0)
+    outputs.setRange(0, 2, True)
+    assert not device.open(juce.BigInteger(0), outputs, 0.0, 0)
+
+    device.start(player)
+    assert device.waitForRenderToFinish(5000)
+    device.stop()
+    device.close()
+
+    assert device.getNumSamplesRendered() == 640
+
+    player.setProcessor(None)
+    assert player.getCurrentProcessor() is None
@@ -0,0 +1,50 @@
+import popsicle as juce
+
+#==================================================================================================
+
+def test_construct():
+    fifo = juce.AbstractFifo(8)
+    assert fifo.getTotalSize() == 8
+    assert fifo.getFreeSpace() == 7
+    assert fifo.getNumReady() == 0
+
+#==================================================================================================
+
+def test_write_and_read():
+    fifo = juce.AbstractFifo(8)
+    storage = [None] * fifo.getTotalSize()
+
+    start1, size1, start2, size2 = fifo.prepareToWrite(5)
+    assert (start1, size1, start2, size2) == (0, 5, 0, 0)
+    for index in range(size1):
+        storage[start1 + index] = index
+    fifo.finishedWrite(size1 + size2)
+    assert fifo.getNumReady() == 5
+    assert fifo.getFreeSpace() == 2
+
+    start1, size1, start2, size2 = fifo.prepareToRead(3)
+    assert [storage[start1 + index] for index in range(size1)] == [0, 1, 2]
+    fifo.finishedRead(size1 + size2)
+    assert fifo.getNumReady() == 2
+
+#==================================================================================================
+
+def test_wrap_around():
+    fifo = juce.AbstractFifo(8)
+    fifo.finishedWrite(6)
+    fifo.finishedRead(6)
+
+    start1, size1, start2, size2 = fifo.prepareToWrite(5)
+    assert (start1, size1, start2, size2) == (6, 2, 0, 3)
+
+#==================================================================================================
+
+def test_reset_and_resize():
+    fifo = juce.AbstractFifo(8)
+    fifo.finishedWrite(4)
+    fifo.reset()
+    assert fifo.getNumReady() == 0
+
+    fifo.setTotalSize(16)
+    assert fifo.getTotalSize() == 16
+    assert fifo.getFreeSpace() == 15